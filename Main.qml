@@ -16,6 +16,12 @@
  * - Push animation: 200ms slide from right
  * - Pop animation: 150ms slide to right
  *
+ * All navigation goes through PageNavigator, which keeps every page on the
+ * stack at most once (opening a page already there unwinds to it). The
+ * gameplay and race gameplay pages come from PagePools: one instance each
+ * is pre-incubated asynchronously from the language menu / lobby, then
+ * reused via its activate()/deactivate() hooks.
+ *
  * @section state Application State
  * - currentLanguage: Selected language ("ID" or "EN")
  * - currentTime: Display duration string ("15s", "30s", "60s", "∞")
@@ -25,6 +31,7 @@
  *
  * @section shortcuts Global Keyboard Shortcuts
  * - Key_S: Toggle SFX (disabled during gameplay)
+ * - Ctrl+Shift+P: Toggle the performance overlay (PerfMonitor)
  *
  * @section pages Inline Page Components
  * This file contains inline Component definitions for all pages to enable
@@ -37,6 +44,7 @@ import QtQuick
 import QtQuick.Controls
 import QtQuick.Layouts
 import Qt5Compat.GraphicalEffects
+import rapid_texter
 import "qml/components"
 import "qml/pages"
 
@@ -61,16 +69,13 @@ ApplicationWindow {
         source: "assets/font/JetBrainsMono.ttf"
     }
 
-    // Application ready state for splash screen
-    property bool applicationReady: false
+    // Application ready state for splash screen. Word banks, history and
+    // progress are loaded in the background by GameBackend.
+    property bool applicationReady: GameBackend.ready
 
-    // Set theme font after font is loaded and mark app ready
+    // Set theme font after font is loaded
     Component.onCompleted: {
         Theme.fontFamily = jetBrainsMono.name;
-        // Mark application as ready after a small delay to ensure everything is initialized
-        Qt.callLater(function () {
-            applicationReady = true;
-        });
     }
 
     // Application state
@@ -79,6 +84,7 @@ ApplicationWindow {
     property string currentMode: "-"
     property string currentDifficulty: "easy"  // Default difficulty for TextProvider
     property int currentTargetWPM: 60          // Target WPM for manual mode
+    property string currentTextMode: "words"    // "words" (random), "natural" (corpus Markov text) or "weak" (weak-bigram practice)
     property string originalLanguage: ""        // Stores original language for Programmer Mode restoration
     property bool sfxEnabled: GameBackend.sfxEnabled
     property bool isInGameplay: false            // Track if in gameplay for shortcut control
@@ -110,6 +116,7 @@ ApplicationWindow {
     property int lastErrors: 0
     property real lastTimeElapsed: 0
     property bool lastLevelPassed: false
+    property var lastPreviousStats: ({})  // History stats for this mode/language/difficulty before the last game
     property bool isFirstTimeHardCompletion: false  // Tracks first-time hard completion for credits flow
 
     // Global SFX toggle shortcut (disabled during gameplay to avoid conflict)
@@ -124,6 +131,12 @@ ApplicationWindow {
         }
     }
 
+    // Performance overlay toggle (works everywhere, including gameplay)
+    Shortcut {
+        sequence: "Ctrl+Shift+P"
+        onActivated: PerfMonitor.enabled = !PerfMonitor.enabled
+    }
+
     ColumnLayout {
         anchors.fill: parent
         spacing: 0
@@ -211,6 +224,46 @@ ApplicationWindow {
         }
     }
 
+    // ========================================================================
+    // NAVIGATION
+    // ========================================================================
+    // Each page is on the stack at most once, so depth stays bounded over
+    // long sessions; gameplay pages are pooled and reused
+    PageNavigator {
+        id: navigator
+        stack: stackView
+        initialPage: mainMenuComponent
+    }
+
+    // Hidden parent for idle pooled pages
+    Item {
+        id: pagePoolHolder
+        visible: false
+    }
+
+    PagePool {
+        id: gameplayPool
+        component: gameplayComponent
+        holder: pagePoolHolder
+    }
+
+    PagePool {
+        id: racePool
+        component: raceGameplayComponent
+        holder: pagePoolHolder
+    }
+
+    // ========================================================================
+    // PERFORMANCE OVERLAY
+    // ========================================================================
+    PerfOverlay {
+        anchors.top: parent.top
+        anchors.right: parent.right
+        anchors.topMargin: 40
+        anchors.rightMargin: 8
+        z: 900
+    }
+
     // ========================================================================
     // SPLASH SCREEN OVERLAY
     // ========================================================================
@@ -220,6 +273,7 @@ ApplicationWindow {
         z: 1000  // Ensure splash is on top of everything
         visible: opacity > 0
         applicationReady: mainWindow.applicationReady
+        loadProgress: GameBackend.loadProgress
 
         onFinished: {
             splashScreen.destroy();
@@ -235,22 +289,25 @@ ApplicationWindow {
         Rectangle {
             color: Theme.bgPrimary
             focus: true
+            // Menus need word banks/history/progress, which load in the background
+            enabled: GameBackend.ready
 
             StackView.onActivating: forceActiveFocus()
             Component.onCompleted: forceActiveFocus()
+            onEnabledChanged: if (enabled) forceActiveFocus()
 
             Keys.onPressed: function (event) {
                 switch (event.key) {
                 case Qt.Key_1:
-                    stackView.push(languageMenuComponent);
+                    navigator.open(languageMenuComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_2:
-                    stackView.push(multiplayerMenuComponent);
+                    navigator.open(multiplayerMenuComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_3:
-                    stackView.push(historyComponent);
+                    navigator.open(historyComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_Q:
@@ -307,21 +364,21 @@ ApplicationWindow {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/play.svg"
                             labelText: "Start Game"
                             accentType: "green"
-                            onClicked: stackView.push(languageMenuComponent)
+                            onClicked: navigator.open(languageMenuComponent)
                         }
                         MenuItemC {
                             keyText: "[2]"
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/users.svg"
                             labelText: "Multiplayer"
                             accentType: "blue"
-                            onClicked: stackView.push(multiplayerMenuComponent)
+                            onClicked: navigator.open(multiplayerMenuComponent)
                         }
                         MenuItemC {
                             keyText: "[3]"
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/history.svg"
                             labelText: "Show History"
                             accentType: "yellow"
-                            onClicked: stackView.push(historyComponent)
+                            onClicked: navigator.open(historyComponent)
                         }
                         MenuItemC {
                             keyText: "(Q)"
@@ -356,13 +413,13 @@ ApplicationWindow {
             StackView.onActivating: forceActiveFocus()
 
             onCreateGameClicked: {
-                stackView.push(playerNameForHostComponent);
+                navigator.open(playerNameForHostComponent);
             }
             onJoinGameClicked: {
-                stackView.push(playerNameForJoinComponent);
+                navigator.open(playerNameForJoinComponent);
             }
             onBackClicked: {
-                stackView.push(mainMenuComponent);
+                navigator.open(mainMenuComponent);
             }
         }
     }
@@ -377,10 +434,10 @@ ApplicationWindow {
 
             onConfirmed: function (name) {
                 NetworkManager.createRoom();
-                stackView.push(lobbyComponent);
+                navigator.open(lobbyComponent);
             }
             onBackClicked: {
-                stackView.pop();
+                navigator.back();
             }
         }
     }
@@ -394,10 +451,10 @@ ApplicationWindow {
             StackView.onActivating: forceActiveFocus()
 
             onConfirmed: function (name) {
-                stackView.push(gameBrowserComponent);
+                navigator.open(gameBrowserComponent);
             }
             onBackClicked: {
-                stackView.pop();
+                navigator.back();
             }
         }
     }
@@ -413,10 +470,10 @@ ApplicationWindow {
                 NetworkManager.joinRoom(hostIp, port);
             }
             onJoinSuccess: {
-                stackView.push(lobbyComponent);
+                navigator.open(lobbyComponent);
             }
             onBackClicked: {
-                stackView.pop();
+                navigator.back();
             }
         }
     }
@@ -428,11 +485,16 @@ ApplicationWindow {
         LobbyPage {
             StackView.onActivating: forceActiveFocus()
 
+            // Pre-incubate the race page during the lobby wait
+            StackView.onActivated: racePool.prewarm()
+
             onStartGameClicked: {
-                stackView.push(raceGameplayComponent);
+                // A countdown can arrive while this lobby is still under the race results
+                navigator.open(lobbyComponent);
+                navigator.open(racePool);
             }
             onLeaveClicked: {
-                stackView.replace(null, multiplayerMenuComponent);
+                navigator.open(multiplayerMenuComponent);
             }
         }
     }
@@ -442,10 +504,13 @@ ApplicationWindow {
         id: raceGameplayComponent
 
         RaceGameplayPage {
+            id: raceGameplayPageInstance
+
             StackView.onActivating: forceActiveFocus()
+            StackView.onRemoved: racePool.release(raceGameplayPageInstance)
 
             onRaceCompleted: function (wpm, accuracy, errors) {
-                stackView.replace(raceResultsComponent, {
+                navigator.replaceTop(raceResultsComponent, {
                     "localWpm": wpm,
                     "localAccuracy": accuracy,
                     "localErrors": errors,
@@ -453,7 +518,7 @@ ApplicationWindow {
                 });
             }
             onExitClicked: {
-                stackView.replace(null, multiplayerMenuComponent);
+                navigator.open(multiplayerMenuComponent);
             }
         }
     }
@@ -467,16 +532,16 @@ ApplicationWindow {
 
             onPlayAgainClicked: {
                 // Legacy - kept for compatibility
-                stackView.replace(lobbyComponent);
+                navigator.open(lobbyComponent);
             }
 
             onReturnToLobbyClicked: {
                 // New handler: return to lobby (for both host play again and guest accept)
-                stackView.replace(lobbyComponent);
+                navigator.open(lobbyComponent);
             }
 
             onExitClicked: {
-                stackView.replace(null, multiplayerMenuComponent);
+                navigator.open(multiplayerMenuComponent);
             }
         }
     }
@@ -492,22 +557,24 @@ ApplicationWindow {
             focus: true
 
             StackView.onActivating: forceActiveFocus()
+            // Every single-player path passes here: pre-incubate the gameplay page
+            StackView.onActivated: gameplayPool.prewarm()
 
             Keys.onPressed: function (event) {
                 switch (event.key) {
                 case Qt.Key_1:
                     mainWindow.currentLanguage = "ID";
-                    stackView.push(durationMenuComponent);
+                    navigator.open(durationMenuComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_2:
                     mainWindow.currentLanguage = "EN";
-                    stackView.push(durationMenuComponent);
+                    navigator.open(durationMenuComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_Escape:
                     mainWindow.currentLanguage = "-";
-                    stackView.pop();
+                    navigator.back();
                     event.accepted = true;
                     break;
                 }
@@ -544,7 +611,7 @@ ApplicationWindow {
                             labelText: "Indonesia (ID)"
                             onClicked: {
                                 mainWindow.currentLanguage = "ID";
-                                stackView.push(durationMenuComponent);
+                                navigator.open(durationMenuComponent);
                             }
                         }
                         MenuItemC {
@@ -553,7 +620,7 @@ ApplicationWindow {
                             labelText: "English (EN)"
                             onClicked: {
                                 mainWindow.currentLanguage = "EN";
-                                stackView.push(durationMenuComponent);
+                                navigator.open(durationMenuComponent);
                             }
                         }
                     }
@@ -566,7 +633,7 @@ ApplicationWindow {
                             labelText: "Back (ESC)"
                             onClicked: {
                                 mainWindow.currentLanguage = "-";
-                                stackView.pop();
+                                navigator.back();
                             }
                         }
                     }
@@ -592,30 +659,30 @@ ApplicationWindow {
                 case Qt.Key_1:
                     mainWindow.currentTime = "15s";
                     GameBackend.defaultDuration = 15;
-                    stackView.push(modeMenuComponent);
+                    navigator.open(modeMenuComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_2:
                     mainWindow.currentTime = "30s";
                     GameBackend.defaultDuration = 30;
-                    stackView.push(modeMenuComponent);
+                    navigator.open(modeMenuComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_3:
                     mainWindow.currentTime = "60s";
                     GameBackend.defaultDuration = 60;
-                    stackView.push(modeMenuComponent);
+                    navigator.open(modeMenuComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_4:
                     mainWindow.currentTime = "Custom";
-                    stackView.push(customDurationComponent);
+                    navigator.open(customDurationComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_5:
                     mainWindow.currentTime = "∞";
                     GameBackend.defaultDuration = -1;
-                    stackView.push(modeMenuComponent);
+                    navigator.open(modeMenuComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_Return:
@@ -624,11 +691,11 @@ ApplicationWindow {
                         mainWindow.currentTime = GameBackend.defaultDuration === -1 ? "∞" : GameBackend.defaultDuration + "s";
                     }
                     // Else use whatever was last set
-                    stackView.push(modeMenuComponent);
+                    navigator.open(modeMenuComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_Escape:
-                    stackView.pop();
+                    navigator.back();
                     event.accepted = true;
                     break;
                 }
@@ -666,7 +733,7 @@ ApplicationWindow {
                             onClicked: {
                                 mainWindow.currentTime = "15s";
                                 GameBackend.defaultDuration = 15;
-                                stackView.push(modeMenuComponent);
+                                navigator.open(modeMenuComponent);
                             }
                         }
                         MenuItemC {
@@ -676,7 +743,7 @@ ApplicationWindow {
                             onClicked: {
                                 mainWindow.currentTime = "30s";
                                 GameBackend.defaultDuration = 30;
-                                stackView.push(modeMenuComponent);
+                                navigator.open(modeMenuComponent);
                             }
                         }
                         MenuItemC {
@@ -686,7 +753,7 @@ ApplicationWindow {
                             onClicked: {
                                 mainWindow.currentTime = "60s";
                                 GameBackend.defaultDuration = 60;
-                                stackView.push(modeMenuComponent);
+                                navigator.open(modeMenuComponent);
                             }
                         }
                         MenuItemC {
@@ -696,7 +763,7 @@ ApplicationWindow {
                             accentType: "yellow"
                             onClicked: {
                                 mainWindow.currentTime = "Custom";
-                                stackView.push(customDurationComponent);
+                                navigator.open(customDurationComponent);
                             }
                         }
                         MenuItemC {
@@ -706,7 +773,7 @@ ApplicationWindow {
                             onClicked: {
                                 mainWindow.currentTime = "∞";
                                 GameBackend.defaultDuration = -1;
-                                stackView.push(modeMenuComponent);
+                                navigator.open(modeMenuComponent);
                             }
                         }
                     }
@@ -727,7 +794,7 @@ ApplicationWindow {
                         NavBtn {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/arrow-left.svg"
                             labelText: "Back (ESC)"
-                            onClicked: stackView.pop()
+                            onClicked: navigator.back()
                         }
                     }
                 }
@@ -753,10 +820,10 @@ ApplicationWindow {
                     var seconds = parseInt(customDurInput.text) || 30;
                     mainWindow.currentTime = seconds + "s";
                     GameBackend.defaultDuration = seconds;
-                    stackView.push(modeMenuComponent);
+                    navigator.open(modeMenuComponent);
                     event.accepted = true;
                 } else if (event.key === Qt.Key_Escape) {
-                    stackView.pop();
+                    navigator.back();
                     event.accepted = true;
                 }
             }
@@ -854,7 +921,7 @@ ApplicationWindow {
                         NavBtn {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/arrow-left.svg"
                             labelText: "Back (ESC)"
-                            onClicked: stackView.pop()
+                            onClicked: navigator.back()
                         }
                         NavBtn {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/arrow-right.svg"
@@ -864,7 +931,7 @@ ApplicationWindow {
                                 var seconds = parseInt(customDurInput.text) || 30;
                                 mainWindow.currentTime = seconds + "s";
                                 GameBackend.defaultDuration = seconds;
-                                stackView.push(modeMenuComponent);
+                                navigator.open(modeMenuComponent);
                             }
                         }
                     }
@@ -889,17 +956,17 @@ ApplicationWindow {
                 switch (event.key) {
                 case Qt.Key_1:
                     mainWindow.currentMode = "Manual";
-                    stackView.push(manualSetupComponent);
+                    navigator.open(manualSetupComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_2:
                     mainWindow.currentMode = "Campaign";
-                    stackView.push(campaignMenuComponent);
+                    navigator.open(campaignMenuComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_Escape:
                     mainWindow.currentMode = "-";
-                    stackView.pop();
+                    navigator.back();
                     event.accepted = true;
                     break;
                 }
@@ -936,7 +1003,7 @@ ApplicationWindow {
                             labelText: "Manual Mode"
                             onClicked: {
                                 mainWindow.currentMode = "Manual";
-                                stackView.push(manualSetupComponent);
+                                navigator.open(manualSetupComponent);
                             }
                         }
                         MenuItemC {
@@ -945,7 +1012,7 @@ ApplicationWindow {
                             labelText: "Campaign Mode"
                             onClicked: {
                                 mainWindow.currentMode = "Campaign";
-                                stackView.push(campaignMenuComponent);
+                                navigator.open(campaignMenuComponent);
                             }
                         }
                     }
@@ -958,7 +1025,7 @@ ApplicationWindow {
                             labelText: "Back (ESC)"
                             onClicked: {
                                 mainWindow.currentMode = "-";
-                                stackView.pop();
+                                navigator.back();
                             }
                         }
                     }
@@ -988,10 +1055,10 @@ ApplicationWindow {
                     // Save WPM and difficulty to mainWindow before starting game
                     mainWindow.currentTargetWPM = parseInt(wpmInput.text) || 60;
                     mainWindow.currentDifficulty = "medium";  // Manual mode uses medium difficulty
-                    stackView.push(gameplayComponent);
+                    navigator.open(gameplayPool);
                     event.accepted = true;
                 } else if (event.key === Qt.Key_Escape) {
-                    stackView.pop();
+                    navigator.back();
                     event.accepted = true;
                 }
             }
@@ -1089,7 +1156,7 @@ ApplicationWindow {
                         NavBtn {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/arrow-left.svg"
                             labelText: "Back (ESC)"
-                            onClicked: stackView.pop()
+                            onClicked: navigator.back()
                         }
                         NavBtn {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/arrow-right.svg"
@@ -1099,7 +1166,7 @@ ApplicationWindow {
                                 // Save WPM and difficulty to mainWindow before starting game
                                 mainWindow.currentTargetWPM = parseInt(wpmInput.text) || 60;
                                 mainWindow.currentDifficulty = "medium";
-                                stackView.push(gameplayComponent);
+                                navigator.open(gameplayPool);
                             }
                         }
                     }
@@ -1118,21 +1185,55 @@ ApplicationWindow {
             id: gameplayPageInstance
 
             // Set isInGameplay when entering gameplay
-            StackView.onActivating: mainWindow.isInGameplay = true
+            StackView.onActivating: {
+                mainWindow.isInGameplay = true;
+                forceActiveFocus();
+            }
             StackView.onDeactivating: mainWindow.isInGameplay = false
 
             // Get text from word bank using GameBackend
             // Convert language and difficulty to lowercase for backend
-            // Initial text set via Component.onCompleted
-            Component.onCompleted: {
-                targetText = GameBackend.getRandomText(mainWindow.currentLanguage.toLowerCase(), mainWindow.currentDifficulty.toLowerCase(), 30  // Word count
-                );
+            // Streamed games start a word stream and take its first chunk;
+            // the page asks for the rest as the player types
+            function loadNewText() {
+                var language = mainWindow.currentLanguage.toLowerCase();
+                var difficulty = mainWindow.currentDifficulty.toLowerCase();
+                if (streamText) {
+                    GameBackend.startTextStream(language, difficulty, mainWindow.currentTextMode);
+                    targetText = GameBackend.nextTextChunk(30);  // Word count
+                } else {
+                    targetText = GameBackend.getRandomText(language, difficulty, 30, mainWindow.currentTextMode);  // Word count
+                }
+
+                // Ghost of the personal best in the same history bucket
+                // (Programmer Mode is recorded under the original language)
+                var historyLanguage = mainWindow.currentLanguage;
+                if (mainWindow.currentDifficulty === "programmer" && mainWindow.originalLanguage !== "") {
+                    historyLanguage = mainWindow.originalLanguage;
+                }
+                if (streamText)
+                    GameBackend.clearGhost();
+                else
+                    GameBackend.loadGhost(mainWindow.currentMode, historyLanguage, mainWindow.currentDifficulty);
+            }
+
+            // PagePool hooks: one instance is reused for every game, so text,
+            // ghost and session state are refreshed on each acquire
+            function activate() {
+                resetGame();
+                loadNewText();
+            }
+
+            function deactivate() {
+                resetGame();
             }
 
+            StackView.onRemoved: gameplayPool.release(gameplayPageInstance)
+
             timeLimit: mainWindow.currentDuration
             timeRemaining: mainWindow.currentDuration
 
-            onGameCompleted: function (wpm, accuracy, errors, timeElapsed) {
+            onGameCompleted: function (wpm, accuracy, errors, timeElapsed, replay, keyStats) {
                 // Store results for results page
                 mainWindow.lastWpm = wpm;
                 mainWindow.lastAccuracy = accuracy;
@@ -1145,8 +1246,11 @@ ApplicationWindow {
                     langForProgress = mainWindow.originalLanguage;
                 }
 
+                // Snapshot the bucket stats before saving so results can compare against them
+                mainWindow.lastPreviousStats = GameBackend.getHistoryStats(mainWindow.currentMode, langForProgress, mainWindow.currentDifficulty);
+
                 // Save to history via GameBackend
-                GameBackend.saveGameResult(wpm, accuracy, errors, mainWindow.currentTargetWPM, mainWindow.currentDifficulty, langForProgress, mainWindow.currentMode, timeElapsed);
+                GameBackend.saveGameResult(wpm, accuracy, errors, mainWindow.currentTargetWPM, mainWindow.currentDifficulty, langForProgress, mainWindow.currentMode, timeElapsed, replay, keyStats);
 
                 // Check if this is a first-time hard completion BEFORE calling completeLevel
                 // (completeLevel will mark it as completed, so we need to check first)
@@ -1179,14 +1283,13 @@ ApplicationWindow {
                     mainWindow.originalLanguage = "";
                 }
 
-                stackView.push(resultsComponent);
+                navigator.open(resultsComponent);
             }
 
             onResetClicked: {
                 // CRITICAL FIX: Fetch NEW random text on reset!
                 // This ensures pressing Tab generates different words
-                gameplayPageInstance.targetText = GameBackend.getRandomText(mainWindow.currentLanguage.toLowerCase(), mainWindow.currentDifficulty.toLowerCase(), 30  // Word count
-                );
+                gameplayPageInstance.loadNewText();
             }
 
             onExitClicked: {
@@ -1195,7 +1298,7 @@ ApplicationWindow {
                     mainWindow.currentLanguage = mainWindow.originalLanguage;
                     mainWindow.originalLanguage = "";
                 }
-                stackView.pop();
+                navigator.back();
             }
         }
     }
@@ -1223,14 +1326,14 @@ ApplicationWindow {
                 case Qt.Key_1:
                     mainWindow.currentDifficulty = "easy";
                     mainWindow.currentTargetWPM = 40;
-                    stackView.push(gameplayComponent);
+                    navigator.open(gameplayPool);
                     event.accepted = true;
                     break;
                 case Qt.Key_2:
                     if (GameBackend.isLevelUnlocked(mainWindow.currentLanguage, "medium")) {
                         mainWindow.currentDifficulty = "medium";
                         mainWindow.currentTargetWPM = 60;
-                        stackView.push(gameplayComponent);
+                        navigator.open(gameplayPool);
                     }
                     event.accepted = true;
                     break;
@@ -1238,7 +1341,7 @@ ApplicationWindow {
                     if (GameBackend.isLevelUnlocked(mainWindow.currentLanguage, "hard")) {
                         mainWindow.currentDifficulty = "hard";
                         mainWindow.currentTargetWPM = 70;
-                        stackView.push(gameplayComponent);
+                        navigator.open(gameplayPool);
                     }
                     event.accepted = true;
                     break;
@@ -1248,19 +1351,19 @@ ApplicationWindow {
                     mainWindow.currentLanguage = "prog";
                     mainWindow.currentDifficulty = "programmer";
                     mainWindow.currentTargetWPM = 50;
-                    stackView.push(gameplayComponent);
+                    navigator.open(gameplayPool);
                     event.accepted = true;
                     break;
                 case Qt.Key_C:
-                    stackView.push(creditsComponent);
+                    navigator.open(creditsComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_R:
-                    stackView.push(resetProgressComponent);
+                    navigator.open(resetProgressComponent);
                     event.accepted = true;
                     break;
                 case Qt.Key_Escape:
-                    stackView.pop();
+                    navigator.back();
                     event.accepted = true;
                     break;
                 }
@@ -1376,7 +1479,7 @@ ApplicationWindow {
                             onClicked: {
                                 mainWindow.currentDifficulty = "easy";
                                 mainWindow.currentTargetWPM = 40;
-                                stackView.push(gameplayComponent);
+                                navigator.open(gameplayPool);
                             }
                         }
                         MenuItemC {
@@ -1392,7 +1495,7 @@ ApplicationWindow {
                                 if (GameBackend.isLevelUnlocked(mainWindow.currentLanguage, "medium")) {
                                     mainWindow.currentDifficulty = "medium";
                                     mainWindow.currentTargetWPM = 60;
-                                    stackView.push(gameplayComponent);
+                                    navigator.open(gameplayPool);
                                 }
                             }
                         }
@@ -1409,7 +1512,7 @@ ApplicationWindow {
                                 if (GameBackend.isLevelUnlocked(mainWindow.currentLanguage, "hard")) {
                                     mainWindow.currentDifficulty = "hard";
                                     mainWindow.currentTargetWPM = 70;
-                                    stackView.push(gameplayComponent);
+                                    navigator.open(gameplayPool);
                                 }
                             }
                         }
@@ -1426,7 +1529,7 @@ ApplicationWindow {
                                 mainWindow.currentLanguage = "prog";
                                 mainWindow.currentDifficulty = "programmer";
                                 mainWindow.currentTargetWPM = 50;
-                                stackView.push(gameplayComponent);
+                                navigator.open(gameplayPool);
                             }
                         }
                     }
@@ -1438,18 +1541,18 @@ ApplicationWindow {
                         NavBtn {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/arrow-left.svg"
                             labelText: "Back (ESC)"
-                            onClicked: stackView.pop()
+                            onClicked: navigator.back()
                         }
                         NavBtn {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/users.svg"
                             labelText: "Credits (C)"
-                            onClicked: stackView.push(creditsComponent)
+                            onClicked: navigator.open(creditsComponent)
                         }
                         NavBtn {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/refresh.svg"
                             labelText: "Reset (R)"
                             variant: "danger"
-                            onClicked: stackView.push(resetProgressComponent)
+                            onClicked: navigator.open(resetProgressComponent)
                         }
                     }
                 }
@@ -1476,13 +1579,12 @@ ApplicationWindow {
                 if (mainWindow.isFirstTimeHardCompletion) {
                     // Replace results page with credits page (avoids double transition animation)
                     // Stack after: [...] -> CampaignMenu (depth-4) -> Gameplay (depth-3) -> Credits (depth-2)
-                    stackView.replace(creditsComponent);
+                    navigator.replaceTop(creditsComponent);
                 } else {
                     // Normal flow: pop back to setup page
                     // Stack: [...] -> Setup (depth-3) -> Gameplay (depth-2) -> Results (depth-1)
-                    // popToIndex pops down TO (but not including) the specified index
-                    // So popToIndex(depth-3) leaves us at the setup page
-                    stackView.popToIndex(stackView.depth - 3);
+                    // Unwinding two pages leaves us at the setup page
+                    navigator.unwind(2);
                 }
             }
 
@@ -1494,7 +1596,7 @@ ApplicationWindow {
                     event.accepted = true;
                     break;
                 case Qt.Key_H:
-                    stackView.push(historyComponent);
+                    navigator.open(historyComponent);
                     event.accepted = true;
                     break;
                 }
@@ -1609,6 +1711,26 @@ ApplicationWindow {
                         }
                     }
 
+                    // Comparison with previous games of the same mode/language/difficulty
+                    Text {
+                        Layout.fillWidth: true
+                        Layout.topMargin: Theme.spacingL
+                        visible: mainWindow.lastPreviousStats.count > 0
+                        text: {
+                            var s = mainWindow.lastPreviousStats;
+                            if (!(s.count > 0))
+                                return "";
+                            if (mainWindow.lastWpm > s.bestWpm)
+                                return "NEW PERSONAL BEST! (previous " + Math.round(s.bestWpm) + " WPM)";
+                            return "BEST " + Math.round(s.bestWpm) + "  ·  AVG " + Math.round(s.avgWpm) + "  ·  RECENT " + Math.round(s.recentWpm) + "  ·  P90 " + Math.round(s.p90Wpm) + " WPM";
+                        }
+                        color: mainWindow.lastWpm > mainWindow.lastPreviousStats.bestWpm ? Theme.accentGreen : Theme.textSecondary
+                        font.family: Theme.fontFamily
+                        font.pixelSize: Theme.fontSizeM
+                        font.bold: mainWindow.lastWpm > mainWindow.lastPreviousStats.bestWpm
+                        horizontalAlignment: Text.AlignHCenter
+                    }
+
                     // Pass/Fail message
                     Rectangle {
                         Layout.fillWidth: true
@@ -1711,7 +1833,7 @@ ApplicationWindow {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/history.svg"
                             labelText: "History (H)"
                             variant: "yellow"
-                            onClicked: stackView.push(historyComponent)
+                            onClicked: navigator.open(historyComponent)
                         }
                     }
                 }
@@ -1730,10 +1852,12 @@ ApplicationWindow {
             color: Theme.bgPrimary
             focus: true
 
-            // History data from backend
-            property var historyData: []
+            // History rows come from the backend list model; the view only
+            // creates delegates for visible rows and fetches more on scroll
+            readonly property var historyModel: GameBackend.historyModel
+            readonly property int pageSize: 10
             property int currentPage: 1
-            property int totalPages: 1
+            property int totalPages: Math.ceil(historyModel.totalCount / pageSize)
             property int totalEntries: 0
 
             // Sort settings (persisted via GameBackend)
@@ -1754,6 +1878,9 @@ ApplicationWindow {
             property bool showDetailOverlay: false
             property var selectedRecord: null
 
+            // Weak keys heatmap state
+            property bool showKeyHeatmap: false
+
             // Close all dropdowns
             function closeAllDropdowns() {
                 showModeDropdown = false;
@@ -1763,9 +1890,19 @@ ApplicationWindow {
 
             // Load history data from backend with sorting and filtering
             function loadHistory() {
-                historyData = GameBackend.getHistoryPageSorted(currentPage, 10, sortBy, sortAscending, modeFilter, languageFilter, difficultyFilter);
-                totalPages = GameBackend.getHistoryTotalPages(10);
+                historyModel.setQuery(sortBy, sortAscending, modeFilter, languageFilter, difficultyFilter);
                 totalEntries = GameBackend.getHistoryTotalEntries();
+                currentPage = 1;
+                historyListView.positionViewAtBeginning();
+            }
+
+            // Scroll the list so the given page (pageSize rows) is at the top
+            function goToPage(page) {
+                if (page < 1 || page > totalPages)
+                    return;
+                historyModel.ensureLoaded(page * pageSize);
+                historyListView.positionViewAtIndex((page - 1) * pageSize, ListView.Beginning);
+                currentPage = page;
             }
 
             // Toggle sort on column click
@@ -1782,7 +1919,6 @@ ApplicationWindow {
                     sortAscending = false;
                     GameBackend.historySortAscending = false;
                 }
-                currentPage = 1; // Reset to first page
                 loadHistory();
             }
 
@@ -1790,7 +1926,6 @@ ApplicationWindow {
             function setModeFilter(mode) {
                 modeFilter = mode;
                 closeAllDropdowns();
-                currentPage = 1; // Reset to first page
                 loadHistory();
             }
 
@@ -1798,7 +1933,6 @@ ApplicationWindow {
             function setLanguageFilter(lang) {
                 languageFilter = lang;
                 closeAllDropdowns();
-                currentPage = 1;
                 loadHistory();
             }
 
@@ -1806,7 +1940,6 @@ ApplicationWindow {
             function setDifficultyFilter(diff) {
                 difficultyFilter = diff;
                 closeAllDropdowns();
-                currentPage = 1;
                 loadHistory();
             }
 
@@ -1829,28 +1962,28 @@ ApplicationWindow {
                     }
                     return;
                 }
+                if (showKeyHeatmap)
+                    return;
 
                 switch (event.key) {
                 case Qt.Key_Escape:
-                    stackView.pop();
+                    navigator.back();
                     event.accepted = true;
                     break;
                 case Qt.Key_C:
-                    stackView.push(resetHistoryComponent);
+                    navigator.open(resetHistoryComponent);
+                    event.accepted = true;
+                    break;
+                case Qt.Key_K:
+                    showKeyHeatmap = true;
                     event.accepted = true;
                     break;
                 case Qt.Key_1:  // Previous page (per original TUI)
-                    if (currentPage > 1) {
-                        currentPage--;
-                        loadHistory();
-                    }
+                    goToPage(currentPage - 1);
                     event.accepted = true;
                     break;
                 case Qt.Key_2:  // Next page (per original TUI)
-                    if (currentPage < totalPages) {
-                        currentPage++;
-                        loadHistory();
-                    }
+                    goToPage(currentPage + 1);
                     event.accepted = true;
                     break;
                 }
@@ -2335,13 +2468,20 @@ ApplicationWindow {
                             width: parent.width
                             height: parent.height - 40
                             clip: true
-                            model: historyData
+                            model: historyModel
+
+                            // Track the page of the topmost visible row
+                            onContentYChanged: {
+                                var topIndex = indexAt(0, contentY + 1);
+                                if (topIndex >= 0)
+                                    currentPage = Math.floor(topIndex / pageSize) + 1;
+                            }
 
                             // Empty state when no history
                             Rectangle {
                                 anchors.fill: parent
                                 color: "transparent"
-                                visible: historyData.length === 0
+                                visible: historyListView.count === 0
 
                                 Column {
                                     anchors.centerIn: parent
@@ -2399,7 +2539,7 @@ ApplicationWindow {
                                 Rectangle {
                                     width: 2
                                     height: parent.height
-                                    color: modelData.wpm >= modelData.targetWPM ? Theme.accentGreen : Theme.accentRed
+                                    color: model.wpm >= model.targetWPM ? Theme.accentGreen : Theme.accentRed
                                 }
 
                                 RowLayout {
@@ -2411,8 +2551,8 @@ ApplicationWindow {
                                     Text {
                                         Layout.fillWidth: true
                                         Layout.preferredWidth: 60
-                                        text: Math.round(modelData.wpm)
-                                        color: modelData.wpm >= modelData.targetWPM ? Theme.accentGreen : Theme.accentRed
+                                        text: Math.round(model.wpm)
+                                        color: model.wpm >= model.targetWPM ? Theme.accentGreen : Theme.accentRed
                                         font.family: Theme.fontFamily
                                         font.pixelSize: Theme.fontSizeM
                                         font.bold: true
@@ -2421,7 +2561,7 @@ ApplicationWindow {
                                     Text {
                                         Layout.fillWidth: true
                                         Layout.preferredWidth: 80
-                                        text: modelData.accuracy.toFixed(1) + "%"
+                                        text: model.accuracy.toFixed(1) + "%"
                                         color: Theme.textPrimary
                                         font.family: Theme.fontFamily
                                         font.pixelSize: Theme.fontSizeM
@@ -2430,7 +2570,7 @@ ApplicationWindow {
                                     Text {
                                         Layout.fillWidth: true
                                         Layout.preferredWidth: 60
-                                        text: modelData.timeElapsed.toFixed(1) + "s"
+                                        text: model.timeElapsed.toFixed(1) + "s"
                                         color: Theme.textPrimary
                                         font.family: Theme.fontFamily
                                         font.pixelSize: Theme.fontSizeM
@@ -2439,7 +2579,7 @@ ApplicationWindow {
                                     Text {
                                         Layout.fillWidth: true
                                         Layout.preferredWidth: 70
-                                        text: modelData.targetWPM
+                                        text: model.targetWPM
                                         color: Theme.textPrimary
                                         font.family: Theme.fontFamily
                                         font.pixelSize: Theme.fontSizeM
@@ -2448,7 +2588,7 @@ ApplicationWindow {
                                     Text {
                                         Layout.fillWidth: true
                                         Layout.preferredWidth: 60
-                                        text: modelData.errors
+                                        text: model.errors
                                         color: Theme.textPrimary
                                         font.family: Theme.fontFamily
                                         font.pixelSize: Theme.fontSizeM
@@ -2457,7 +2597,7 @@ ApplicationWindow {
                                     Text {
                                         Layout.fillWidth: true
                                         Layout.preferredWidth: 80
-                                        text: modelData.difficulty
+                                        text: model.difficulty
                                         color: Theme.textPrimary
                                         font.family: Theme.fontFamily
                                         font.pixelSize: Theme.fontSizeM
@@ -2466,7 +2606,7 @@ ApplicationWindow {
                                     Text {
                                         Layout.fillWidth: true
                                         Layout.preferredWidth: 50
-                                        text: modelData.language
+                                        text: model.language
                                         color: Theme.textPrimary
                                         font.family: Theme.fontFamily
                                         font.pixelSize: Theme.fontSizeM
@@ -2475,7 +2615,7 @@ ApplicationWindow {
                                     Text {
                                         Layout.fillWidth: true
                                         Layout.preferredWidth: 80
-                                        text: modelData.mode
+                                        text: model.mode
                                         color: Theme.textPrimary
                                         font.family: Theme.fontFamily
                                         font.pixelSize: Theme.fontSizeM
@@ -2484,7 +2624,7 @@ ApplicationWindow {
                                     Text {
                                         Layout.fillWidth: true
                                         Layout.preferredWidth: 130
-                                        text: modelData.timestamp
+                                        text: model.timestamp
                                         color: Theme.textPrimary
                                         font.family: Theme.fontFamily
                                         font.pixelSize: Theme.fontSizeM
@@ -2498,7 +2638,7 @@ ApplicationWindow {
                                     hoverEnabled: true
                                     cursorShape: Qt.PointingHandCursor
                                     onClicked: {
-                                        selectedRecord = modelData;
+                                        selectedRecord = historyModel.get(index);
                                         showDetailOverlay = true;
                                     }
                                 }
@@ -2519,24 +2659,14 @@ ApplicationWindow {
                         labelText: "Previous [1]"
                         enabled: currentPage > 1
                         opacity: enabled ? 1.0 : 0.4
-                        onClicked: {
-                            if (currentPage > 1) {
-                                currentPage--;
-                                loadHistory();
-                            }
-                        }
+                        onClicked: goToPage(currentPage - 1)
                     }
                     NavBtn {
                         iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/arrow-right.svg"
                         labelText: "Next [2]"
                         enabled: currentPage < totalPages
                         opacity: enabled ? 1.0 : 0.4
-                        onClicked: {
-                            if (currentPage < totalPages) {
-                                currentPage++;
-                                loadHistory();
-                            }
-                        }
+                        onClicked: goToPage(currentPage + 1)
                     }
                 }
 
@@ -2547,13 +2677,18 @@ ApplicationWindow {
                     NavBtn {
                         iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/arrow-left.svg"
                         labelText: "Back (ESC)"
-                        onClicked: stackView.pop()
+                        onClicked: navigator.back()
+                    }
+                    NavBtn {
+                        iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/fire.svg"
+                        labelText: "Weak Keys (K)"
+                        onClicked: showKeyHeatmap = true
                     }
                     NavBtn {
                         iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/trash.svg"
                         labelText: "Clear History (C)"
                         variant: "danger"
-                        onClicked: stackView.push(resetHistoryComponent)
+                        onClicked: navigator.open(resetHistoryComponent)
                     }
                 }
             }
@@ -2880,6 +3015,18 @@ ApplicationWindow {
                     historyPageRoot.forceActiveFocus();
                 }
             }
+
+            // Weak keys heatmap, following the page's language filter
+            KeyHeatmap {
+                showOverlay: showKeyHeatmap
+                language: languageFilter
+                practiceEnabled: mainWindow.currentTextMode === "weak"
+                onPracticeToggled: mainWindow.currentTextMode = practiceEnabled ? "words" : "weak"
+                onClose: {
+                    showKeyHeatmap = false;
+                    historyPageRoot.forceActiveFocus();
+                }
+            }
         }
     }
 
@@ -2899,12 +3046,12 @@ ApplicationWindow {
                     // First-time hard completion flow: Credits replaced Results
                     // Stack: [...] -> CampaignMenu (depth-3) -> Gameplay (depth-2) -> Credits (depth-1)
                     // Pop back to Campaign Menu
-                    stackView.popToIndex(stackView.depth - 3);
+                    navigator.unwind(2);
                     // Reset the flag
                     mainWindow.isFirstTimeHardCompletion = false;
                 } else {
                     // Normal flow: just pop back to previous page
-                    stackView.pop();
+                    navigator.back();
                 }
             }
 
@@ -3038,7 +3185,7 @@ ApplicationWindow {
                 interval: 1000
                 repeat: false
                 onTriggered: {
-                    stackView.pop();
+                    navigator.back();
                 }
             }
 
@@ -3062,7 +3209,7 @@ ApplicationWindow {
                     event.accepted = true;
                     break;
                 case Qt.Key_Escape:
-                    stackView.pop();
+                    navigator.back();
                     event.accepted = true;
                     break;
                 }
@@ -3169,7 +3316,7 @@ ApplicationWindow {
                         NavBtn {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/arrow-left.svg"
                             labelText: "Cancel (ESC)"
-                            onClicked: stackView.pop()
+                            onClicked: navigator.back()
                         }
                         NavBtn {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/trash.svg"
@@ -3344,7 +3491,7 @@ ApplicationWindow {
                 interval: 1000
                 repeat: false
                 onTriggered: {
-                    stackView.pop();
+                    navigator.back();
                 }
             }
 
@@ -3368,7 +3515,7 @@ ApplicationWindow {
                     event.accepted = true;
                     break;
                 case Qt.Key_Escape:
-                    stackView.pop();
+                    navigator.back();
                     event.accepted = true;
                     break;
                 }
@@ -3482,7 +3629,7 @@ ApplicationWindow {
                         NavBtn {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/arrow-left.svg"
                             labelText: "Cancel (ESC)"
-                            onClicked: stackView.pop()
+                            onClicked: navigator.back()
                         }
                         NavBtn {
                             iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/refresh.svg"
@@ -0,0 +1,743 @@
+/**
+ * @file rapidtexter_bench.cpp
+ * @brief Microbenchmarks for the game-logic hot paths.
+ * @author RapidTexter Team
+ * @date 2026
+ *
+ * Covers word sampling (TextProvider::getWords, random and Markov modes),
+ * history journal load/save
+ * and sorted paging (HistoryManager, GameBackend::queryHistoryPage), and
+ * NetworkManager::Packet encode/decode for every PacketType in both wire
+ * formats. Inputs are synthetic and generated from fixed seeds into a
+ * temporary directory, so user data is never touched and runs compare.
+ *
+ * packetRoundTrip is a plain (unbenchmarked) check that every field of the
+ * binary wire format survives encode -> decode, including the clamping and
+ * varint edge cases. starHostMigration races three NetworkManagers on
+ * loopback and checks that room indices still resolve after the star host
+ * leaves.
+ *
+ * Built only with -DRAPIDTEXTER_BUILD_BENCH=ON. Results are standard QtTest
+ * output, so any QtTest logger works, e.g.:
+ * @code
+ * rapidtexter_bench -o results.xml,xml -o -,txt
+ * rapidtexter_bench getWords -o results.csv,csv
+ * @endcode
+ */
+
+#include <QMetaEnum>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QtGlobal>
+
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "GameBackend.h"
+#include "HistoryManager.h"
+#include "NetworkManager.h"
+#include "PersistenceService.h"
+#include "TextProvider.h"
+
+using PacketType = NetworkManager::PacketType;
+using Packet = NetworkManager::Packet;
+
+class RapidTexterBench : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    // TextProvider
+    void getWords_data();
+    void getWords();
+    void getWordsMarkov_data();
+    void getWordsMarkov();
+
+    // HistoryManager / GameBackend
+    void historyLoad_data();
+    void historyLoad();
+    void historySave_data();
+    void historySave();
+    void historyPageSorted_data();
+    void historyPageSorted();
+
+    // NetworkManager::Packet
+    void packetEncode_data();
+    void packetEncode();
+    void packetDecode_data();
+    void packetDecode();
+    void packetRoundTrip_data();
+    void packetRoundTrip();
+
+    // NetworkManager on loopback
+    void starHostMigration();
+
+private:
+    static constexpr int BANK_SIZES[] = { 1000, 10000, 100000 };
+    static constexpr int WORD_COUNTS[] = { 10, 100, 1000 };
+    static constexpr int HISTORY_SIZES[] = { 1000, 10000, 100000 };
+    static constexpr int CORPUS_SENTENCES[] = { 1000, 10000 };
+    static constexpr int NETWORK_TIMEOUT_MS = 15000;  // Covers the 3 s countdown and reconnects
+
+    QTemporaryDir m_dir;
+    std::map<int, std::unique_ptr<TextProvider>> m_providers;  // Bank size -> provider
+    std::map<int, std::unique_ptr<TextProvider>> m_corpora;     // Sentence count -> provider
+    std::map<int, QString> m_journals;                          // Entry count -> journal path
+
+    QString writeWordBank(int size);
+    QString writeCorpus(int sentences);
+    void writeJournal(int entries);
+    static Packet samplePacket(PacketType type);
+    static void addPacketRows();
+};
+
+// ============================================================================
+// FIXTURES
+// ============================================================================
+
+void RapidTexterBench::initTestCase() {
+    QVERIFY(m_dir.isValid());
+
+    for (int size : BANK_SIZES) {
+        auto provider = std::make_unique<TextProvider>();
+        QVERIFY(provider->loadWords("bench", writeWordBank(size).toStdString()));
+        m_providers[size] = std::move(provider);
+    }
+    for (int sentences : CORPUS_SENTENCES) {
+        auto provider = std::make_unique<TextProvider>();
+        QVERIFY(provider->loadCorpus("bench", writeCorpus(sentences).toStdString()));
+        m_corpora[sentences] = std::move(provider);
+    }
+    for (int entries : HISTORY_SIZES) {
+        writeJournal(entries);
+        if (QTest::currentTestFailed()) return;
+    }
+}
+
+QString RapidTexterBench::writeWordBank(int size) {
+    // Lowercase words of 2-14 letters: every Difficulty bucket gets words
+    std::mt19937 rng(size);
+    std::uniform_int_distribution<int> length(2, 14);
+    std::uniform_int_distribution<int> letter('a', 'z');
+
+    const QString path = m_dir.filePath(QString("words_%1.txt").arg(size));
+    std::ofstream out(path.toStdString());
+    for (int i = 0; i < size; ++i) {
+        std::string word(static_cast<size_t>(length(rng)), 'a');
+        for (char& c : word) c = static_cast<char>(letter(rng));
+        out << word << '\n';
+    }
+    return path;
+}
+
+QString RapidTexterBench::writeCorpus(int sentences) {
+    // Sentences of 4-16 words over a 2000-word vocabulary, skewed towards
+    // low ids the way natural text repeats its common words
+    std::mt19937 rng(sentences);
+    std::uniform_int_distribution<int> length(2, 14);
+    std::uniform_int_distribution<int> letter('a', 'z');
+    std::vector<std::string> vocabulary(2000);
+    for (std::string& word : vocabulary) {
+        word.assign(static_cast<size_t>(length(rng)), 'a');
+        for (char& c : word) c = static_cast<char>(letter(rng));
+    }
+
+    std::uniform_int_distribution<int> words(4, 16);
+    std::geometric_distribution<int> rank(0.01);
+    const QString path = m_dir.filePath(QString("corpus_%1.txt").arg(sentences));
+    std::ofstream out(path.toStdString());
+    for (int i = 0; i < sentences; ++i) {
+        const int n = words(rng);
+        for (int w = 0; w < n; ++w) {
+            out << vocabulary[static_cast<size_t>(rank(rng)) % vocabulary.size()]
+                << (w + 1 < n ? ' ' : '.');
+        }
+        out << '\n';
+    }
+    return path;
+}
+
+void RapidTexterBench::writeJournal(int entries) {
+    static const char* modes[] = { "Manual", "Campaign" };
+    static const char* languages[] = { "ID", "EN", "PROG" };
+    static const char* difficulties[] = { "Easy", "Medium", "Hard", "Programmer" };
+
+    std::mt19937 rng(entries);
+    std::uniform_real_distribution<double> wpm(20.0, 140.0);
+    std::uniform_real_distribution<double> accuracy(70.0, 100.0);
+    std::uniform_int_distribution<int> pick(0, 11);
+
+    const QString path = m_dir.filePath(QString("history_%1.journal").arg(entries));
+    HistoryManager history(path.toStdString(), false);
+    for (int i = 0; i < entries; ++i) {
+        const int p = pick(rng);
+        HistoryEntry entry;
+        entry.wpm = wpm(rng);
+        entry.accuracy = accuracy(rng);
+        entry.targetWPM = 40;
+        entry.errors = p;
+        entry.mode = modes[p % 2];
+        entry.language = languages[p % 3];
+        entry.difficulty = difficulties[p % 4];
+        entry.timeElapsed = 15.0 + p * 5;
+        entry.epoch = 1700000000 + i * 60;
+        history.saveEntry(entry);
+    }
+    m_journals[entries] = path;
+
+    // saveEntry() appends on PersistenceService's worker thread: the fixture
+    // must be complete on disk before any benchmark opens it
+    QVERIFY(PersistenceService::instance().flush());
+}
+
+// ============================================================================
+// TEXTPROVIDER
+// ============================================================================
+
+void RapidTexterBench::getWords_data() {
+    QTest::addColumn<int>("bankSize");
+    QTest::addColumn<int>("count");
+    QTest::addColumn<int>("difficulty");
+
+    static const char* names[] = { "easy", "medium", "hard", "programmer" };
+    for (int size : BANK_SIZES) {
+        for (int count : WORD_COUNTS) {
+            for (int d = 0; d < 4; ++d) {
+                QTest::addRow("bank=%d count=%d %s", size, count, names[d]) << size << count << d;
+            }
+        }
+    }
+}
+
+void RapidTexterBench::getWords() {
+    QFETCH(int, bankSize);
+    QFETCH(int, count);
+    QFETCH(int, difficulty);
+
+    TextProvider& provider = *m_providers.at(bankSize);
+    size_t sink = 0;
+    QBENCHMARK {
+        sink += provider.getWords("bench", static_cast<Difficulty>(difficulty), count).size();
+    }
+    QVERIFY(sink > 0);
+}
+
+void RapidTexterBench::getWordsMarkov_data() {
+    QTest::addColumn<int>("sentences");
+    QTest::addColumn<int>("count");
+    QTest::addColumn<int>("difficulty");
+
+    static const char* names[] = { "easy", "medium", "hard", "programmer" };
+    for (int sentences : CORPUS_SENTENCES) {
+        for (int count : WORD_COUNTS) {
+            for (int d = 0; d < 4; ++d) {
+                QTest::addRow("corpus=%d count=%d %s", sentences, count, names[d])
+                    << sentences << count << d;
+            }
+        }
+    }
+}
+
+void RapidTexterBench::getWordsMarkov() {
+    QFETCH(int, sentences);
+    QFETCH(int, count);
+    QFETCH(int, difficulty);
+
+    TextProvider& provider = *m_corpora.at(sentences);
+    size_t sink = 0;
+    QBENCHMARK {
+        sink += provider.getWords("bench", static_cast<Difficulty>(difficulty), count,
+                                  TextMode::MARKOV).size();
+    }
+    QVERIFY(sink > 0);
+}
+
+// ============================================================================
+// HISTORY
+// ============================================================================
+
+void RapidTexterBench::historyLoad_data() {
+    QTest::addColumn<int>("entries");
+    for (int entries : HISTORY_SIZES) {
+        QTest::addRow("entries=%d", entries) << entries;
+    }
+}
+
+void RapidTexterBench::historyLoad() {
+    QFETCH(int, entries);
+
+    HistoryManager history(m_journals.at(entries).toStdString(), false);
+    QBENCHMARK {
+        history.loadHistory();
+    }
+    QCOMPARE(history.getTotalEntries(), entries);
+}
+
+void RapidTexterBench::historySave_data() {
+    historyLoad_data();
+}
+
+void RapidTexterBench::historySave() {
+    QFETCH(int, entries);
+
+    // Save rewrites its own journal: work on a copy of the fixture
+    const QString path = m_dir.filePath(QString("save_%1.journal").arg(entries));
+    QFile::remove(path);
+    QVERIFY(QFile::copy(m_journals.at(entries), path));
+
+    HistoryManager history(path.toStdString(), true);
+    QCOMPARE(history.getTotalEntries(), entries);
+    // saveHistory() only snapshots; flush() includes the actual write
+    QBENCHMARK {
+        QVERIFY(history.saveHistory());
+        QVERIFY(PersistenceService::instance().flush());
+    }
+}
+
+void RapidTexterBench::historyPageSorted_data() {
+    QTest::addColumn<int>("entries");
+    QTest::addColumn<QString>("sortBy");
+    QTest::addColumn<QString>("mode");
+    QTest::addColumn<int>("page");
+
+    for (int entries : HISTORY_SIZES) {
+        for (const char* sortBy : { "date", "wpm", "accuracy", "time" }) {
+            QTest::addRow("entries=%d %s all first", entries, sortBy)
+                << entries << QString(sortBy) << QString("All") << 1;
+            QTest::addRow("entries=%d %s campaign deep", entries, sortBy)
+                << entries << QString(sortBy) << QString("Campaign") << entries / 50;
+        }
+    }
+}
+
+void RapidTexterBench::historyPageSorted() {
+    QFETCH(int, entries);
+    QFETCH(QString, sortBy);
+    QFETCH(QString, mode);
+    QFETCH(int, page);
+
+    HistoryManager history(m_journals.at(entries).toStdString(), true);
+    QVariantList result;
+    QBENCHMARK {
+        result = GameBackend::queryHistoryPage(history, page, 10, sortBy, false,
+                                               mode, "All", "All");
+    }
+    QVERIFY(!result.isEmpty());
+}
+
+// ============================================================================
+// PACKETS
+// ============================================================================
+
+Packet RapidTexterBench::samplePacket(PacketType type) {
+    Packet packet;
+    packet.type = type;
+    packet.senderUuid = "6f0b2c1e-8d4a-4e3b-9a57-2c1d0e9f8a7b";
+    packet.timestamp = 1760000000000;
+
+    QJsonObject& payload = packet.payload;
+    switch (type) {
+        case PacketType::HELLO:
+            payload["name"] = "Player";
+            payload["isHost"] = false;
+            payload["index"] = 3;
+            payload["wire"] = NetworkManager::WIRE_VERSION;
+            payload["udpPort"] = 50123;
+            break;
+        case PacketType::PEER_LIST: {
+            QJsonArray peers;
+            for (int i = 0; i < 8; ++i) {
+                QJsonObject peer;
+                peer["uuid"] = QString("peer-%1").arg(i);
+                peer["name"] = QString("Player %1").arg(i);
+                peer["ip"] = QString("192.168.1.%1").arg(10 + i);
+                peer["port"] = 52765;
+                peer["index"] = i;
+                peers.append(peer);
+            }
+            payload["peers"] = peers;
+            break;
+        }
+        case PacketType::PROGRESS_UPDATE:
+            payload["position"] = 123;
+            payload["wpm"] = 87;
+            payload["finished"] = false;
+            break;
+        case PacketType::FINISH:
+            payload["wpm"] = 92;
+            payload["accuracy"] = 97.5;
+            payload["errors"] = 4;
+            payload["duration"] = 42;
+            payload["position"] = 2;
+            payload["finishAt"] = 1760000042000;
+            break;
+        case PacketType::GAME_TEXT:
+            payload["text"] = QString("the quick brown fox jumps over the lazy dog ").repeated(20);
+            payload["language"] = "en";
+            break;
+        case PacketType::READY_CHECK:
+            // Seeded form, as sent to peers with a matching word bank
+            payload["language"] = "en";
+            payload["seed"] = "9e3779b97f4a7c15";
+            payload["difficulty"] = "medium";
+            payload["wordCount"] = 20;
+            payload["bankHash"] = "f7ecc3fd5a4f6e9b";
+            break;
+        case PacketType::COUNTDOWN:
+            payload["seconds"] = 3;
+            payload["startAt"] = 1760000003000;
+            break;
+        case PacketType::PLAYER_LEFT:
+        case PacketType::KICK:
+            payload["uuid"] = "peer-3";
+            payload["name"] = "Player 3";
+            payload["reason"] = "You have been kicked by the host";
+            break;
+        case PacketType::RACE_RESULTS: {
+            QJsonArray rankings;
+            for (int i = 0; i < 8; ++i) {
+                QJsonObject r;
+                r["id"] = QString("peer-%1").arg(i);
+                r["name"] = QString("Player %1").arg(i);
+                r["wpm"] = 60 + i;
+                r["accuracy"] = 95.0;
+                r["position"] = i + 1;
+                rankings.append(r);
+            }
+            payload["rankings"] = rankings;
+            break;
+        }
+        case PacketType::READY_RESPONSE:
+            payload["ready"] = true;
+            payload["rttUs"] = 850;
+            payload["offsetUs"] = -120;
+            break;
+        case PacketType::PLAY_AGAIN_RESPONSE:
+            payload["accepted"] = true;
+            break;
+        case PacketType::STATE_SNAPSHOT: {
+            QJsonArray players;
+            for (int i = 0; i < 32; ++i) {
+                QJsonObject obj;
+                obj["index"] = i;
+                obj["position"] = 10 * i;
+                obj["total"] = 400;
+                obj["wpm"] = 50 + i;
+                obj["finished"] = false;
+                obj["rank"] = 0;
+                players.append(obj);
+            }
+            payload["players"] = players;
+            break;
+        }
+        case PacketType::TIME_PING:
+            payload["t0"] = 1760000000000123;
+            break;
+        case PacketType::TIME_PONG:
+            payload["t0"] = 1760000000000123;
+            payload["t1"] = 1760000000000456;
+            payload["t2"] = 1760000000000460;
+            break;
+        case PacketType::GAME_START:
+        case PacketType::PLAY_AGAIN_INVITE:
+        case PacketType::TEXT_REQUEST:
+            break;
+    }
+    return packet;
+}
+
+void RapidTexterBench::addPacketRows() {
+    QTest::addColumn<int>("type");
+    QTest::addColumn<bool>("binary");
+
+    const QMetaEnum types = QMetaEnum::fromType<PacketType>();
+    for (int i = 0; i < types.keyCount(); ++i) {
+        const int type = types.value(i);
+        QTest::addRow("%s json", types.key(i)) << type << false;
+        // HELLO is always JSON: it negotiates the binary format
+        if (static_cast<PacketType>(type) != PacketType::HELLO) {
+            QTest::addRow("%s binary", types.key(i)) << type << true;
+        }
+    }
+}
+
+namespace {
+
+QJsonObject progressPayload(int position, int total, int wpm, bool finished) {
+    QJsonObject payload;
+    payload["position"] = position;
+    if (total != 0) payload["total"] = total;
+    payload["wpm"] = wpm;
+    payload["finished"] = finished;
+    return payload;
+}
+
+QJsonObject snapshotEntry(int index, int position, int total, int wpm, bool finished, int rank) {
+    QJsonObject obj;
+    obj["index"] = index;
+    obj["position"] = position;
+    obj["total"] = total;
+    obj["wpm"] = wpm;
+    obj["finished"] = finished;
+    obj["rank"] = rank;
+    return obj;
+}
+
+// Compared as text, so an integer and an equal double (e.g. 95 read back
+// from JSON for 95.0) count as the same value
+QByteArray canonical(const QJsonObject& payload) {
+    return QJsonDocument(payload).toJson(QJsonDocument::Compact);
+}
+
+} // namespace
+
+void RapidTexterBench::packetEncode_data() {
+    addPacketRows();
+}
+
+void RapidTexterBench::packetEncode() {
+    QFETCH(int, type);
+    QFETCH(bool, binary);
+
+    const Packet packet = samplePacket(static_cast<PacketType>(type));
+    QByteArray frame;
+    QBENCHMARK {
+        frame = binary ? packet.serializeBinary(2) : packet.serialize();
+    }
+    QVERIFY(!frame.isEmpty());
+}
+
+void RapidTexterBench::packetDecode_data() {
+    addPacketRows();
+}
+
+void RapidTexterBench::packetDecode() {
+    QFETCH(int, type);
+    QFETCH(bool, binary);
+
+    // deserialize() takes the body without the length prefix
+    const Packet packet = samplePacket(static_cast<PacketType>(type));
+    const QByteArray body = binary ? packet.binaryBody(2) : packet.jsonBody();
+    Packet decoded;
+    QBENCHMARK {
+        decoded = Packet::deserialize(body);
+    }
+    QVERIFY(decoded.valid);
+    QCOMPARE(static_cast<int>(decoded.type), type);
+    QCOMPARE(decoded.timestamp, packet.timestamp);
+    if (binary) {
+        QCOMPARE(decoded.senderIndex, quint8(2));
+    } else {
+        QCOMPARE(decoded.senderUuid, packet.senderUuid);
+        QCOMPARE(canonical(decoded.payload), canonical(packet.payload));
+    }
+}
+
+void RapidTexterBench::packetRoundTrip_data() {
+    QTest::addColumn<int>("type");
+    QTest::addColumn<int>("index");
+    QTest::addColumn<qint64>("timestamp");
+    QTest::addColumn<QJsonObject>("payload");
+    QTest::addColumn<qint64>("expectedTimestamp");
+    QTest::addColumn<QJsonObject>("expected");
+
+    const int progress = static_cast<int>(PacketType::PROGRESS_UPDATE);
+    const int finish = static_cast<int>(PacketType::FINISH);
+    const int snapshot = static_cast<int>(PacketType::STATE_SNAPSHOT);
+    const qint64 ts = 1760000000000;
+
+    // PROGRESS_UPDATE: every field, clampU16 edges, total == 0 = unchanged
+    QTest::newRow("progress")
+        << progress << 2 << ts << progressPayload(123, 400, 87, false)
+        << ts << progressPayload(123, 400, 87, false);
+    QTest::newRow("progress finished")
+        << progress << 0 << ts << progressPayload(400, 400, 91, true)
+        << ts << progressPayload(400, 400, 91, true);
+    QJsonObject unchanged = progressPayload(5, 0, 12, false);
+    unchanged["total"] = 0;
+    QTest::newRow("progress total unchanged")
+        << progress << 2 << ts << unchanged
+        << ts << progressPayload(5, 0, 12, false);
+    QTest::newRow("progress u16 max")
+        << progress << 254 << ts << progressPayload(65535, 65535, 65535, false)
+        << ts << progressPayload(65535, 65535, 65535, false);
+    QTest::newRow("progress clamped high")
+        << progress << 2 << ts << progressPayload(65536, 100000, 70000, false)
+        << ts << progressPayload(65535, 65535, 65535, false);
+    QTest::newRow("progress clamped low")
+        << progress << 2 << ts << progressPayload(-1, 400, -50, false)
+        << ts << progressPayload(0, 400, 0, false);
+
+    // FINISH: fixed struct plus the zigzag finishAt delta in both directions
+    QJsonObject finishIn;
+    finishIn["wpm"] = 92;
+    finishIn["accuracy"] = 97.5;
+    finishIn["errors"] = 4;
+    finishIn["duration"] = 42;
+    finishIn["position"] = 2;
+    QJsonObject finishNoTime = finishIn;
+    QTest::newRow("finish without finishAt")
+        << finish << 2 << ts << finishIn << ts << finishNoTime;
+
+    finishIn["finishAt"] = ts + 42000;
+    QTest::newRow("finish finishAt after ts")
+        << finish << 2 << ts << finishIn << ts << finishIn;
+    finishIn["finishAt"] = ts - 1;
+    QTest::newRow("finish finishAt before ts")
+        << finish << 2 << ts << finishIn << ts << finishIn;
+    finishIn["finishAt"] = ts;
+    QTest::newRow("finish finishAt equal ts")
+        << finish << 2 << ts << finishIn << ts << finishIn;
+
+    QJsonObject finishEdge;
+    finishEdge["wpm"] = 70000;
+    finishEdge["accuracy"] = 1000.0;
+    finishEdge["errors"] = -3;
+    finishEdge["duration"] = 65535;
+    finishEdge["position"] = 300;
+    QJsonObject finishEdgeOut;
+    finishEdgeOut["wpm"] = 65535;
+    finishEdgeOut["accuracy"] = 655.35;
+    finishEdgeOut["errors"] = 0;
+    finishEdgeOut["duration"] = 65535;
+    finishEdgeOut["position"] = 255;
+    QTest::newRow("finish clamped")
+        << finish << 2 << ts << finishEdge << ts << finishEdgeOut;
+
+    QJsonObject finishDefault;
+    finishDefault["wpm"] = 0;
+    finishDefault["accuracy"] = 100.0;
+    finishDefault["errors"] = 0;
+    finishDefault["duration"] = 0;
+    finishDefault["position"] = 0;
+    QTest::newRow("finish accuracy defaults to 100")
+        << finish << 2 << ts << QJsonObject() << ts << finishDefault;
+
+    // STATE_SNAPSHOT: every entry field; unindexed entries are dropped
+    QJsonArray players;
+    players.append(snapshotEntry(0, 10, 400, 50, false, 0));
+    players.append(snapshotEntry(7, 400, 400, 88, true, 1));
+    players.append(snapshotEntry(NetworkManager::NO_INDEX, 1, 1, 1, false, 0));
+    players.append(snapshotEntry(254, 70000, -1, 65535, true, 300));
+    QJsonArray playersOut;
+    playersOut.append(snapshotEntry(0, 10, 400, 50, false, 0));
+    playersOut.append(snapshotEntry(7, 400, 400, 88, true, 1));
+    playersOut.append(snapshotEntry(254, 65535, 0, 65535, true, 255));
+    QJsonObject snapshotIn;
+    snapshotIn["players"] = players;
+    QJsonObject snapshotOut;
+    snapshotOut["players"] = playersOut;
+    QTest::newRow("snapshot")
+        << snapshot << 0 << ts << snapshotIn << ts << snapshotOut;
+
+    QJsonObject emptySnapshot;
+    emptySnapshot["players"] = QJsonArray();
+    QTest::newRow("snapshot empty")
+        << snapshot << 0 << ts << emptySnapshot << ts << emptySnapshot;
+
+    // Varint timestamp at each encoded-length boundary; negative clamps to 0
+    const qint64 timestamps[] = {
+        0, 127, 128, 16383, 16384, (qint64(1) << 35) - 1, qint64(1) << 35,
+        (qint64(1) << 56) - 1, qint64(1) << 56, std::numeric_limits<qint64>::max()
+    };
+    for (qint64 t : timestamps) {
+        QTest::addRow("timestamp %lld", static_cast<long long>(t))
+            << progress << 2 << t << progressPayload(1, 2, 3, false)
+            << t << progressPayload(1, 2, 3, false);
+    }
+    QTest::newRow("timestamp negative")
+        << progress << 2 << qint64(-5) << progressPayload(1, 2, 3, false)
+        << qint64(0) << progressPayload(1, 2, 3, false);
+}
+
+void RapidTexterBench::packetRoundTrip() {
+    QFETCH(int, type);
+    QFETCH(int, index);
+    QFETCH(qint64, timestamp);
+    QFETCH(QJsonObject, payload);
+    QFETCH(qint64, expectedTimestamp);
+    QFETCH(QJsonObject, expected);
+
+    Packet packet;
+    packet.type = static_cast<PacketType>(type);
+    packet.timestamp = timestamp;
+    packet.payload = payload;
+
+    const Packet decoded = Packet::deserialize(packet.binaryBody(static_cast<quint8>(index)));
+    QVERIFY(decoded.valid);
+    QCOMPARE(static_cast<int>(decoded.type), type);
+    QCOMPARE(static_cast<int>(decoded.senderIndex), index);
+    QCOMPARE(decoded.timestamp, expectedTimestamp);
+    QCOMPARE(canonical(decoded.payload), canonical(expected));
+}
+
+// ============================================================================
+// HOST MIGRATION
+// ============================================================================
+
+namespace {
+
+bool sawProgress(const QSignalSpy& spy, const QString& id, int wpm) {
+    for (const QList<QVariant>& args : spy) {
+        if (args.at(0).toString() == id && args.at(3).toInt() == wpm) return true;
+    }
+    return false;
+}
+
+bool connectedTo(const NetworkManager& net, const QString& id) {
+    const QVariantList peers = net.peerStats();
+    return peers.size() == 1 && peers.first().toMap()["uuid"].toString() == id;
+}
+
+} // namespace
+
+void RapidTexterBench::starHostMigration() {
+    NetworkManager host(0, false);
+    NetworkManager first(0, false);
+    NetworkManager second(0, false);
+    host.setStarTopology(true);
+    QVERIFY(host.createRoom());
+    QVERIFY(first.joinRoom("127.0.0.1", host.serverPort()));
+    QVERIFY(second.joinRoom("127.0.0.1", host.serverPort()));
+    QTRY_VERIFY_WITH_TIMEOUT(first.players().size() == 3 && second.players().size() == 3,
+                             NETWORK_TIMEOUT_MS);
+
+    QSignalSpy firstStarted(&first, &NetworkManager::gameStarted);
+    QSignalSpy secondStarted(&second, &NetworkManager::gameStarted);
+    host.setGameText("the quick brown fox jumps over the lazy dog");
+    host.startCountdown();
+    QTRY_VERIFY_WITH_TIMEOUT(firstStarted.count() == 1 && secondStarted.count() == 1,
+                             NETWORK_TIMEOUT_MS);
+
+    // The host leaves mid-race; one guest is elected and the other reconnects
+    host.closeRoom();
+    QTRY_VERIFY_WITH_TIMEOUT(first.isRoomCreator() || second.isRoomCreator(), NETWORK_TIMEOUT_MS);
+    NetworkManager& newHost = first.isRoomCreator() ? first : second;
+    NetworkManager& guest = first.isRoomCreator() ? second : first;
+    QTRY_VERIFY_WITH_TIMEOUT(connectedTo(newHost, guest.playerId()) &&
+                             connectedTo(guest, newHost.playerId()),
+                             NETWORK_TIMEOUT_MS);
+
+    // The first update carries the total over TCP; the next one is a binary
+    // datagram the new host resolves by the guest's room index
+    QSignalSpy hostSaw(&newHost, &NetworkManager::playerProgressUpdated);
+    guest.updateProgress(5, 43, 40);
+    guest.updateProgress(9, 43, 45);
+    QTRY_VERIFY_WITH_TIMEOUT(sawProgress(hostSaw, guest.playerId(), 45), NETWORK_TIMEOUT_MS);
+    QVERIFY(guest.peerStats().first().toMap()["datagramsSent"].toInt() > 0);
+
+    // The new host lists itself in STATE_SNAPSHOT under its own index
+    QSignalSpy guestSaw(&guest, &NetworkManager::playerProgressUpdated);
+    newHost.updateProgress(7, 43, 33);
+    QTRY_VERIFY_WITH_TIMEOUT(sawProgress(guestSaw, newHost.playerId(), 33), NETWORK_TIMEOUT_MS);
+}
+
+QTEST_GUILESS_MAIN(RapidTexterBench)
+
+#include "rapidtexter_bench.moc"
@@ -0,0 +1,131 @@
+#ifndef AUDIOENGINE_H
+#define AUDIOENGINE_H
+
+#include <QAudioFormat>
+#include <QIODevice>
+#include <QObject>
+#include <QString>
+
+#include <memory>
+#include <vector>
+
+#include "SpscRing.h"
+
+class AudioMixer;
+class QAudioSink;
+class QMediaDevices;
+class QThread;
+
+/**
+ * @brief Preloaded PCM sound effects mixed on a dedicated audio thread.
+ *
+ * WAV files are decoded once (loadSample) into float stereo at the output
+ * device's rate. One long-lived QAudioSink pulls from an AudioMixer on its
+ * own thread; play() only pushes a trigger into a lock-free queue, so the
+ * GUI thread never blocks on audio. Voices overlap (up to MAX_VOICES, the
+ * oldest is stolen), and the mixer streams silence between effects, which
+ * keeps the device awake without reloading anything.
+ *
+ * The sink is reopened on the current default output when the device list
+ * changes or the sink stops with an error (device unplugged, server
+ * restart), so sound survives switching headphones or speakers.
+ *
+ * Samples must be loaded before start(); the bank is read-only afterwards.
+ */
+class AudioEngine : public QObject {
+    Q_OBJECT
+
+public:
+    explicit AudioEngine(QObject* parent = nullptr);
+    ~AudioEngine();
+
+    // Decode a WAV file (PCM 8/16/24/32-bit or float); returns the sample id or -1
+    int loadSample(const QString& path);
+
+    // Open the output device and start mixing
+    void start();
+
+    // Queue a sample for playback (GUI thread: the trigger queue has one producer)
+    void play(int sampleId, float volume = 1.0f);
+
+    // Output buffering requested from the device
+    static constexpr int BUFFER_MS = 10;
+    static constexpr int MAX_VOICES = 16;
+
+    // Decoded sample: interleaved stereo float at the output rate
+    struct Sample {
+        std::vector<float> frames;
+        qint64 frameCount() const { return qint64(frames.size() / 2); }
+    };
+
+    struct Trigger {
+        int sampleId;
+        float volume;
+    };
+
+private:
+    QAudioFormat m_format;
+    std::shared_ptr<std::vector<Sample>> m_samples;
+    SpscRing<Trigger, 64> m_triggers;
+    QThread* m_thread = nullptr;
+    AudioMixer* m_mixer = nullptr;
+    QMediaDevices* m_devices = nullptr;  // Output list changes (GUI thread)
+};
+
+/**
+ * @brief Pull-mode QIODevice that mixes active voices for QAudioSink.
+ *
+ * Lives on the audio thread. readData() drains pending triggers, mixes
+ * in float and converts to the device format; it always fills the whole
+ * request, writing silence when nothing plays.
+ */
+class AudioMixer : public QIODevice {
+    Q_OBJECT
+
+public:
+    AudioMixer(const QAudioFormat& format,
+               std::shared_ptr<const std::vector<AudioEngine::Sample>> samples,
+               SpscRing<AudioEngine::Trigger, 64>* triggers);
+
+    bool isSequential() const override { return true; }
+    qint64 bytesAvailable() const override;
+
+public slots:
+    void startOutput();
+    void stopOutput();
+
+    // Reopen the sink on the current default output (after a short delay)
+    void scheduleRestart();
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 maxSize) override;
+
+private:
+    struct Voice {
+        int sampleId = -1;   // -1 = free
+        qint64 position = 0; // Next frame
+        float volume = 1.0f;
+        quint64 age = 0;     // Trigger order, for voice stealing
+    };
+
+    static constexpr int MIX_CHUNK_FRAMES = 256;
+    static constexpr int RESTART_DELAY_MS = 500;  // Lets a device switch settle; bounds retries
+
+    QAudioFormat m_format;
+    std::shared_ptr<const std::vector<AudioEngine::Sample>> m_samples;
+    SpscRing<AudioEngine::Trigger, 64>* m_triggers;
+    QAudioSink* m_sink = nullptr;
+    Voice m_voices[AudioEngine::MAX_VOICES];
+    quint64 m_triggerCount = 0;
+    bool m_restartPending = false;
+
+    void openSink();
+    void closeSink();
+    void onSinkStateChanged();
+    void startVoice(const AudioEngine::Trigger& trigger);
+    void mix(float* stereo, int frames);
+    void convert(const float* stereo, char* out, int frames) const;
+};
+
+#endif // AUDIOENGINE_H
@@ -0,0 +1,142 @@
+/**
+ * @file CharacterModel.h
+ * @brief List model per karakter untuk tampilan teks gameplay
+ * @author Alea Farrel & Team
+ * @date 2025
+ *
+ * CharacterModel mengekspos setiap karakter target text sebagai satu cell
+ * dengan state dan posisi layout (baris/kolom). Setiap keystroke hanya
+ * memicu dataChanged untuk cell yang berubah.
+ */
+
+#ifndef CHARACTERMODEL_H
+#define CHARACTERMODEL_H
+
+#include <QAbstractListModel>
+#include <QString>
+#include <vector>
+
+class TypingSession;
+
+/**
+ * @class CharacterModel
+ * @brief Model cell karakter yang dibaca dari TypingSession
+ *
+ * Word wrap dihitung di C++ untuk font monospace: QML cukup memberi tahu
+ * jumlah kolom yang muat (columns), lalu setiap delegate diposisikan dari
+ * role line dan column. Dengan begitu render per keystroke tidak
+ * bergantung pada panjang teks.
+ *
+ * Untuk text streaming, teks bisa ditambah di akhir (appendText) dan
+ * baris yang sudah selesai dibuang dari awal (removeLeading), sehingga
+ * jumlah cell tetap kecil berapapun lama permainan.
+ *
+ * @par Contoh penggunaan di QML:
+ * @code
+ * Repeater {
+ *     model: session.characters
+ *     delegate: Text {
+ *         x: model.column * cellWidth
+ *         y: model.line * lineHeight
+ *         text: model.displayChar
+ *     }
+ * }
+ * @endcode
+ */
+class CharacterModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+    Q_PROPERTY(int columns READ columns WRITE setColumns NOTIFY columnsChanged)
+    Q_PROPERTY(int lineCount READ lineCount NOTIFY lineCountChanged)
+
+public:
+    enum Roles {
+        CharacterRole = Qt::UserRole + 1,  ///< Karakter target
+        StateRole,                         ///< TypingSession::CharState
+        WordIndexRole,                     ///< Index kata (spasi ikut kata sebelumnya)
+        LineRole,                          ///< Baris hasil word wrap
+        ColumnRole,                        ///< Kolom hasil word wrap
+        DisplayRole,                       ///< Karakter yang ditampilkan (spasi salah menampilkan ketikan)
+        IsSpaceRole                        ///< true untuk spasi antar kata
+    };
+    Q_ENUM(Roles)
+
+    /**
+     * @brief Constructor
+     * @param session TypingSession sumber state (biasanya parent)
+     * @param parent QObject parent
+     */
+    explicit CharacterModel(const TypingSession* session, QObject* parent = nullptr);
+
+    // QAbstractListModel interface
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    int columns() const;
+
+    /**
+     * @brief Set lebar area teks dalam jumlah karakter dan hitung ulang layout
+     */
+    void setColumns(int columns);
+
+    int lineCount() const;
+
+    /**
+     * @brief Bangun ulang cell dari target text (reset model)
+     */
+    void setText(const QString& text);
+
+    /**
+     * @brief Tambahkan teks di akhir (rows baru di-insert, bukan reset)
+     */
+    void appendText(const QString& text);
+
+    /**
+     * @brief Buang count cell pertama; baris sisanya dinomori ulang dari 0
+     * @note count harus berada di awal baris agar layout tidak bergeser
+     */
+    void removeLeading(int count);
+
+    /**
+     * @brief Baris tempat cell index berada (index == rowCount() = akhir teks)
+     */
+    int lineOf(int index) const;
+
+    /**
+     * @brief Index cell pertama pada baris line (rowCount() jika di luar teks)
+     */
+    int lineStart(int line) const;
+
+    /**
+     * @brief State satu cell berubah; emit dataChanged untuk cell tersebut
+     */
+    void cellChanged(int index);
+
+    /**
+     * @brief State semua cell berubah (misalnya setelah reset session)
+     */
+    void allCellsChanged();
+
+signals:
+    void columnsChanged();
+    void lineCountChanged();
+
+private:
+    struct Cell {
+        int wordIndex;
+        int line;
+        int column;
+    };
+
+    const TypingSession* m_session;
+    QString m_text;
+    std::vector<Cell> m_cells;
+    int m_columns;
+    int m_lineCount;
+
+    void layoutCells();
+};
+
+#endif // CHARACTERMODEL_H
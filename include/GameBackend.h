@@ -18,17 +18,22 @@
 #include <QVariantMap>
 #include <QQmlEngine>
 #include <QJSEngine>
-#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QList>
+#include <functional>
 #include <memory>
 
 #include "TextProvider.h"
 #include "HistoryManager.h"
+#include "HistoryModel.h"
 #include "ProgressManager.h"
 #include "SettingsManager.h"
+#include "PlayersModel.h"
+#include "Replay.h"
+#include "TypingSession.h"
 
 // Forward declare for SFX
-class QSoundEffect;
-class QTimer;
+class AudioEngine;
 
 /**
  * @class GameBackend
@@ -38,6 +43,7 @@ class QTimer;
  * - Text provider untuk kata-kata acak
  * - Sound effects manager
  * - History manager untuk menyimpan hasil game
+ * - Ghost race melawan replay personal best
  * - Progress manager untuk campaign
  * - Settings manager untuk pengaturan user
  */
@@ -50,18 +56,47 @@ class GameBackend : public QObject
     Q_PROPERTY(int defaultDuration READ defaultDuration WRITE setDefaultDuration NOTIFY defaultDurationChanged)
     Q_PROPERTY(QString historySortBy READ historySortBy WRITE setHistorySortBy NOTIFY historySortByChanged)
     Q_PROPERTY(bool historySortAscending READ historySortAscending WRITE setHistorySortAscending NOTIFY historySortAscendingChanged)
+    Q_PROPERTY(bool ready READ isReady NOTIFY readyChanged)
+    Q_PROPERTY(double loadProgress READ loadProgress NOTIFY loadProgressChanged)
+    Q_PROPERTY(HistoryModel* historyModel READ historyModel CONSTANT)
+    Q_PROPERTY(double personalBestWpm READ personalBestWpm NOTIFY historyUpdated)
+    Q_PROPERTY(PlayersModel* ghostPlayers READ ghostPlayers CONSTANT)
+    Q_PROPERTY(bool ghostLoaded READ ghostLoaded NOTIFY ghostChanged)
 
 public:
     /**
      * @brief Get singleton instance
      */
     static GameBackend* instance();
+
+    /**
+     * @brief Instance yang sudah ada, tanpa membuatnya
+     * @return nullptr jika belum dibuat (misalnya di tool headless)
+     */
+    static GameBackend* existingInstance() { return s_instance; }
     
     /**
      * @brief Create singleton instance dengan QML engine sebagai parent
      */
     static GameBackend* create(QQmlEngine *qmlEngine, QJSEngine *jsEngine);
 
+    // ========================================================================
+    // INITIALIZATION STATE
+    // ========================================================================
+
+    /**
+     * @brief Cek apakah word banks, history, dan progress sudah selesai di-load
+     *
+     * Data di-load di background thread saat SplashScreen tampil. Selama
+     * belum ready, QML tidak boleh membuka menu yang membutuhkan data.
+     */
+    bool isReady() const;
+
+    /**
+     * @brief Progress loading awal (0.0 - 1.0)
+     */
+    double loadProgress() const;
+
     // ========================================================================
     // TEXT PROVIDER INTERFACE
     // ========================================================================
@@ -71,9 +106,51 @@ public:
      * @param language Bahasa ("id", "en", "prog")
      * @param difficulty Difficulty ("easy", "medium", "hard", "programmer")
      * @param wordCount Jumlah kata yang diinginkan
+     * @param textMode "words" (kata acak) atau "natural" (model Markov korpus)
      * @return String teks yang akan diketik
      */
-    Q_INVOKABLE QString getRandomText(const QString& language, const QString& difficulty, int wordCount);
+    Q_INVOKABLE QString getRandomText(const QString& language, const QString& difficulty, int wordCount,
+                                      const QString& textMode = QStringLiteral("words"));
+
+    /**
+     * @brief Memulai text stream baru (mode unlimited / durasi panjang)
+     * @param language Bahasa ("id", "en", "prog")
+     * @param difficulty Difficulty ("easy", "medium", "hard", "programmer")
+     * @param textMode "words" (kata acak) atau "natural" (model Markov korpus)
+     *
+     * Mode "words": kata tidak berulang antar chunk sampai word bank habis.
+     * Mode "natural": setiap chunk melanjutkan kalimat chunk sebelumnya.
+     */
+    Q_INVOKABLE void startTextStream(const QString& language, const QString& difficulty,
+                                     const QString& textMode = QStringLiteral("words"));
+
+    /**
+     * @brief Mengambil chunk kata berikutnya dari text stream
+     * @param wordCount Jumlah kata dalam chunk
+     * @return Kata-kata dipisah spasi (tanpa spasi di awal/akhir)
+     */
+    Q_INVOKABLE QString nextTextChunk(int wordCount);
+
+    /**
+     * @brief Teks acak yang ditentukan oleh seed (sinkronisasi race)
+     * @param language Bahasa ("id", "en", "prog")
+     * @param difficulty Difficulty ("easy", "medium", "hard", "programmer")
+     * @param wordCount Jumlah kata
+     * @param seed Seed dari host
+     * @return Teks yang identik di setiap client dengan wordBankHash() sama
+     */
+    QString getSeededText(const QString& language, const QString& difficulty, int wordCount, quint64 seed);
+
+    /**
+     * @brief Hash isi word bank satu bahasa (0 jika belum di-load)
+     */
+    quint64 wordBankHash(const QString& language) const;
+
+    /**
+     * @brief Hash semua word bank yang sudah di-load
+     * @return Map bahasa -> hash (string hex), kosong selama loading
+     */
+    QVariantMap wordBankHashes() const;
 
     // ========================================================================
     // SFX INTERFACE
@@ -123,11 +200,15 @@ public:
      * @param difficulty Difficulty level
      * @param language Bahasa yang digunakan
      * @param mode Mode permainan (Manual/Campaign)
+     * @param timeElapsed Lama permainan dalam detik
+     * @param replay Rekaman keystroke dari TypingSession::replayData() (opsional)
+     * @param keyStats Statistik tombol/bigram dari TypingSession::keyStatsData() (opsional)
      */
     Q_INVOKABLE void saveGameResult(double wpm, double accuracy, int errors,
                                      int targetWPM, const QString& difficulty,
                                      const QString& language, const QString& mode,
-                                     double timeElapsed);
+                                     double timeElapsed, const QByteArray& replay = QByteArray(),
+                                     const QByteArray& keyStats = QByteArray());
 
     /**
      * @brief Mendapatkan halaman history
@@ -150,6 +231,14 @@ public:
      */
     Q_INVOKABLE QVariantList getHistoryPageSorted(int pageNumber, int pageSize, const QString& sortBy, bool ascending, const QString& modeFilter = "All", const QString& languageFilter = "All", const QString& difficultyFilter = "All");
 
+    /**
+     * @brief Implementasi getHistoryPageSorted untuk HistoryManager apa pun
+     *
+     * Tidak menyentuh state GameBackend, sehingga bisa dipakai benchmark
+     * tanpa membuat singleton (audio, settings, dll).
+     */
+    static QVariantList queryHistoryPage(const HistoryManager& history, int pageNumber, int pageSize, const QString& sortBy, bool ascending, const QString& modeFilter, const QString& languageFilter, const QString& difficultyFilter);
+
     /**
      * @brief Mendapatkan total halaman history
      */
@@ -165,6 +254,91 @@ public:
      */
     Q_INVOKABLE void clearHistory();
 
+    /**
+     * @brief List model history untuk ListView
+     *
+     * Sorting/filter diatur via HistoryModel::setQuery(). Model otomatis
+     * menerima baris baru dari saveGameResult() dan di-reset oleh
+     * clearHistory().
+     */
+    HistoryModel* historyModel() const;
+
+    /**
+     * @brief Mendapatkan statistik agregat history untuk kombinasi filter
+     * @param modeFilter Filter mode ("All", "Manual", "Campaign")
+     * @param languageFilter Filter bahasa ("All", "ID", "EN", "PROG")
+     * @param difficultyFilter Filter difficulty ("All", "Easy", "Medium", "Hard", "Programmer")
+     * @return QVariantMap berisi count, bestWpm, worstWpm, avgWpm, stdDevWpm,
+     *         recentWpm (EMA), p50Wpm, p90Wpm, avgAccuracy, bestAccuracy,
+     *         recentAccuracy
+     *
+     * Nilai dibaca dari agregat yang di-update setiap saveGameResult(),
+     * sehingga tidak ada scan history.
+     */
+    Q_INVOKABLE QVariantMap getHistoryStats(const QString& modeFilter = "All",
+                                            const QString& languageFilter = "All",
+                                            const QString& difficultyFilter = "All") const;
+
+    /**
+     * @brief Heatmap kelemahan per tombol dari seluruh history
+     * @param languageFilter Filter bahasa ("All", "ID", "EN", "PROG")
+     * @return QVariantMap dengan key = karakter, value = QVariantMap berisi
+     *         count, errors, meanMs, errorRate, score (0 = normal); hanya
+     *         tombol yang pernah diketik
+     *
+     * Dibaca dari agregat padat HistoryManager, tanpa membaca journal.
+     */
+    Q_INVOKABLE QVariantMap keyHeatmap(const QString& languageFilter = "All") const;
+
+    /**
+     * @brief Bigram terlemah dari seluruh history
+     * @param limit Jumlah maksimal bigram
+     * @param languageFilter Filter bahasa ("All", "ID", "EN", "PROG")
+     * @return List QVariantMap berisi bigram, count, errors, meanMs,
+     *         errorRate, score; urut dari yang terlemah
+     */
+    Q_INVOKABLE QVariantList weakBigrams(int limit = 10, const QString& languageFilter = "All") const;
+
+    /**
+     * @brief WPM tertinggi dari seluruh history (0 jika kosong)
+     */
+    double personalBestWpm() const;
+
+    // ========================================================================
+    // GHOST RACE INTERFACE
+    // ========================================================================
+
+    /**
+     * @brief Memuat replay personal best sebagai ghost
+     * @param mode Mode permainan ("Manual", "Campaign")
+     * @param language Bahasa yang tercatat di history ("ID", "EN")
+     * @param difficulty Difficulty level
+     * @return true jika ada replay; ghostPlayers berisi lane pemain dan ghost
+     *
+     * Replay dibaca dari file-nya di sini (lazy), bukan saat loading history.
+     */
+    Q_INVOKABLE bool loadGhost(const QString& mode, const QString& language, const QString& difficulty);
+
+    /**
+     * @brief Melepas ghost dan mengosongkan ghostPlayers
+     */
+    Q_INVOKABLE void clearGhost();
+
+    /**
+     * @brief Menggerakkan lane pemain dan ghost ke waktu session saat ini
+     * @param session Session gameplay yang sedang berjalan
+     *
+     * Dipanggil sekali per frame. Session yang di-reset memutar ghost dari awal.
+     */
+    Q_INVOKABLE void advanceGhost(TypingSession* session);
+
+    /**
+     * @brief Model lane untuk RaceTrack (pemain lokal + ghost)
+     */
+    PlayersModel* ghostPlayers() const;
+
+    bool ghostLoaded() const;
+
     // ========================================================================
     // PROGRESS INTERFACE
     // ========================================================================
@@ -252,6 +426,9 @@ signals:
     void historyUpdated();
     void historySortByChanged();
     void historySortAscendingChanged();
+    void readyChanged();
+    void loadProgressChanged();
+    void ghostChanged();
 
 private:
     explicit GameBackend(QObject *parent = nullptr);
@@ -260,32 +437,52 @@ private:
     // Singleton instance
     static GameBackend* s_instance;
 
+    // Background initialization
+    struct InitialData;
+    QFutureWatcher<std::shared_ptr<InitialData>>* m_initWatcher;
+    bool m_ready;
+    double m_loadProgress;
+    QList<std::function<void()>> m_deferredWrites;  // Saves/resets requested before m_ready
+
     // Managers
     TextProvider m_textProvider;
+    TextProvider::WordDeck m_textStream;  // Deck for the current streamed game
     HistoryManager m_historyManager;
     ProgressManager m_progressManager;
-
-    // SFX
-    QSoundEffect* m_correctSound;
-    QSoundEffect* m_errorSound;
+    HistoryModel* m_historyModel;
+
+    // Ghost race: replay stays in memory (~1 KB) while the cursor plays it
+    Replay m_ghostReplay;
+    ReplayCursor m_ghostCursor;
+    PlayersModel* m_ghostPlayers;
+    QString m_ghostName;
+    quint64 m_ghostElapsedUs;
+    bool m_ghostLoaded;
+
+    // SFX: samples decoded once, mixed on AudioEngine's thread. Its silent
+    // stream keeps the audio device awake, so nothing is reloaded.
+    AudioEngine* m_audio;
+    int m_correctSample;
+    int m_errorSample;
     bool m_sfxEnabled;
-    QElapsedTimer m_errorSoundTimer;
-    QElapsedTimer m_lastSoundPlayedTimer;  // Track last time any sound was played
-    QTimer* m_audioKeepAliveTimer;  // Periodic timer to keep audio device awake
-    static const int SOUND_COOLDOWN_MS = 80;
-    static const int AUDIO_KEEPALIVE_MS = 3000;  // Reinitialize audio every 3 seconds of inactivity
+    static constexpr float SFX_VOLUME = 0.5f;
 
     // Settings
     int m_defaultDuration;
 
+    // Key analytics: cells with fewer attempts are too noisy to rank
+    static constexpr uint32_t KEYSTATS_MIN_SAMPLES = 8;
+
     // Helper methods
     Difficulty stringToDifficulty(const QString& diff);
+    TextMode stringToTextMode(const QString& mode);
     void initializeSfx();
     void loadSettings();
-    void reinitializeAudio();  // Reinitialize both sounds
+    void updateBigramWeights(); // Feed lifetime weak bigrams to the "weak" text mode
+    void startBackgroundLoad(); // Load word banks, history, progress off the GUI thread
 
 private slots:
-    void onAudioKeepAlive();  // Called by timer to keep audio device active
+    void onBackgroundLoadFinished();
 };
 
 #endif // GAMEBACKEND_H
@@ -4,8 +4,11 @@
  * @author Alea Farrel & Team
  * @date 2025
  * 
- * HistoryManager mengelola pencatatan history permainan user dalam format JSON.
- * Mendukung pagination untuk menampilkan history secara bertahap.
+ * HistoryManager mengelola pencatatan history permainan user dalam journal
+ * binary append-only (history.journal). Mendukung pagination untuk
+ * menampilkan history secara bertahap. Statistik per tombol/bigram tiap
+ * permainan dicatat di journal terpisah (keystats.journal) beserta agregat
+ * seumur pemakaian per bahasa.
  */
 
 #ifndef HISTORYMANAGER_H
@@ -14,6 +17,11 @@
 #include <string>
 #include <vector>
 #include <ctime>
+#include <cstdint>
+#include <array>
+
+#include "HistoryStats.h"
+#include "KeyStats.h"
 
 /**
  * @struct HistoryEntry
@@ -37,11 +45,40 @@ struct HistoryEntry {
     std::string mode;         ///< Mode permainan ("Manual", "Campaign")
     std::string timestamp;    ///< Waktu permainan (format: DD/MM/YYYY HH:MM:SS)
     double timeElapsed;       ///< Waktu bermain dalam detik
+    int64_t epoch;            ///< Waktu permainan dalam epoch seconds (sumber timestamp)
+    uint64_t replayId;        ///< ID file replay (lihat replayPath()), 0 jika tidak ada
     
     /**
      * @brief Constructor default
      */
-    HistoryEntry() : wpm(0), accuracy(0), targetWPM(0), errors(0), timeElapsed(0) {}
+    HistoryEntry() : wpm(0), accuracy(0), targetWPM(0), errors(0), timeElapsed(0), epoch(0),
+                     replayId(0) {}
+};
+
+/**
+ * @enum HistorySortKey
+ * @brief Field yang bisa dipakai untuk sorting history
+ */
+enum class HistorySortKey {
+    DATE,       ///< Waktu permainan (epoch)
+    WPM,        ///< Words Per Minute
+    ACCURACY,   ///< Akurasi
+    TIME        ///< Lama permainan (timeElapsed)
+};
+
+/**
+ * @struct HistoryFilter
+ * @brief Filter mode/bahasa/difficulty dalam bentuk bitmask
+ * 
+ * Kode mode, bahasa, dan difficulty setiap entry di-pack ke satu uint16_t
+ * (masing-masing 4 bit), sehingga pengecekan filter cukup satu operasi
+ * AND dan satu perbandingan. Dimensi dengan filter "All" memiliki mask 0.
+ */
+struct HistoryFilter {
+    uint16_t mask = 0;   ///< Bit kode yang harus dicocokkan
+    uint16_t value = 0;  ///< Nilai kode yang diharapkan (sudah di-mask)
+
+    bool matches(uint16_t codes) const { return (codes & mask) == value; }
 };
 
 /**
@@ -49,8 +86,10 @@ struct HistoryEntry {
  * @brief Class untuk mengelola history permainan
  * 
  * Features:
- * - Save entry baru ke history
- * - Load history dari file JSON
+ * - Save entry baru ke history (append O(1) ke journal binary)
+ * - Penyimpanan kolumnar di memory dengan index sorting per field
+ * - Query halaman dengan filter dan sorting tanpa copy maupun operasi string
+ * - Load history dari journal, dengan migrasi satu kali dari history.json lama
  * - Pagination support (untuk tampilan terminal)
  * - Auto-save setiap kali ada entry baru
  */
@@ -58,26 +97,45 @@ class HistoryManager {
 public:
     /**
      * @brief Constructor - Initialize dan load existing history
+     * @param autoLoad false untuk menunda loadHistory() (misalnya agar
+     *        dijalankan di background thread oleh GameBackend)
      */
-    HistoryManager();
+    explicit HistoryManager(bool autoLoad = true);
+
+    /**
+     * @brief Constructor dengan path journal eksplisit
+     * @param journalPath Path file journal (tanpa migrasi history.json lama)
+     * @param autoLoad false untuk menunda loadHistory()
+     * @note Dipakai oleh benchmark agar tidak menyentuh data user
+     */
+    HistoryManager(const std::string& journalPath, bool autoLoad);
     
     /**
      * @brief Menyimpan entry baru ke history
      * @param entry HistoryEntry yang akan disimpan
+     * @param replay Replay hasil Replay::serialize() (kosong = tanpa replay)
+     * @param keyStats KeyStats hasil KeyStats::serialize() (kosong = tidak ada)
      * 
-     * Entry akan ditambahkan ke list dan langsung di-save ke file.
-     * History akan diurutkan dari yang terbaru ke terlama.
+     * Entry akan di-append sebagai satu record ke journal (tanpa menulis
+     * ulang seluruh history). Saat ditampilkan, history diurutkan dari
+     * yang terbaru ke terlama. Replay ditulis ke file sendiri dan hanya
+     * ditandai dengan satu flag di record. KeyStats di-append ke
+     * keystats.journal dan langsung dijumlahkan ke agregat bahasanya.
      */
-    void saveEntry(const HistoryEntry& entry);
+    void saveEntry(const HistoryEntry& entry, const std::string& replay = std::string(),
+                   const std::string& keyStats = std::string());
     
     /**
-     * @brief Load history dari file JSON
+     * @brief Load history dari journal binary
      * @return true jika berhasil, false jika file tidak ada atau error
+     *
+     * Jika journal belum ada tetapi history.json lama ada, history lama
+     * dimigrasikan satu kali ke journal.
      */
     bool loadHistory();
     
     /**
-     * @brief Save history ke file JSON
+     * @brief Tulis ulang seluruh history ke journal (compaction)
      * @return true jika berhasil
      */
     bool saveHistory();
@@ -113,15 +171,254 @@ public:
      */
     void clearHistory();
 
+    // ========================================================================
+    // INDEXED QUERIES
+    // ========================================================================
+
+    /**
+     * @brief Membuat filter dari nama mode/bahasa/difficulty
+     * @param mode "All"/"" untuk semua, atau "Manual"/"Campaign"
+     * @param language "All"/"" untuk semua, atau "ID"/"EN"/"PROG"
+     * @param difficulty "All"/"" untuk semua, atau "Easy"/"Medium"/...
+     * @return HistoryFilter siap dipakai queryPage()/countMatching()
+     */
+    static HistoryFilter makeFilter(const std::string& mode,
+                                    const std::string& language,
+                                    const std::string& difficulty);
+
+    /**
+     * @brief Mengambil ID entry untuk satu halaman hasil filter + sorting
+     * @param filter Filter mode/bahasa/difficulty
+     * @param key Field sorting
+     * @param ascending true untuk ascending, false untuk descending
+     * @param offset Jumlah entry yang cocok yang dilewati
+     * @param limit Jumlah maksimal ID yang diambil
+     * @param ids Output ID entry (lihat getEntry())
+     * @return Jumlah ID yang ditulis ke ids
+     *
+     * Entry dengan nilai sama diurutkan berdasarkan waktu simpan
+     * (descending = terbaru dulu).
+     */
+    size_t queryPage(const HistoryFilter& filter, HistorySortKey key, bool ascending,
+                     size_t offset, size_t limit, std::vector<uint32_t>& ids) const;
+
+    /**
+     * @brief Menghitung jumlah entry yang cocok dengan filter
+     */
+    size_t countMatching(const HistoryFilter& filter) const;
+
+    /**
+     * @brief Statistik agregat (count, mean, min/max, EMA, p50/p90 WPM)
+     * @param mode "All"/"" untuk semua, atau "Manual"/"Campaign"
+     * @param language "All"/"" untuk semua, atau "ID"/"EN"/"PROG"
+     * @param difficulty "All"/"" untuk semua, atau "Easy"/"Medium"/...
+     * @return Bucket statistik, O(1) tanpa memindai history
+     */
+    const StatsBucket& getStats(const std::string& mode, const std::string& language,
+                                const std::string& difficulty) const;
+
+    /**
+     * @brief Membangun HistoryEntry untuk entry dengan ID tertentu
+     * @param id ID entry (urutan simpan, 0 = paling lama)
+     */
+    HistoryEntry getEntry(uint32_t id) const;
+
+    /**
+     * @brief Nilai sorting entry untuk field tertentu
+     * @param key Field sorting
+     * @param id ID entry
+     */
+    double sortValue(HistorySortKey key, uint32_t id) const;
+
+    // Akses langsung ke kolom (tanpa membangun HistoryEntry)
+    double wpmAt(uint32_t id) const { return wpmColumn[id]; }
+    double accuracyAt(uint32_t id) const { return accuracyColumn[id]; }
+    double timeElapsedAt(uint32_t id) const { return timeElapsedColumn[id]; }
+    int64_t epochAt(uint32_t id) const { return epochColumn[id]; }
+    int targetWpmAt(uint32_t id) const { return targetWpmColumn[id]; }
+    int errorsAt(uint32_t id) const { return errorsColumn[id]; }
+    uint16_t codesAt(uint32_t id) const { return codeColumn[id]; }
+    bool hasReplayAt(uint32_t id) const { return replayColumn[id] != 0; }
+
+    // ========================================================================
+    // REPLAY
+    // ========================================================================
+
+    /**
+     * @brief Path file replay untuk entry tertentu
+     *
+     * Nama file memakai replay ID yang disimpan di record (bukan ID entry),
+     * sehingga link tetap benar walaupun ID bergeser setelah compaction, dan
+     * dua permainan di detik yang sama tidak berbagi file.
+     */
+    std::string replayPath(uint32_t id) const;
+
+    /**
+     * @brief Membaca file replay satu entry (lazy, hanya saat dibutuhkan)
+     * @param id ID entry
+     * @param out Isi file replay
+     * @return false jika entry tidak punya replay atau file tidak bisa dibaca
+     */
+    bool loadReplay(uint32_t id, std::string& out) const;
+
+    /**
+     * @brief Entry dengan WPM tertinggi yang punya replay
+     * @param filter Filter mode/bahasa/difficulty
+     * @return ID entry, atau -1 jika tidak ada
+     *
+     * Membaca index WPM dari belakang, jadi berhenti di entry pertama yang cocok.
+     */
+    int64_t bestReplayId(const HistoryFilter& filter) const;
+
+    // ========================================================================
+    // KEY STATS
+    // ========================================================================
+
+    /**
+     * @brief Agregat KeyStats seumur pemakaian
+     * @param language "All"/"" untuk semua, atau "ID"/"EN"/"PROG"
+     *
+     * Dikembalikan by reference (tabel bigram ~256 KB tidak di-copy). Hasil
+     * "All" (KEYSTATS_SLOTS kali KeyStats::merge()) di-cache sampai ada
+     * KeyStats baru. Referensi berlaku sampai saveEntry()/loadHistory()
+     * berikutnya.
+     */
+    const KeyStats& getKeyStats(const std::string& language) const;
+
+    /**
+     * @brief Format epoch seconds ke timestamp DD/MM/YYYY HH:MM:SS (waktu lokal)
+     */
+    static std::string formatTimestamp(int64_t epoch);
+
+    // ========================================================================
+    // ENUM CODES
+    // ========================================================================
+
+    /// Kode untuk nilai yang tidak dikenal (atau filter "All")
+    static constexpr uint8_t UNKNOWN_CODE = 0xFF;
+
+    /**
+     * @brief Konversi nama difficulty ke kode byte (case-insensitive)
+     * @return 0-3 sesuai urutan enum Difficulty, atau UNKNOWN_CODE
+     */
+    static uint8_t difficultyCode(const std::string& difficulty);
+
+    /**
+     * @brief Konversi nama bahasa ("ID", "EN", "PROG") ke kode byte
+     * @return Kode bahasa, atau UNKNOWN_CODE
+     */
+    static uint8_t languageCode(const std::string& language);
+
+    /**
+     * @brief Konversi nama mode ("Manual", "Campaign") ke kode byte
+     * @return Kode mode, atau UNKNOWN_CODE
+     */
+    static uint8_t modeCode(const std::string& mode);
+
+    static std::string difficultyName(uint8_t code); ///< "Easy", "Medium", ...
+    static std::string languageName(uint8_t code);   ///< "ID", "EN", "PROG"
+    static std::string modeName(uint8_t code);       ///< "Manual", "Campaign"
+
 private:
-    std::vector<HistoryEntry> entries; ///< List semua entry history
-    std::string filename;              ///< Path ke file JSON
+    // Kolom-kolom history, diindeks dengan ID entry (urut kronologis)
+    std::vector<double> wpmColumn;          ///< WPM per entry
+    std::vector<double> accuracyColumn;     ///< Akurasi per entry
+    std::vector<double> timeElapsedColumn;  ///< Lama permainan per entry
+    std::vector<int64_t> epochColumn;       ///< Waktu permainan (epoch seconds)
+    std::vector<int32_t> targetWpmColumn;   ///< Target WPM per entry
+    std::vector<int32_t> errorsColumn;      ///< Jumlah error per entry
+    std::vector<uint16_t> codeColumn;       ///< mode | language << 4 | difficulty << 8
+    std::vector<uint64_t> replayColumn;     ///< Replay ID per entry, 0 jika tanpa replay
+
+    /// Replay ID berikutnya; selalu di atas semua ID yang pernah dimuat
+    uint64_t nextReplayId = 1;
+
+    /// Permutasi ID terurut ascending per HistorySortKey (tie: ID ascending)
+    std::array<std::vector<uint32_t>, 4> sortedIndex;
+
+    /// Agregat per (mode, bahasa, difficulty), di-update di appendRow()
+    HistoryStats stats;
+
+    /// Slot agregat KeyStats: kode bahasa 0-2, lalu satu slot bahasa lain
+    static constexpr size_t KEYSTATS_SLOTS = 4;
+
+    /// Agregat KeyStats per bahasa (lihat keyStatsSlot())
+    std::array<KeyStats, KEYSTATS_SLOTS> keyStatsByLanguage;
+
+    /// Gabungan semua slot untuk getKeyStats("All"), dibangun saat dibutuhkan
+    mutable KeyStats keyStatsAll;
+    mutable bool keyStatsAllValid = false;
+
+    std::string filename;              ///< Path ke journal binary
+    std::string keyStatsFilename;      ///< Path ke journal KeyStats
+    std::string legacyFilename;        ///< Path ke history.json lama (untuk migrasi)
     
     /**
      * @brief Helper untuk mendapatkan timestamp saat ini
      * @return String timestamp format DD/MM/YYYY HH:MM:SS
      */
     std::string getCurrentTimestamp();
+
+    /**
+     * @brief Parse timestamp DD/MM/YYYY HH:MM:SS (waktu lokal) ke epoch seconds
+     * @return Epoch seconds, atau 0 jika format tidak valid
+     */
+    static int64_t parseTimestamp(const std::string& timestamp);
+
+    /**
+     * @brief Menambahkan satu baris ke kolom-kolom history
+     * @param entry Nilai numerik entry
+     * @param codes Kode mode/bahasa/difficulty yang sudah di-pack
+     * @param updateIndices true untuk menyisipkan ID ke sortedIndex
+     *        (false saat bulk load, diikuti rebuildIndices())
+     */
+    void appendRow(const HistoryEntry& entry, uint16_t codes, bool updateIndices);
+
+    /**
+     * @brief Membangun ulang seluruh sortedIndex dari kolom
+     */
+    void rebuildIndices();
+
+    /**
+     * @brief Mengosongkan semua kolom dan index
+     */
+    void clearColumns();
+
+    /**
+     * @brief Pack kode mode/bahasa/difficulty menjadi satu uint16_t
+     */
+    static uint16_t packCodes(uint8_t mode, uint8_t language, uint8_t difficulty);
+
+    /**
+     * @brief Append satu record ke journal (membuat header jika file baru)
+     * @return true jika record berhasil ditulis
+     */
+    bool appendRecord(const HistoryEntry& entry, uint16_t codes);
+
+    /**
+     * @brief Path file di direktori yang sama dengan journal
+     */
+    std::string siblingPath(const std::string& name) const;
+
+    /**
+     * @brief Index keyStatsByLanguage untuk kode bahasa
+     */
+    static size_t keyStatsSlot(uint8_t language);
+
+    /**
+     * @brief Memuat keystats.journal ke agregat per bahasa
+     *
+     * Record rusak dibuang; jika ada, journal ditulis ulang hanya dengan
+     * record yang valid.
+     */
+    void loadKeyStats();
+
+    /**
+     * @brief Membaca history.json format lama (newest-first)
+     * @param out Output entries sesuai urutan file
+     * @return true jika file ada dan berhasil dibaca
+     */
+    bool loadLegacyJson(std::vector<HistoryEntry>& out);
 };
 
 #endif // HISTORYMANAGER_H
\ No newline at end of file
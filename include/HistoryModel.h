@@ -0,0 +1,140 @@
+/**
+ * @file HistoryModel.h
+ * @brief List model history game untuk QML ListView
+ * @author Alea Farrel & Team
+ * @date 2025
+ *
+ * HistoryModel mengekspos history sebagai QAbstractListModel sehingga
+ * ListView hanya membuat delegate untuk baris yang terlihat. Baris di-load
+ * bertahap (fetchMore) langsung dari kolom HistoryManager.
+ */
+
+#ifndef HISTORYMODEL_H
+#define HISTORYMODEL_H
+
+#include <QAbstractListModel>
+#include <QString>
+#include <QVariantMap>
+#include <cstdint>
+#include <vector>
+
+#include "HistoryManager.h"
+
+/**
+ * @class HistoryModel
+ * @brief Model history dengan sorting, filtering, dan lazy loading
+ *
+ * Model hanya menyimpan ID entry yang sudah di-load sesuai urutan query
+ * aktif. Nilai setiap role dibaca dari kolom HistoryManager saat diminta
+ * oleh delegate, sehingga tidak ada QVariantMap yang dibangun per baris.
+ *
+ * @par Contoh penggunaan di QML:
+ * @code
+ * ListView {
+ *     model: GameBackend.historyModel
+ *     delegate: Text { text: model.wpm + " WPM" }
+ * }
+ * @endcode
+ */
+class HistoryModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+    Q_PROPERTY(int totalCount READ totalCount NOTIFY totalCountChanged)
+
+public:
+    enum Roles {
+        WpmRole = Qt::UserRole + 1,
+        AccuracyRole,
+        ErrorsRole,
+        TargetWpmRole,
+        DifficultyRole,
+        LanguageRole,
+        ModeRole,
+        TimestampRole,
+        TimeElapsedRole
+    };
+    Q_ENUM(Roles)
+
+    /**
+     * @brief Constructor
+     * @param manager HistoryManager sumber data (harus hidup lebih lama dari model)
+     * @param parent QObject parent
+     */
+    explicit HistoryModel(const HistoryManager* manager, QObject* parent = nullptr);
+
+    // QAbstractListModel interface
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+    bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+
+    /**
+     * @brief Set sorting dan filter, lalu reset model
+     * @param sortBy Field untuk sorting ("date", "wpm", "accuracy", "time")
+     * @param ascending true untuk ascending, false untuk descending
+     * @param modeFilter Filter mode ("All", "Manual", "Campaign")
+     * @param languageFilter Filter bahasa ("All", "ID", "EN", "PROG")
+     * @param difficultyFilter Filter difficulty ("All", "Easy", ...)
+     */
+    Q_INVOKABLE void setQuery(const QString& sortBy, bool ascending,
+                              const QString& modeFilter = "All",
+                              const QString& languageFilter = "All",
+                              const QString& difficultyFilter = "All");
+
+    /**
+     * @brief Mendapatkan satu baris sebagai QVariantMap (untuk detail overlay)
+     * @param row Index baris
+     */
+    Q_INVOKABLE QVariantMap get(int row) const;
+
+    /**
+     * @brief Pastikan minimal count baris sudah di-load
+     *
+     * Dipakai oleh navigasi halaman yang melompat melewati baris terakhir
+     * yang sudah di-load.
+     */
+    Q_INVOKABLE void ensureLoaded(int count);
+
+    /**
+     * @brief Jumlah entry yang cocok dengan filter aktif
+     */
+    int totalCount() const;
+
+    /**
+     * @brief Memberi tahu model bahwa entry baru telah ditambahkan
+     * @param id ID entry baru di HistoryManager
+     *
+     * Jika entry cocok dengan filter dan posisinya berada di dalam baris
+     * yang sudah di-load, baris disisipkan dengan beginInsertRows().
+     */
+    void entryAppended(uint32_t id);
+
+    /**
+     * @brief Reset model dari isi HistoryManager saat ini
+     *
+     * Dipanggil setelah history di-load atau dihapus.
+     */
+    void reload();
+
+signals:
+    void totalCountChanged();
+
+private:
+    const HistoryManager* m_manager;
+    HistoryFilter m_filter;
+    HistorySortKey m_sortKey;
+    bool m_ascending;
+    std::vector<uint32_t> m_rows;  // ID entry yang sudah di-load, urut sesuai query
+    int m_totalCount;
+
+    static constexpr int FETCH_BATCH_SIZE = 20;
+
+    /**
+     * @brief Cek apakah entry a berada sebelum entry b dalam urutan query
+     */
+    bool precedes(uint32_t a, uint32_t b) const;
+};
+
+#endif // HISTORYMODEL_H
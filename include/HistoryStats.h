@@ -0,0 +1,141 @@
+/**
+ * @file HistoryStats.h
+ * @brief Statistik agregat history yang di-update secara incremental
+ * @author Alea Farrel & Team
+ * @date 2025
+ *
+ * Menyimpan running aggregate per bucket (mode, bahasa, difficulty) agar
+ * personal best, rata-rata, dan persentil WPM bisa dibaca dalam O(1)
+ * tanpa memindai seluruh history.
+ */
+
+#ifndef HISTORYSTATS_H
+#define HISTORYSTATS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct RunningMetric
+ * @brief Agregat streaming untuk satu metrik (WPM atau akurasi)
+ *
+ * Menyimpan jumlah, jumlah kuadrat, minimum, maksimum, dan exponential
+ * moving average. Mean dan standar deviasi diturunkan dari sum/sumSq.
+ */
+struct RunningMetric {
+    double sum = 0.0;     ///< Jumlah semua nilai
+    double sumSq = 0.0;   ///< Jumlah kuadrat semua nilai
+    double min = 0.0;     ///< Nilai terkecil (valid jika count > 0)
+    double max = 0.0;     ///< Nilai terbesar (valid jika count > 0)
+    double ema = 0.0;     ///< Exponential moving average (game terbaru lebih berbobot)
+
+    /**
+     * @brief Menambahkan satu nilai
+     * @param x Nilai baru
+     * @param countBefore Jumlah nilai sebelum x ditambahkan
+     */
+    void add(double x, uint32_t countBefore);
+
+    double mean(uint32_t count) const;
+    double stdDev(uint32_t count) const;
+};
+
+/**
+ * @class P2Quantile
+ * @brief Estimator persentil streaming (algoritma P² Jain & Chlamtac)
+ *
+ * Memakai 5 marker dengan memori konstan; setiap add() O(1). Sampai 5
+ * nilai pertama, persentil dihitung secara eksak.
+ */
+class P2Quantile {
+public:
+    /**
+     * @param p Persentil yang diestimasi (0.0 - 1.0), misalnya 0.9 untuk p90
+     */
+    explicit P2Quantile(double p = 0.5);
+
+    void add(double x);
+    double value() const;
+
+private:
+    double p;
+    uint32_t count;
+    std::array<double, 5> heights;   ///< Tinggi marker (q)
+    std::array<double, 5> positions; ///< Posisi aktual marker (n)
+    std::array<double, 5> desired;   ///< Posisi ideal marker (n')
+    std::array<double, 5> increment; ///< Kenaikan posisi ideal per sampel (dn')
+
+    double parabolic(int i, double d) const;
+    double linear(int i, int d) const;
+};
+
+/**
+ * @struct StatsBucket
+ * @brief Statistik lengkap satu kombinasi (mode, bahasa, difficulty)
+ */
+struct StatsBucket {
+    uint32_t count = 0;          ///< Jumlah game
+    RunningMetric wpm;           ///< Agregat WPM
+    RunningMetric accuracy;      ///< Agregat akurasi
+    P2Quantile wpmP50{0.5};      ///< Estimasi median WPM
+    P2Quantile wpmP90{0.9};      ///< Estimasi persentil 90 WPM
+
+    void add(double wpmValue, double accuracyValue);
+};
+
+/**
+ * @class HistoryStats
+ * @brief Tabel bucket statistik untuk semua kombinasi filter
+ *
+ * Setiap dimensi punya satu slot tambahan "All", sehingga query seperti
+ * "semua mode, bahasa EN, difficulty apa saja" juga hanya satu lookup.
+ * add() meng-update 8 bucket (setiap kombinasi nilai spesifik / All).
+ *
+ * @par Contoh penggunaan:
+ * @code
+ * HistoryStats stats;
+ * stats.add(codes, 72.5, 96.0);
+ * const StatsBucket& all = stats.bucket(HistoryStats::ALL, HistoryStats::ALL, HistoryStats::ALL);
+ * double best = all.wpm.max;
+ * @endcode
+ */
+class HistoryStats {
+public:
+    static constexpr uint8_t ALL = 0xFE;        ///< Slot "All" untuk satu dimensi
+    static constexpr size_t MODE_SLOTS = 3;       ///< Manual, Campaign, All
+    static constexpr size_t LANGUAGE_SLOTS = 4;   ///< ID, EN, PROG, All
+    static constexpr size_t DIFFICULTY_SLOTS = 5; ///< Easy, Medium, Hard, Programmer, All
+
+    /**
+     * @brief Menambahkan satu game ke semua bucket yang relevan
+     * @param codes Kode mode | bahasa << 4 | difficulty << 8 (nibble 0xF = tidak dikenal)
+     * @param wpm WPM game
+     * @param accuracy Akurasi game
+     *
+     * Kode yang tidak dikenal hanya dihitung di slot "All" dimensi tersebut.
+     */
+    void add(uint16_t codes, double wpm, double accuracy);
+
+    /**
+     * @brief Mendapatkan bucket untuk kombinasi kode
+     * @param mode Kode mode atau ALL
+     * @param language Kode bahasa atau ALL
+     * @param difficulty Kode difficulty atau ALL
+     * @return Bucket (kosong jika kode di luar jangkauan)
+     */
+    const StatsBucket& bucket(uint8_t mode, uint8_t language, uint8_t difficulty) const;
+
+    /**
+     * @brief Reset semua bucket
+     */
+    void clear();
+
+private:
+    std::array<StatsBucket, MODE_SLOTS * LANGUAGE_SLOTS * DIFFICULTY_SLOTS> buckets;
+
+    static size_t slot(uint8_t code, size_t slots);
+    static size_t bucketIndex(size_t mode, size_t language, size_t difficulty);
+};
+
+#endif // HISTORYSTATS_H
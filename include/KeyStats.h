@@ -0,0 +1,165 @@
+/**
+ * @file KeyStats.h
+ * @brief Statistik latency dan error per tombol dan per bigram
+ * @author Alea Farrel & Team
+ * @date 2025
+ *
+ * KeyStats mengumpulkan jeda antar keystroke dan jumlah salah ketik untuk
+ * setiap karakter ASCII dan setiap pasangan karakter (bigram) selama satu
+ * sesi. Data per permainan disimpan ringkas (hanya sel yang terisi),
+ * sedangkan agregat seumur pemakaian memakai array padat yang sama sehingga
+ * penjumlahan beberapa agregat cukup satu loop lurus per array.
+ */
+
+#ifndef KEYSTATS_H
+#define KEYSTATS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class KeyStats
+ * @brief Tabel 128 tombol + 128x128 bigram (struct of arrays)
+ *
+ * @par Layout Data
+ * Setiap tabel terdiri dari tiga array sejajar: jumlah sampel latency
+ * (u32), jumlah salah ketik (u32), dan total latency dalam mikrodetik
+ * (u64). Bigram (a, b) = tombol b diketik tepat setelah a, di index
+ * `a * KEYS + b`. sanitizeWord() sudah membatasi teks ke ASCII printable,
+ * jadi karakter di luar 0-127 cukup diabaikan.
+ *
+ * @par Aturan Pencatatan
+ * - Latency hanya dihitung untuk keystroke benar yang langsung menyusul
+ *   keystroke benar di posisi sebelumnya; jeda setelah salah ketik atau
+ *   backspace adalah waktu koreksi, bukan waktu mengetik bigram tersebut
+ * - Salah ketik selalu dihitung, pada tombol yang seharusnya diketik
+ *
+ * @par Format Serialize (little-endian)
+ * | Offset | Ukuran | Field                                   |
+ * |--------|--------|-----------------------------------------|
+ * | 0      | 4      | magic "RTKS"                            |
+ * | 4      | 2      | versi (FILE_VERSION)                    |
+ * | 6      | 2      | reserved (0)                            |
+ * | 8      | ...    | tabel tombol, lalu tabel bigram         |
+ *
+ * Setiap tabel: varint jumlah sel terisi, lalu per sel empat varint
+ * (selisih index dari sel sebelumnya, sampel, salah, total latency).
+ * Satu tes 60 detik menyentuh beberapa ratus bigram, jadi hasilnya
+ * hanya beberapa KB.
+ */
+class KeyStats {
+public:
+    static constexpr uint16_t FILE_VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 8;
+
+    static constexpr uint32_t KEYS = 128;
+    static constexpr uint32_t BIGRAMS = KEYS * KEYS;
+
+    /// Tombol sebelumnya tidak diketahui (awal teks): tidak ada bigram
+    static constexpr uint32_t NO_KEY = KEYS;
+
+    KeyStats();
+
+    /**
+     * @brief Kosongkan semua tabel
+     */
+    void clear();
+
+    /**
+     * @brief Catat keystroke benar beserta jedanya
+     * @param previous Karakter target sebelumnya (NO_KEY di awal teks)
+     * @param key Karakter target yang diketik
+     * @param intervalUs Mikrodetik sejak keystroke sebelumnya
+     */
+    void recordHit(uint32_t previous, uint32_t key, uint64_t intervalUs);
+
+    /**
+     * @brief Catat salah ketik pada karakter target key
+     */
+    void recordMiss(uint32_t previous, uint32_t key);
+
+    /**
+     * @brief Tambahkan seluruh isi other ke tabel ini
+     *
+     * Loop lurus per array tanpa percabangan, sehingga compiler dapat
+     * memvektorisasinya.
+     */
+    void merge(const KeyStats& other);
+
+    bool empty() const;
+
+    // --- Query per tombol ---
+    uint32_t keySamples(uint32_t key) const { return keyHits[key]; }
+    uint32_t keyMisses(uint32_t key) const { return keyErrors[key]; }
+    double keyMeanUs(uint32_t key) const;
+
+    // --- Query per bigram (index = a * KEYS + b) ---
+    uint32_t bigramSamples(uint32_t index) const { return bigramHits[index]; }
+    uint32_t bigramMisses(uint32_t index) const { return bigramErrors[index]; }
+    double bigramMeanUs(uint32_t index) const;
+
+    /**
+     * @brief Rata-rata latency semua keystroke yang tercatat (mikrodetik)
+     */
+    double overallMeanUs() const;
+
+    /**
+     * @brief Skor kelemahan tombol: 0 = normal, makin besar makin lemah
+     *
+     * Skor = kelambatan relatif terhadap overallMeanUs() (hanya bagian di
+     * atas rata-rata) + tingkat salah ketik dikali MISS_WEIGHT. Tombol
+     * dengan sampel + salah < minSamples bernilai 0.
+     */
+    float keyWeakness(uint32_t key, uint32_t minSamples) const;
+
+    /**
+     * @brief Skor kelemahan bigram, dengan aturan sama seperti keyWeakness()
+     */
+    float bigramWeakness(uint32_t index, uint32_t minSamples) const;
+
+    /**
+     * @brief Skor kelemahan semua bigram (ukuran BIGRAMS)
+     * @return Kosong jika belum ada sampel latency sama sekali
+     */
+    std::vector<float> weaknessWeights(uint32_t minSamples) const;
+
+    /**
+     * @brief Index bigram terlemah, urut dari skor tertinggi
+     * @param limit Jumlah maksimal hasil
+     * @param minSamples Batas sampel minimum per bigram
+     */
+    std::vector<uint32_t> weakestBigrams(size_t limit, uint32_t minSamples) const;
+
+    /**
+     * @brief Serialize ke format ringkas (hanya sel terisi)
+     */
+    std::string serialize() const;
+
+    /**
+     * @brief Tambahkan data hasil serialize() ke tabel ini
+     * @return false jika magic/versi salah, data terpotong, atau index di
+     *         luar tabel; tabel tidak diubah
+     */
+    bool accumulate(const std::string& data);
+
+    /**
+     * @brief Ganti isi tabel dengan data hasil serialize()
+     * @return false jika data rusak; isi tabel tidak diubah
+     */
+    bool deserialize(const std::string& data);
+
+private:
+    /// Bobot tingkat salah ketik terhadap kelambatan relatif
+    static constexpr float MISS_WEIGHT = 2.0f;
+
+    std::vector<uint32_t> keyHits;       ///< Sampel latency per tombol
+    std::vector<uint32_t> keyErrors;     ///< Salah ketik per tombol
+    std::vector<uint64_t> keyLatency;    ///< Total latency per tombol (us)
+
+    std::vector<uint32_t> bigramHits;    ///< Sampel latency per bigram
+    std::vector<uint32_t> bigramErrors;  ///< Salah ketik per bigram
+    std::vector<uint64_t> bigramLatency; ///< Total latency per bigram (us)
+};
+
+#endif // KEYSTATS_H
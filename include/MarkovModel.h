@@ -0,0 +1,126 @@
+/**
+ * @file MarkovModel.h
+ * @brief Model n-gram (bigram/trigram) untuk menghasilkan teks latihan yang natural
+ * @author Alea Farrel & Team
+ * @date 2025
+ *
+ * MarkovModel dibangun sekali saat loading dari korpus kalimat, lalu
+ * menghasilkan rangkaian kata dengan biaya O(1) per kata: setiap
+ * distribusi transisi disimpan sebagai Walker alias table.
+ */
+
+#ifndef MARKOVMODEL_H
+#define MARKOVMODEL_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <random>
+#include <utility>
+
+/**
+ * @class MarkovModel
+ * @brief Rantai Markov orde 2 (trigram) dengan backoff ke bigram
+ *
+ * @par Layout Data
+ * - Kata di-intern menjadi ID (u32) di satu arena karakter; ID 0 adalah
+ *   penanda awal kalimat (BOS), sehingga kata pertama juga sekadar bigram
+ * - Bigram disimpan CSR: baris kata `a` adalah edge
+ *   `[bigrams.offsets[a], bigrams.offsets[a + 1])`, masing-masing menunjuk ke
+ *   kata berikutnya atau END (akhir kalimat)
+ * - Trigram diindeks per edge bigram: konteks (a, b) adalah edge a -> b,
+ *   dan barisnya berisi index edge b -> c. State rantai cukup satu index
+ *   edge, sehingga transisi tidak memerlukan lookup hash sama sekali
+ * - Setiap baris punya alias table (threshold u32 + alias lokal) sejajar
+ *   dengan entry-nya
+ *
+ * Model tidak mengetahui Difficulty; TextProvider membangun satu model per
+ * difficulty dari kalimat yang sudah difilter.
+ */
+class MarkovModel {
+public:
+    /// State awal / setelah akhir kalimat: kata berikutnya adalah awal kalimat
+    static constexpr uint32_t NO_STATE = UINT32_MAX;
+
+    /**
+     * @brief Membangun tabel transisi dari kalimat-kalimat korpus
+     * @param sentences Kalimat sebagai daftar kata (sudah di-sanitize dan difilter)
+     *
+     * Data lama dibuang. Kalimat kosong diabaikan.
+     */
+    void build(const std::vector<std::vector<std::string>>& sentences);
+
+    /**
+     * @brief Cek apakah model berisi minimal satu kalimat
+     */
+    bool empty() const { return bigrams.values.empty(); }
+
+    /**
+     * @brief Jumlah kata unik di model
+     */
+    uint32_t vocabularySize() const {
+        return wordOffsets.empty() ? 0 : static_cast<uint32_t>(wordOffsets.size()) - 1;
+    }
+
+    /**
+     * @brief Menghasilkan kata-kata berikutnya dari rantai
+     * @param count Jumlah kata yang diinginkan
+     * @param rng Generator random milik pemanggil
+     * @param state State rantai (NO_STATE untuk mulai dari awal kalimat);
+     *              diperbarui agar pemanggilan berikutnya melanjutkan teks
+     * @return View ke arena milik model; kosong jika model kosong
+     */
+    std::vector<std::string_view> generate(int count, std::mt19937& rng, uint32_t& state) const;
+
+private:
+    /// ID kata semu "awal kalimat"; barisnya adalah distribusi kata pertama
+    static constexpr uint32_t BOS_WORD = 0;
+
+    /// Target bigram untuk akhir kalimat
+    static constexpr uint32_t END_WORD = UINT32_MAX;
+
+    /// Peluang (dari 2^32) memakai bigram walaupun konteks trigram tersedia
+    static constexpr uint32_t BIGRAM_BACKOFF = 0x40000000u;  // 25%
+
+    /**
+     * @struct AliasRows
+     * @brief Kumpulan alias table yang disimpan CSR
+     *
+     * Entry baris r ada di `[offsets[r], offsets[r + 1])`. Untuk mengambil
+     * sampel, pilih kolom k seragam lalu ambil k jika koin < threshold[k],
+     * atau alias[k] jika tidak (keduanya index lokal dalam baris).
+     */
+    struct AliasRows {
+        std::vector<uint32_t> offsets;    ///< Awal tiap baris (ukuran: baris + 1)
+        std::vector<uint32_t> values;     ///< Isi entry (ID kata atau index edge)
+        std::vector<uint32_t> threshold;  ///< Peluang mempertahankan kolom (dari 2^32)
+        std::vector<uint32_t> alias;      ///< Kolom pengganti (index lokal)
+
+        /**
+         * @brief Tambahkan satu baris dari pasangan (value, bobot)
+         */
+        void appendRow(const std::vector<std::pair<uint32_t, uint32_t>>& weighted);
+
+        /**
+         * @brief Ambil index global entry terpilih dari baris r (O(1))
+         * @pre Baris r tidak kosong
+         */
+        uint32_t sample(uint32_t row, std::mt19937& rng) const;
+
+        bool rowEmpty(uint32_t row) const { return offsets[row] == offsets[row + 1]; }
+    };
+
+    std::string arena;                   ///< Karakter semua kata unik
+    std::vector<uint32_t> wordOffsets;   ///< Awal kata di arena (per ID)
+    std::vector<uint16_t> wordLengths;   ///< Panjang kata (per ID)
+
+    AliasRows bigrams;                   ///< Baris per kata, value = ID kata / END_WORD
+    AliasRows trigrams;                  ///< Baris per edge bigram, value = index edge
+
+    std::string_view word(uint32_t id) const {
+        return std::string_view(arena.data() + wordOffsets[id], wordLengths[id]);
+    }
+};
+
+#endif // MARKOVMODEL_H
@@ -13,6 +13,11 @@
 #include <QUuid>
 #include <QQmlEngine>
 #include <QDataStream>
+#include <QHash>
+#include <QElapsedTimer>
+#include <QHostAddress>
+
+#include "PlayersModel.h"
 
 /**
  * @brief NetworkManager handles P2P Full Mesh multiplayer for Rapid Texter.
@@ -22,9 +27,32 @@
  * - Transport: TCP (Reliable State Sync)
  * - Authority: Lowest UUID Rule (Deterministic)
  * 
+ * Optional star topology (starTopology = true, chosen by the host before
+ * anyone joins): guests connect only to the room creator, which relays the
+ * roster (PEER_LIST) and fans out one aggregated STATE_SNAPSHOT per progress
+ * tick. This keeps connections and traffic linear in the player count, so
+ * star rooms allow up to MAX_STAR_PLAYERS.
+ * 
  * Ports:
  * - 52766: UDP Broadcast for discovery
  * - 52765: TCP for mesh connections
+ * - Ephemeral UDP: per-room data channel (port exchanged in HELLO) carrying
+ *   PROGRESS_UPDATE / STATE_SNAPSHOT as sequence-numbered datagrams. These
+ *   are superseded every tick, so losing one is cheaper than TCP
+ *   head-of-line blocking. All other packets stay on TCP.
+ * 
+ * Wire format: every TCP frame is a 4-byte big-endian length followed by
+ * the packet body. The body is either compact JSON (first byte '{') or the
+ * binary encoding (first byte 0x80 | WIRE_VERSION). Binary is only used
+ * towards peers that advertised it in their HELLO; HELLO itself is always
+ * JSON so older clients keep working.
+ * 
+ * Race text: HELLO also carries the peer's word bank hashes. When the text
+ * came from refreshGameText() and a peer's bank for the game language
+ * matches ours, GAME_TEXT / READY_CHECK carry only {seed, difficulty,
+ * wordCount, bankHash} and the peer regenerates the text locally
+ * (TextProvider::getSeededWords). Everyone else gets the full text, and a
+ * peer that still cannot reproduce it answers with TEXT_REQUEST.
  */
 class NetworkManager : public QObject {
     Q_OBJECT
@@ -42,6 +70,7 @@ class NetworkManager : public QObject {
     Q_PROPERTY(QString playerId READ playerId CONSTANT)
     Q_PROPERTY(QString playerName READ playerName WRITE setPlayerName NOTIFY playerNameChanged)
     Q_PROPERTY(QVariantList players READ players NOTIFY playersChanged)
+    Q_PROPERTY(PlayersModel* playersModel READ playersModel CONSTANT)
     Q_PROPERTY(QVariantList discoveredRooms READ discoveredRooms NOTIFY discoveredRoomsChanged)
     Q_PROPERTY(QString gameText READ gameText NOTIFY gameTextChanged)
     Q_PROPERTY(QString gameLanguage READ gameLanguage NOTIFY gameLanguageChanged)
@@ -51,12 +80,23 @@ class NetworkManager : public QObject {
     Q_PROPERTY(bool isConnecting READ isConnecting NOTIFY connectingChanged)
     Q_PROPERTY(QString selectedInterface READ selectedInterface WRITE setSelectedInterface NOTIFY selectedInterfaceChanged)
     Q_PROPERTY(bool isWaitingForReady READ isWaitingForReady NOTIFY waitingForReadyChanged)
+    Q_PROPERTY(bool starTopology READ starTopology WRITE setStarTopology NOTIFY topologyChanged)
+    Q_PROPERTY(int maxPlayers READ maxPlayers NOTIFY topologyChanged)
+    Q_PROPERTY(double hostRttMs READ hostRttMs NOTIFY timeSyncChanged)
+    Q_PROPERTY(double hostClockOffsetMs READ hostClockOffsetMs NOTIFY timeSyncChanged)
     Q_PROPERTY(QVariantList rankings READ rankings NOTIFY rankingsChanged)
     
 public:
     static NetworkManager* instance();
     static NetworkManager* create(QQmlEngine* engine, QJSEngine* scriptEngine);
     
+    // Standalone instance next to (or instead of) the QML singleton, for
+    // headless tools such as rapidtexter_loadtest. tcpPort 0 picks a free
+    // port; without discovery the shared UDP discovery port is never bound
+    // and rooms are not announced.
+    NetworkManager(quint16 tcpPort, bool discovery, QObject* parent = nullptr);
+    ~NetworkManager();
+    
     // === PACKET TYPES ===
     enum class PacketType : quint8 {
         HELLO = 0,
@@ -72,19 +112,32 @@ public:
         READY_RESPONSE,
         PLAY_AGAIN_INVITE,    // Host invites guests to play again
         PLAY_AGAIN_RESPONSE,  // Guest accepts/declines invitation
-        KICK                  // Host kicks a player
+        KICK,                 // Host kicks a player
+        STATE_SNAPSHOT,       // Star mode: host's aggregated player states
+        TIME_PING,            // Guest -> host clock sync request
+        TIME_PONG,            // Host -> guest clock sync reply
+        TEXT_REQUEST          // Guest -> host: seeded text did not reproduce, send it in full
     };
     Q_ENUM(PacketType)
     
+    // === WIRE FORMAT ===
+    static constexpr quint8 WIRE_VERSION = 1;   // Binary encoding version advertised in HELLO
+    static constexpr quint8 NO_INDEX = 0xFF;    // Room index not (yet) assigned
+    
     // === PACKET STRUCTURE ===
     struct Packet {
-        PacketType type;
-        QString senderUuid;
-        qint64 timestamp;
+        PacketType type = PacketType::HELLO;
+        QString senderUuid;             // Empty for binary packets until resolved from senderIndex
+        quint8 senderIndex = NO_INDEX;  // Room index of the sender (binary packets only)
+        qint64 timestamp = 0;
         QJsonObject payload;
+        bool valid = false;             // False if the frame could not be decoded
         
-        QByteArray serialize() const;
-        static Packet deserialize(const QByteArray& data);
+        QByteArray serialize() const;                           // JSON body, length-prefixed
+        QByteArray serializeBinary(quint8 index) const;         // Binary body, length-prefixed
+        QByteArray jsonBody() const;                            // JSON body, unframed
+        QByteArray binaryBody(quint8 index) const;              // Binary body, unframed
+        static Packet deserialize(const QByteArray& data);      // Detects JSON or binary body
     };
     
     // === ROOM FUNCTIONS ===
@@ -126,10 +179,13 @@ public:
     bool isInGame() const { return m_isInGame; }
     bool isInLobby() const { return m_isInLobby; }
     bool isWaitingForReady() const { return m_isWaitingForReady; }
+    bool starTopology() const { return m_starTopology; }
+    int maxPlayers() const { return m_starTopology ? MAX_STAR_PLAYERS : MAX_MESH_PLAYERS; }
     QString localIpAddress() const;
     QString playerId() const { return m_playerId; }
     QString playerName() const { return m_playerName; }
     QVariantList players() const;
+    PlayersModel* playersModel() const { return m_playersModel; }  // Stable rows for race lanes
     QVariantList discoveredRooms() const;
     QString gameText() const { return m_gameText; }
     QString gameLanguage() const { return m_gameLanguage; }
@@ -139,8 +195,26 @@ public:
     QVariantList rankings() const { return m_rankings; }
     bool isConnecting() const { return m_isConnecting; }
     QString selectedInterface() const { return m_selectedInterface; }
+    quint16 serverPort() const;  // Mesh TCP port (0 while no server is running)
     
     void setPlayerName(const QString& name);
+    void setStarTopology(bool star);  // Only while no peers are connected
+    
+    // Per-peer statistics: name, uuid, queuedBytes, unsentBytes (socket
+    // buffer, i.e. backpressure), bytesSent, packetsSent, datagramBytesSent,
+    // datagramsSent (data channel), maxBatch, rttMs, clockOffsetMs
+    Q_INVOKABLE QVariantList peerStats() const;
+    
+    // Clock sync with the host (measured during READY_CHECK; 0 on the host)
+    double hostRttMs() const { return m_hostRttUs / 1000.0; }
+    double hostClockOffsetMs() const { return m_hostClockOffsetUs / 1000.0; }
+    
+    // Milliseconds until the synchronized race start (3000 if none scheduled)
+    Q_INVOKABLE int msUntilRaceStart() const;
+    
+    // Largest accepted TCP frame body; peers sending more are disconnected
+    void setMaxFrameSize(quint32 bytes);
+    quint32 maxFrameSize() const { return m_maxFrameBytes; }
     Q_INVOKABLE void setSelectedInterface(const QString& ip);
     
 signals:
@@ -158,6 +232,8 @@ signals:
     void connectionErrorChanged();
     void peersChanged();
     void waitingForReadyChanged();
+    void topologyChanged();
+    void timeSyncChanged();
     void allPlayersReady();
     void rankingsChanged();
     
@@ -188,7 +264,6 @@ signals:
     
 private:
     explicit NetworkManager(QObject* parent = nullptr);
-    ~NetworkManager();
     
     static NetworkManager* s_instance;
     
@@ -197,8 +272,16 @@ private:
     static constexpr int TCP_PORT = 52765;
     static constexpr int ANNOUNCE_INTERVAL_MS = 1000;  // 1 second as per blueprint
     static constexpr int ROOM_TIMEOUT_MS = 5000;
-    static constexpr int PROGRESS_UPDATE_MS = 50;  // 50ms for real-time fairness
-    static constexpr int MAX_PLAYERS = 8;
+    static constexpr int PROGRESS_UPDATE_MS = 100;  // Fastest rate (10 Hz); lanes are interpolated
+    static constexpr int PROGRESS_MAX_INTERVAL_MS = 500;   // Slowest rate while typing
+    static constexpr int PROGRESS_HEARTBEAT_MS = 1000;     // Resend when idle
+    static constexpr int PROGRESS_DATAGRAM_BUDGET = 200;   // Progress datagrams/s across all peers
+    static constexpr int MAX_MESH_PLAYERS = 8;    // Full mesh: N-1 sockets per client
+    static constexpr int MAX_STAR_PLAYERS = 32;   // Star: host relays everything
+    static constexpr int RECONNECT_GRACE_MS = 5000;  // Star: time for guests to reach a new host
+    static constexpr qint64 BACKPRESSURE_WARN_BYTES = 64 * 1024;  // Unsent bytes before warning
+    static constexpr quint32 DEFAULT_MAX_FRAME_BYTES = 1024 * 1024;  // Larger length prefix = corrupt stream
+    static constexpr qsizetype READ_COMPACT_BYTES = 16 * 1024;      // Dead prefix before compacting
     inline static const char* APP_IDENTIFIER = "RapidTexterP2P";
     
     // === STATE ===
@@ -212,20 +295,47 @@ private:
     QString m_playerName;
     QString m_gameText;
     QString m_gameLanguage = "en";  // Default language
+    
+    // What m_gameText was generated from; seeded = false for custom text
+    // (setGameText), which always goes out in full
+    struct TextSeed {
+        bool seeded = false;
+        quint64 seed = 0;
+        QString difficulty;
+        int wordCount = 0;
+    };
+    TextSeed m_textSeed;
     QString m_connectionError;
     bool m_isConnecting = false;
     QString m_pendingJoinIp;
     int m_pendingJoinPort = 0;
     QString m_selectedInterface;  // Selected interface IP for broadcasting
+    QHostAddress m_broadcastAddress;  // Resolved for m_selectedInterface (null = all)
     QString m_hostUuid;           // UUID of the room creator/host
+    bool m_starTopology = false;  // Guests connect only to the host
     
     // Ready check state
     bool m_isWaitingForReady = false;
     QMap<QString, bool> m_playersReady;
     QTimer* m_readyCheckTimer = nullptr;
     
-    // Race timing - host records start time for synchronized duration calculation
+    // Race timing - race start instant on the host clock (ms), scheduled by
+    // COUNTDOWN so every client starts at the same moment
     qint64 m_raceStartTime = 0;
+    QTimer* m_raceStartTimer = nullptr;
+    
+    // Clock sync: a monotonic microsecond clock anchored to wall time, plus
+    // the NTP-style offset to the host clock measured in READY_CHECK
+    QElapsedTimer m_clock;
+    qint64 m_clockEpochUs = 0;
+    qint64 m_hostClockOffsetUs = 0;   // host = local + offset
+    qint64 m_hostRttUs = 0;
+    int m_timeSyncRemaining = 0;      // Pings left in the current sync round
+    QTimer* m_timeSyncTimer = nullptr;
+    static constexpr int TIME_SYNC_SAMPLES = 5;
+    static constexpr int TIME_SYNC_SPACING_MS = 20;
+    static constexpr int TIME_SYNC_TIMEOUT_MS = 1000;  // Answer READY_CHECK anyway after this
+    static constexpr int COUNTDOWN_MS = 3000;
     
     // === TCP (Mesh) ===
     QTcpServer* m_tcpServer = nullptr;
@@ -239,12 +349,57 @@ private:
         int port = 0;
         bool handshakeComplete = false;
         QByteArray readBuffer;
+        qsizetype readOffset = 0;           // Start of unparsed data in readBuffer
+        int wireVersion = 0;                // Binary version the peer understands (0 = JSON only)
+        quint8 index = NO_INDEX;            // Peer's room index
+        quint8 assignedIndex = NO_INDEX;    // Index we handed out in our HELLO (host only)
+        quint16 udpPort = 0;                // Peer's data channel port (0 = TCP only)
+        QHostAddress udpAddress;
+        quint32 lastUdpSeq = 0;             // Newest datagram sequence seen from this peer
+        bool hasUdpSeq = false;
+        
+        // Outbound queue, written once per event-loop iteration
+        QByteArray outQueue;
+        int queuedPackets = 0;
+        int maxQueuedPackets = 0;           // Largest batch seen
+        quint64 bytesSent = 0;
+        quint64 packetsSent = 0;
+        quint64 datagramBytesSent = 0;      // Data channel (UDP) traffic
+        quint64 datagramsSent = 0;
+        bool backpressureWarned = false;
+        
+        // Clock sync (guest: measured against this host; host: reported by guest)
+        qint64 rttUs = -1;                  // Best round trip (-1 = not measured)
+        qint64 clockOffsetUs = 0;           // Host clock minus guest clock
+        
+        // Seeded race text
+        QJsonObject bankHashes;             // Word bank hashes from HELLO (language -> hex)
+        bool needsFullText = false;         // Sent TEXT_REQUEST: never send this peer a seed again
     };
     QMap<QString, PeerConnection*> m_peers;  // UUID -> PeerConnection
+    QHash<QTcpSocket*, PeerConnection*> m_peerBySocket;  // O(1) lookup in socket slots
     QSet<QString> m_pendingConnections;       // IP:Port being connected to (prevent duplicates)
     
+    // Room indices replace the 36-char UUID in binary packets. The host is
+    // index 0 and hands out the rest in its HELLO. A peer keeps its index
+    // for the whole session, also across a star host migration.
+    quint8 m_localIndex = NO_INDEX;
+    quint8 m_nextPeerIndex = 1;
+    QHash<quint8, QString> m_indexToUuid;     // Room index -> UUID
+    void setLocalIndex(quint8 index);         // Also updates our own PlayerInfo
+    
+    // === UDP DATA CHANNEL ===
+    static constexpr quint8 DATAGRAM_MAGIC = 0xD7;  // [magic][u32 LE seq][packet body]
+    QUdpSocket* m_dataSocket = nullptr;
+    quint32 m_udpSendSeq = 0;
+    
+    quint32 m_maxFrameBytes = DEFAULT_MAX_FRAME_BYTES;
+    bool m_flushScheduled = false;  // flushOutgoing() queued for this event-loop iteration
+    
     // === UDP DISCOVERY ===
-    QUdpSocket* m_discoverySocket = nullptr;
+    quint16 m_tcpPort = TCP_PORT;   // Mesh server port (0 = any free port)
+    bool m_discoveryEnabled = true;
+    QUdpSocket* m_discoverySocket = nullptr;  // Null when discovery is disabled
     QTimer* m_announceTimer = nullptr;
     QTimer* m_cleanupTimer = nullptr;
     QTimer* m_connectionTimeoutTimer = nullptr;
@@ -262,8 +417,12 @@ private:
         int racePosition = 0;
         qint64 finishTime = 0;
         int duration = 0;  // Actual race duration in seconds
+        QString ip;        // Star mode: where to reach this player if it becomes host
+        int port = 0;
+        quint8 index = NO_INDEX;
     };
     QMap<QString, PlayerInfo> m_players;
+    PlayersModel* m_playersModel = nullptr;  // Coalesced view of m_players
     
     struct RoomInfo {
         QString hostName;
@@ -271,11 +430,23 @@ private:
         QString hostUuid;
         int port = 0;
         int playerCount = 0;
+        int maxPlayers = MAX_MESH_PLAYERS;
         QString status;  // "waiting", "countdown", "racing"
         qint64 lastSeen = 0;
     };
     QMap<QString, RoomInfo> m_discoveredRooms;  // UUID -> RoomInfo
     
+    // Serialized announce, rebuilt only when one of the advertised fields changes
+    struct AnnounceCache {
+        QByteArray datagram;
+        QString name;
+        int playerCount = -1;
+        int maxPlayers = 0;
+        bool racing = false;
+        quint16 port = 0;
+    };
+    AnnounceCache m_announceCache;
+    
     // Local player state
     int m_currentPosition = 0;
     int m_currentTotal = 0;
@@ -284,8 +455,12 @@ private:
     int m_finishedCount = 0;
     QVariantList m_rankings;
     
-    // Progress timer
-    QTimer* m_progressTimer = nullptr;
+    // Progress sending: event-driven, paced by progressIntervalMs()
+    QTimer* m_progressTimer = nullptr;   // Single shot: next allowed send or heartbeat
+    qint64 m_lastProgressSendMs = 0;     // m_clock time of the last send
+    bool m_progressDirty = false;        // Something changed since the last send
+    int m_sentTotal = 0;                 // Total already delivered this race (0 = not yet)
+    bool m_warnedUnknownSender = false;  // Progress from an unknown player logged once per room
     
     // === PRIVATE METHODS ===
     
@@ -294,9 +469,18 @@ private:
     void startAnnouncing();
     void stopAnnouncing();
     void sendAnnounce();
+    void resolveBroadcastAddress();
     void processDiscoveryDatagram();
     void cleanupStaleRooms();
     
+    // UDP data channel
+    void openDataChannel();
+    void closeDataChannel();
+    void processDataDatagrams();
+    // UDP where negotiated, TCP otherwise. binaryPacket (optional) is what
+    // binary peers get instead, e.g. without fields they already know.
+    void broadcastUnreliable(const Packet& packet, const Packet* binaryPacket = nullptr);
+    
     // TCP Mesh
     void startTcpServer();
     void stopTcpServer();
@@ -313,10 +497,22 @@ private:
     void handlePeerList(const Packet& packet);
     void connectToMissingPeers(const QJsonArray& peerList);
     
+    // Star topology
+    void broadcastRoster();
+    void applyRoster(const QJsonArray& peerList);
+    void broadcastStateSnapshot();
+    void handleStateSnapshot(const Packet& packet);
+    void pruneUnconnectedPlayers();
+    
     // Packet Handling
     void processPacket(PeerConnection* peer, const Packet& packet);
-    void broadcastToAllPeers(const Packet& packet);
+    void broadcastToAllPeers(const Packet& packet, const Packet* binaryPacket = nullptr);
     void sendToPeer(PeerConnection* peer, const Packet& packet);
+    void enqueue(PeerConnection* peer, const QByteArray& data);
+    void flushOutgoing();                  // Writes every peer's queue (coalesced)
+    void flushPeer(PeerConnection* peer);  // Writes one peer's queue now (before closing)
+    void configureSocket(QTcpSocket* socket);
+    bool usesBinaryWire(const PeerConnection* peer, const Packet& packet) const;
     Packet createPacket(PacketType type, const QJsonObject& payload = {});
     
     // Authority (room creator based)
@@ -326,13 +522,32 @@ private:
     void handleGameStart(const Packet& packet);
     void handleProgressUpdate(PeerConnection* peer, const Packet& packet);
     void handleFinish(PeerConnection* peer, const Packet& packet);
-    void handleGameText(const Packet& packet);
+    void handleGameText(PeerConnection* peer, const Packet& packet);
+    void handleTextRequest(PeerConnection* peer);
+    QJsonObject gameTextPayload(const PeerConnection* peer) const;  // Seed or full text for this peer
+    void sendGameText(PacketType type);                             // GAME_TEXT / READY_CHECK to every peer
+    bool applyGameText(PeerConnection* from, const QJsonObject& payload);  // False: TEXT_REQUEST sent
     void handleCountdown(const Packet& packet);
     void handlePlayerLeft(const Packet& packet);
     void handleRaceResults(const Packet& packet);
-    void handleReadyCheck(const Packet& packet);
+    void handleReadyCheck(PeerConnection* peer, const Packet& packet);
     void handleReadyResponse(const Packet& packet);
-    void sendProgressUpdate();
+    void sendReadyResponse();
+    
+    // Clock sync
+    qint64 localClockUs() const;
+    qint64 hostClockMs() const;
+    void startTimeSync();
+    void sendTimePing();
+    void handleTimePing(PeerConnection* peer, const Packet& packet);
+    void handleTimePong(PeerConnection* peer, const Packet& packet);
+    void finishTimeSync();
+    void startLocalRace();      // Race start instant reached
+    void rankFinishers();       // racePosition by host-clock finish time
+    void sendProgressUpdate();  // Timer: send if dirty, or heartbeat
+    void scheduleProgressSend();
+    void sendProgressNow(bool reliable);
+    int progressIntervalMs() const;
     void checkRaceCompletion();
     void beginCountdown();  // Actually start countdown after ready check
     void onReadyCheckTimeout();
@@ -347,6 +562,11 @@ private:
     void resetState();
     QString getPeerKey(const QString& ip, int port) const;
     void removePeer(const QString& uuid);
+    bool isHostPlayer(const QString& uuid) const;
+    
+    // Players model sync
+    void stagePlayer(const QString& uuid);   // Hot path: one player changed
+    void syncPlayersModel();                 // Full sync after playersChanged/authorityChanged
 };
 
 #endif // NETWORKMANAGER_H
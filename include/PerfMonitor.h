@@ -0,0 +1,161 @@
+#ifndef PERFMONITOR_H
+#define PERFMONITOR_H
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMetaEnum>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+#include <QVariantMap>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "SpscRing.h"
+
+class QQuickWindow;
+
+/**
+ * @brief Log-linear latency histogram (HDR-style), microsecond values.
+ *
+ * Each power of two is split into 16 linear sub-buckets, so any recorded
+ * value is reported within 6.25% while the whole range (1 us to hours)
+ * fits in a few hundred counters. record() is O(1) and allocation-free.
+ */
+class LatencyHistogram {
+public:
+    void record(uint64_t valueUs);
+    void reset();
+
+    uint64_t count() const { return m_count; }
+    uint64_t maxUs() const { return m_max; }
+    double meanUs() const { return m_count ? double(m_sum) / double(m_count) : 0.0; }
+    uint64_t percentileUs(double quantile) const;
+
+    // count, mean, p50, p90, p99, max (milliseconds)
+    QVariantMap summary() const;
+
+private:
+    static constexpr int SUB_BITS = 4;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BITS;
+    static constexpr int MAX_BIT = 36;  // Values clamp at ~19 hours
+    static constexpr int BUCKETS = (MAX_BIT - SUB_BITS + 2) * SUB_BUCKETS;
+
+    static int bucketOf(uint64_t valueUs);
+    static uint64_t bucketMidpoint(int bucket);
+
+    std::array<uint32_t, BUCKETS> m_buckets{};
+    uint64_t m_count = 0;
+    uint64_t m_sum = 0;
+    uint64_t m_max = 0;
+};
+
+/**
+ * @brief Latency instrumentation behind the performance overlay.
+ *
+ * Records keystroke-to-frame-swap latency, frame intervals, per-PacketType
+ * dispatch time in NetworkManager::processPacket and peer round trips.
+ * Samples go into lock-free rings (the render thread produces frame
+ * samples) and are drained on the GUI thread into histograms and, when
+ * started with --perf-log, a CSV file.
+ *
+ * When disabled nothing is recorded: C++ call sites test active() (one
+ * relaxed atomic load), QML tests the enabled property, and the window's
+ * frameSwapped signal is disconnected.
+ */
+class PerfMonitor : public QObject {
+    Q_OBJECT
+
+    Q_PROPERTY(bool enabled READ enabled WRITE setEnabled NOTIFY enabledChanged)
+    Q_PROPERTY(QVariantMap stats READ stats NOTIFY statsChanged)
+
+public:
+    enum Metric : quint8 {
+        KeyToFrame = 0,
+        FrameInterval,
+        PacketDispatch,
+        PeerRtt,
+        MetricCount
+    };
+
+    static PerfMonitor* instance();
+
+    // Cheap hot-path check for C++ call sites
+    static bool active() { return s_active.load(std::memory_order_relaxed); }
+
+    // Monotonic microseconds since the monitor was created
+    qint64 nowUs() const { return m_clock.nsecsElapsed() / 1000; }
+
+    bool enabled() const { return active(); }
+    void setEnabled(bool enabled);
+
+    // Measure frame swaps of this window (called once from main.cpp)
+    void attachWindow(QQuickWindow* window);
+
+    // Write every sample to a CSV file; enables the monitor
+    bool setLogFile(const QString& path);
+
+    // Recording (no-ops unless active)
+    Q_INVOKABLE void markKeystroke();
+    void recordPacketDispatch(quint8 packetType, qint64 elapsedUs);
+    void recordRtt(qint64 rttUs);
+
+    // Names for PacketDispatch keys; registered by NetworkManager
+    void setPacketTypes(const QMetaEnum& packetTypes);
+
+    Q_INVOKABLE void reset();
+    QVariantMap stats() const { return m_stats; }
+
+    // Move pending samples into the histograms and the CSV log
+    void flush();
+
+signals:
+    void enabledChanged();
+    void statsChanged();
+
+private:
+    explicit PerfMonitor(QObject* parent = nullptr);
+    ~PerfMonitor();
+
+    static constexpr int DRAIN_INTERVAL_MS = 250;
+    static constexpr int STATS_EVERY_DRAINS = 2;  // Overlay refresh every 500 ms
+    static constexpr int MAX_PACKET_TYPES = 32;
+
+    struct Sample {
+        qint64 timeUs;
+        quint32 valueUs;
+        quint8 metric;
+        quint8 key;  // PacketType for PacketDispatch
+    };
+
+    static std::atomic<bool> s_active;
+
+    QElapsedTimer m_clock;
+    SpscRing<Sample, 4096> m_guiRing;     // Producer: GUI thread
+    SpscRing<Sample, 1024> m_renderRing;  // Producer: scene graph render thread
+    std::atomic<qint64> m_pendingKeyUs{0};  // Oldest keystroke not yet on screen
+    std::atomic<qint64> m_lastSwapUs{0};
+
+    std::array<LatencyHistogram, MetricCount> m_histograms;
+    std::array<LatencyHistogram, MAX_PACKET_TYPES> m_packetHistograms;
+    QVariantMap m_stats;
+    int m_drainCount = 0;
+    quint64 m_dropped = 0;
+
+    QPointer<QQuickWindow> m_window;
+    QMetaObject::Connection m_swapConnection;
+    QTimer m_drainTimer;
+    QFile m_log;
+    QMetaEnum m_packetTypes;
+
+    void onFrameSwapped();  // Render thread
+    void updateStats();
+    template <uint32_t N>
+    void push(SpscRing<Sample, N>& ring, Metric metric, qint64 valueUs, quint8 key = 0);
+    static const char* metricName(quint8 metric);
+    QByteArray packetTypeName(quint8 packetType) const;  // Number if unregistered
+};
+
+#endif // PERFMONITOR_H
@@ -0,0 +1,135 @@
+/**
+ * @file PersistenceService.h
+ * @brief Layanan penulisan file data (settings, progress, history) di background
+ * @author Alea Farrel & Team
+ * @date 2025
+ *
+ * Semua penulisan file data aplikasi melewati PersistenceService:
+ * - Penulisan berulang ke file yang sama dalam jendela debounce digabung
+ * - Serialisasi dan I/O berjalan di satu worker thread, bukan GUI thread
+ * - File ditulis ke .tmp, di-sync, lalu di-rename (crash-safe)
+ * - flush() dipanggil saat aplikasi keluar agar tidak ada data yang hilang
+ */
+
+#ifndef PERSISTENCESERVICE_H
+#define PERSISTENCESERVICE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @class PersistenceService
+ * @brief Singleton antrian penulisan file dengan satu worker thread
+ *
+ * Dua jenis operasi per file:
+ * - scheduleWrite(): tulis ulang seluruh file. Serializer menangkap snapshot
+ *   data (by value) dan dipanggil di worker thread. Jika file yang sama
+ *   dijadwalkan lagi sebelum ditulis, hanya snapshot terakhir yang ditulis.
+ * - scheduleAppend(): tambahkan byte ke akhir file (journal history).
+ *   Append yang datang sebelum scheduleWrite() dianggap sudah termasuk di
+ *   snapshot dan dibuang; append sesudahnya ditulis setelah write tersebut.
+ * - scheduleRemove(): hapus file. Write/append yang masih tertunda untuk
+ *   file itu dibatalkan, dan yang sedang ditulis selesai lebih dulu.
+ *
+ * Semua method thread-safe.
+ */
+class PersistenceService {
+public:
+    /// Menghasilkan isi file; dipanggil di worker thread
+    using Serializer = std::function<std::string()>;
+
+    /// Jendela debounce default untuk scheduleWrite()
+    static constexpr int DEFAULT_DEBOUNCE_MS = 300;
+
+    /**
+     * @brief Instance tunggal (worker thread dibuat saat pertama dipakai)
+     */
+    static PersistenceService& instance();
+
+    /**
+     * @brief Path direktori data aplikasi sesuai platform
+     * @return Path dengan trailing separator, atau string kosong jika gagal
+     *
+     * - Windows: %APPDATA%\\RapidTexter\\
+     * - Linux/macOS: $XDG_DATA_HOME/RapidTexter/ atau ~/.local/share/RapidTexter/
+     *
+     * Direktori otomatis dibuat jika belum ada.
+     */
+    static std::string dataDirectory();
+
+    /**
+     * @brief Rename file secara atomik (menimpa target jika ada)
+     */
+    static bool replaceFile(const std::string& from, const std::string& to);
+
+    /**
+     * @brief Jadwalkan penulisan ulang seluruh file
+     * @param path Path file tujuan
+     * @param serializer Penghasil isi file (harus menangkap snapshot by value)
+     * @param debounceMs Penundaan maksimal sebelum ditulis (0 = secepatnya)
+     */
+    void scheduleWrite(const std::string& path, Serializer serializer,
+                       int debounceMs = DEFAULT_DEBOUNCE_MS);
+
+    /**
+     * @brief Jadwalkan append ke akhir file (tanpa debounce)
+     * @param path Path file tujuan
+     * @param bytes Data yang di-append
+     * @param headerIfEmpty Ditulis lebih dulu jika file belum ada atau kosong
+     */
+    void scheduleAppend(const std::string& path, std::string bytes,
+                        std::string headerIfEmpty = std::string());
+
+    /**
+     * @brief Jadwalkan penghapusan file (tanpa debounce)
+     * @param path Path file yang dihapus; file yang tidak ada bukan error
+     */
+    void scheduleRemove(const std::string& path);
+
+    /**
+     * @brief Tulis semua operasi yang tertunda dan tunggu sampai selesai
+     * @return false jika ada penulisan yang gagal sejak flush() dipanggil
+     */
+    bool flush();
+
+    PersistenceService(const PersistenceService&) = delete;
+    PersistenceService& operator=(const PersistenceService&) = delete;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /// Operasi tertunda untuk satu file
+    struct PendingFile {
+        Serializer serializer;      ///< Write tertunda (kosong jika tidak ada)
+        Clock::time_point due;      ///< Kapan write boleh dijalankan
+        std::string appendBytes;    ///< Append tertunda (setelah write)
+        std::string appendHeader;   ///< Header untuk file append yang baru
+        bool remove = false;        ///< Hapus file sebelum write/append
+    };
+
+    PersistenceService();
+    ~PersistenceService();
+
+    std::map<std::string, PendingFile> pending;  ///< Path -> operasi tertunda
+    std::mutex mutex;
+    std::condition_variable wake;   ///< Membangunkan worker
+    std::condition_variable idle;   ///< Sinyal untuk flush(): antrian kosong
+    int flushRequests = 0;          ///< > 0: abaikan debounce
+    int inFlight = 0;               ///< Batch yang sedang ditulis worker
+    unsigned failures = 0;          ///< Jumlah penulisan gagal (untuk flush())
+    bool stopping = false;
+    std::thread worker;
+
+    void run();
+    static bool writeFile(const std::string& path, const std::string& data);
+    static bool appendFile(const std::string& path, const std::string& bytes,
+                           const std::string& header);
+    static bool removeFile(const std::string& path);
+};
+
+#endif // PERSISTENCESERVICE_H
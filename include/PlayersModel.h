@@ -0,0 +1,114 @@
+#ifndef PLAYERSMODEL_H
+#define PLAYERSMODEL_H
+
+#include <QAbstractListModel>
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <QTimer>
+
+/**
+ * @brief List model of race participants with coalesced updates.
+ *
+ * Rows are stable and keyed by player UUID, so QML delegates (race lanes)
+ * survive progress updates. NetworkManager stages changes as packets arrive;
+ * they are flushed at most once per frame, emitting dataChanged only for the
+ * roles that actually changed.
+ *
+ * Remote players also get an interpolation buffer: NetworkManager feeds
+ * timestamped progress samples (addSample) and advance(), called once per
+ * rendered frame, updates smoothProgress by interpolating between samples
+ * INTERPOLATION_DELAY_MS in the past, extrapolating briefly from the last
+ * velocity when a sample is late. Lanes move smoothly at a 10 Hz send rate.
+ */
+class PlayersModel : public QAbstractListModel {
+    Q_OBJECT
+
+    Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+
+public:
+    enum Roles {
+        PlayerIdRole = Qt::UserRole + 1,
+        NameRole,
+        IsHostRole,
+        IsLocalRole,
+        ProgressRole,
+        WpmRole,
+        FinishedRole,
+        PositionRole,
+        SmoothProgressRole
+    };
+    Q_ENUM(Roles)
+
+    // Snapshot of one player's displayed state
+    struct Player {
+        QString uuid;
+        QString name;
+        bool isHost = false;
+        bool isLocal = false;
+        double progress = 0.0;  // 0.0 - 1.0
+        int wpm = 0;
+        bool finished = false;
+        int position = 0;       // Finish position (0 = not finished)
+    };
+
+    explicit PlayersModel(QObject* parent = nullptr);
+
+    // QAbstractListModel interface
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    // Staged updates (applied on the next flush)
+    void setPlayer(const Player& player);
+    void removePlayer(const QString& uuid);
+    bool contains(const QString& uuid) const;
+    QStringList playerIds() const;
+
+    // Add a progress sample for a remote player (senderTimeMs = packet timestamp)
+    void addSample(const QString& uuid, qint64 senderTimeMs, double progress);
+
+    // Advance smoothProgress to the current time (call once per frame)
+    Q_INVOKABLE void advance();
+
+    // Apply staged updates immediately
+    void flush();
+
+    // Drop all rows and staged updates
+    void clear();
+
+signals:
+    void countChanged();
+
+private:
+    static constexpr int FLUSH_INTERVAL_MS = 16;  // ~One frame at 60 Hz
+    static constexpr int INTERPOLATION_DELAY_MS = 120;  // One 100 ms tick plus jitter
+    static constexpr int MAX_EXTRAPOLATION_MS = 250;    // Hold position after this
+    static constexpr int MAX_SAMPLES = 16;
+
+    struct Sample {
+        qint64 time;      // Sender clock (ms)
+        double progress;
+    };
+
+    struct Row {
+        Player player;
+        double smoothProgress = 0.0;
+        QList<Sample> samples;        // Oldest first
+        qint64 clockOffsetMs = 0;     // Local receive time minus sender time (min seen)
+        bool hasClockOffset = false;
+    };
+
+    QList<Row> m_rows;
+    QHash<QString, int> m_rowByUuid;          // UUID -> row in m_rows
+    QHash<QString, Player> m_pending;          // Staged inserts/updates
+    QSet<QString> m_pendingRemovals;
+    QList<QString> m_pendingOrder;             // Insertion order of new players
+    QTimer m_flushTimer;
+
+    void scheduleFlush();
+    void rebuildIndex();
+};
+
+#endif // PLAYERSMODEL_H
@@ -61,8 +61,10 @@ class ProgressManager {
 public:
     /**
      * @brief Constructor - Load progress dari file jika ada
+     * @param autoLoad false untuk menunda loadProgress() (misalnya agar
+     *        dijalankan di background thread oleh GameBackend)
      */
-    ProgressManager();
+    explicit ProgressManager(bool autoLoad = true);
     
     /**
      * @brief Load progress dari file JSON
@@ -71,13 +73,13 @@ public:
     bool loadProgress();
     
     /**
-     * @brief Save progress ke file JSON
-     * @return true jika berhasil, false jika gagal write
+     * @brief Jadwalkan penyimpanan progress ke file JSON (via PersistenceService)
+     * @return true jika berhasil dijadwalkan
      */
     bool saveProgress();
     
     /**
-     * @brief Reset semua progress ke default (delete file)
+     * @brief Reset semua progress ke default (file ditimpa dengan default)
      * @return true jika berhasil
      */
     bool resetProgress();
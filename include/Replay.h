@@ -0,0 +1,152 @@
+/**
+ * @file Replay.h
+ * @brief Rekaman keystroke ringkas untuk replay dan ghost race
+ * @author Alea Farrel & Team
+ * @date 2025
+ *
+ * Replay mencatat setiap keystroke yang diproses TypingSession dalam
+ * beberapa byte, disimpan di file terpisah dari journal history sehingga
+ * query history tidak pernah menyentuhnya. ReplayCursor memutar ulang
+ * rekaman untuk menggerakkan lane ghost.
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @enum ReplayEvent
+ * @brief Jenis keystroke yang direkam (2 bit)
+ */
+enum class ReplayEvent : uint8_t {
+    CORRECT = 0,    ///< Karakter benar, cursor maju satu
+    INCORRECT = 1,  ///< Karakter salah, cursor maju satu
+    BACKSPACE = 2   ///< Karakter terakhir dihapus, cursor mundur satu
+};
+
+/**
+ * @class Replay
+ * @brief Timeline keystroke satu permainan
+ *
+ * @par Encoding Event
+ * Setiap event adalah satu varint LEB128 dari `(deltaUs << 2) | jenis`,
+ * dengan deltaUs = selisih mikrodetik dari event sebelumnya (event pertama
+ * dihitung dari keystroke pertama, jadi selalu 0). Posisi cursor tidak
+ * disimpan: posisi event ke-n diturunkan dari urutan event sebelumnya
+ * (CORRECT/INCORRECT maju, BACKSPACE mundur).
+ *
+ * Jeda antar keystroke yang umum (50 ms - 500 ms) muat di 3 byte, jadi
+ * tes 60 detik (~300-400 keystroke) berukuran sekitar 1 KB.
+ *
+ * @par Format File (little-endian)
+ * | Offset | Ukuran | Field                              |
+ * |--------|--------|------------------------------------|
+ * | 0      | 4      | magic "RTRP"                       |
+ * | 4      | 2      | versi (FILE_VERSION)               |
+ * | 6      | 2      | reserved (0)                       |
+ * | 8      | 4      | panjang target text (u32)          |
+ * | 12     | 4      | jumlah event (u32)                 |
+ * | 16     | 8      | durasi total dalam mikrodetik (u64)|
+ * | 24     | ...    | stream event varint                |
+ */
+class Replay {
+public:
+    static constexpr uint16_t FILE_VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 24;
+
+    /// Batas panjang target text saat deserialize (file rusak/diedit)
+    static constexpr uint32_t MAX_TEXT_LENGTH = 1u << 20;
+
+    /**
+     * @brief Buang semua event dan mulai rekaman baru
+     * @param textLength Panjang target text yang akan diketik
+     */
+    void clear(uint32_t textLength);
+
+    /**
+     * @brief Rekam satu keystroke
+     * @param event Jenis keystroke
+     * @param elapsedUs Mikrodetik sejak keystroke pertama (monoton naik)
+     */
+    void record(ReplayEvent event, uint64_t elapsedUs);
+
+    bool empty() const { return count == 0; }
+    uint32_t eventCount() const { return count; }
+    uint32_t textLength() const { return length; }
+    uint64_t durationUs() const { return lastUs; }
+
+    /**
+     * @brief Ukuran stream event di memory (byte)
+     */
+    size_t byteSize() const { return events.size(); }
+
+    /**
+     * @brief Serialize ke format file (header + stream event)
+     */
+    std::string serialize() const;
+
+    /**
+     * @brief Deserialize dari format file
+     * @return false jika magic/versi salah, stream event terpotong, atau
+     *         panjang text melewati MAX_TEXT_LENGTH; isi replay tidak diubah
+     */
+    bool deserialize(const std::string& data);
+
+private:
+    friend class ReplayCursor;
+
+    std::string events;     ///< Stream varint
+    uint32_t length = 0;    ///< Panjang target text
+    uint32_t count = 0;     ///< Jumlah event
+    uint64_t lastUs = 0;    ///< Waktu event terakhir
+};
+
+/**
+ * @class ReplayCursor
+ * @brief Pemutar Replay untuk lane ghost
+ *
+ * advanceTo() memproses event sampai waktu yang diminta (sekali jalan,
+ * maju saja) dan menjaga posisi cursor serta jumlah karakter benar dengan
+ * aturan sama seperti TypingSession: setiap posisi dihitung benar
+ * maksimal sekali, meskipun dihapus lalu diketik ulang.
+ */
+class ReplayCursor {
+public:
+    /**
+     * @brief Mulai dari awal replay (nullptr = tidak ada replay)
+     * @note Replay harus tetap hidup selama cursor dipakai
+     */
+    void reset(const Replay* replay);
+
+    /**
+     * @brief Proses semua event dengan waktu <= elapsedUs
+     */
+    void advanceTo(uint64_t elapsedUs);
+
+    uint32_t position() const { return static_cast<uint32_t>(typed.size()); }
+    uint32_t correctChars() const { return correct; }
+
+    /**
+     * @brief Progress 0.0 - 1.0 terhadap panjang target text replay
+     */
+    double progress() const;
+
+    /**
+     * @brief Semua event sudah diputar (ghost berhenti)
+     */
+    bool finished() const;
+
+private:
+    const Replay* replay = nullptr;
+    size_t offset = 0;                 ///< Posisi baca di stream event
+    uint32_t consumed = 0;             ///< Event yang sudah diproses
+    uint64_t timeUs = 0;               ///< Waktu event terakhir yang diproses
+    std::vector<bool> typed;           ///< Benar/salah per posisi di buffer
+    std::vector<bool> correctCounted;  ///< Posisi yang sudah dihitung benar
+    uint32_t correct = 0;
+};
+
+#endif // REPLAY_H
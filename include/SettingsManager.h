@@ -23,6 +23,7 @@
  * - Load/save settings dari/ke file JSON
  * - Getter/setter untuk setiap setting
  * - Auto-create file jika tidak ada
+ * - Penyimpanan di-debounce lewat PersistenceService (tidak memblokir GUI)
  *
  * Settings yang disimpan:
  * - sfx_enabled: Status SFX (true/false)
@@ -45,10 +46,13 @@ public:
   static bool load();
 
   /**
-   * @brief Menyimpan settings ke file JSON
+   * @brief Menjadwalkan penyimpanan settings ke file JSON
    *
-   * @return true jika berhasil menyimpan
-   * @return false jika gagal membuka file
+   * Snapshot settings ditulis oleh PersistenceService setelah jendela
+   * debounce, sehingga setter yang dipanggil beruntun hanya menghasilkan
+   * satu penulisan file.
+   *
+   * @return true jika penyimpanan berhasil dijadwalkan
    */
   static bool save();
 
@@ -59,7 +63,7 @@ public:
   static bool getSfxEnabled();
 
   /**
-   * @brief Mengatur status SFX dan langsung menyimpan ke file
+   * @brief Mengatur status SFX dan menjadwalkan penyimpanan
    * @param enabled Status SFX yang baru
    */
   static void setSfxEnabled(bool enabled);
@@ -71,7 +75,7 @@ public:
   static int getDefaultDuration();
 
   /**
-   * @brief Mengatur durasi default dan langsung menyimpan ke file
+   * @brief Mengatur durasi default dan menjadwalkan penyimpanan
    * @param duration Durasi dalam detik (-1 untuk unlimited)
    */
   static void setDefaultDuration(int duration);
@@ -83,7 +87,7 @@ public:
   static std::string getHistorySortBy();
 
   /**
-   * @brief Mengatur field sorting history dan menyimpan ke file
+   * @brief Mengatur field sorting history dan menjadwalkan penyimpanan
    * @param sortBy Field untuk sorting ("date" atau "wpm")
    */
   static void setHistorySortBy(const std::string& sortBy);
@@ -95,7 +99,7 @@ public:
   static bool getHistorySortAscending();
 
   /**
-   * @brief Mengatur arah sorting history dan menyimpan ke file
+   * @brief Mengatur arah sorting history dan menjadwalkan penyimpanan
    * @param ascending true untuk ascending, false untuk descending
    */
   static void setHistorySortAscending(bool ascending);
@@ -107,12 +111,6 @@ private:
   static bool historySortAscending;  ///< Arah sort (default: false = descending)
   static bool isLoaded;              ///< Flag: settings sudah di-load
   static std::string filename;       ///< Path ke file settings.json
-
-  /**
-   * @brief Mendapatkan path direktori data aplikasi
-   * @return Path dengan trailing separator
-   */
-  static std::string getDataDirectory();
 };
 
 #endif // SETTINGSMANAGER_H
@@ -0,0 +1,51 @@
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Fixed-size single-producer/single-consumer ring buffer.
+ *
+ * Lock-free: the producer only writes m_head, the consumer only writes
+ * m_tail. N must be a power of two. When full, push() drops the item
+ * instead of blocking the producer.
+ */
+template <typename T, uint32_t N>
+class SpscRing {
+    static_assert((N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+public:
+    bool push(const T& item) {
+        const uint32_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) == N) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_items[head & (N - 1)] = item;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename F>
+    void drain(F&& consume) {
+        uint32_t tail = m_tail.load(std::memory_order_relaxed);
+        const uint32_t head = m_head.load(std::memory_order_acquire);
+        while (tail != head) {
+            consume(m_items[tail & (N - 1)]);
+            ++tail;
+        }
+        m_tail.store(tail, std::memory_order_release);
+    }
+
+    uint32_t takeDropped() { return m_dropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+    std::array<T, N> m_items{};
+    std::atomic<uint32_t> m_head{0};
+    std::atomic<uint32_t> m_tail{0};
+    std::atomic<uint32_t> m_dropped{0};
+};
+
+#endif // SPSCRING_H
@@ -12,9 +12,16 @@
 #define TEXTPROVIDER_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
+#include <array>
+#include <cstdint>
+#include <memory>
 #include <random>
+#include <unordered_map>
+
+#include "MarkovModel.h"
 
 /**
  * @enum Difficulty
@@ -33,14 +40,35 @@ enum class Difficulty {
     PROGRAMMER      ///< Sintaks koding (tanpa filter panjang)
 };
 
+/**
+ * @enum TextMode
+ * @brief Cara menyusun teks latihan
+ *
+ * - RANDOM_WORDS: Kata acak independen dari word bank
+ * - MARKOV: Rangkaian kata dari model n-gram korpus (lihat MarkovModel);
+ *   kembali ke RANDOM_WORDS jika bahasa tidak punya korpus
+ * - WEAK_BIGRAMS: Kata acak berbobot, lebih sering memilih kata yang berisi
+ *   bigram terlemah user (lihat setBigramWeights()); kembali ke
+ *   RANDOM_WORDS jika belum ada bobot
+ */
+enum class TextMode {
+    RANDOM_WORDS,   ///< Kata acak tanpa pengulangan
+    MARKOV,         ///< Teks mirip kalimat dari korpus
+    WEAK_BIGRAMS    ///< Latihan bigram yang lambat / sering salah
+};
+
 /**
  * @class TextProvider
  * @brief Class untuk mengelola database kata-kata
  * 
  * Features:
  * - Load kata dari file teks
- * - Filter kata berdasarkan kesulitan
- * - Random selection
+ * - Filter kata berdasarkan kesulitan (dihitung sekali saat loading)
+ * - Random selection tanpa pengulangan dalam O(count)
+ * - Streaming kata per chunk (WordDeck) untuk mode tanpa batas waktu
+ * - Teks ber-seed yang portable untuk sinkronisasi multiplayer
+ * - Teks natural dari model Markov korpus (TextMode::MARKOV)
+ * - Latihan bigram terlemah (TextMode::WEAK_BIGRAMS)
  * - Multi-language support (ID, EN, PROG)
  */
 class TextProvider {
@@ -53,32 +81,182 @@ public:
     /**
      * @brief Load kata-kata dari file ke dalam memory
      * @param language Kode bahasa ("id", "en", "prog")
-     * @param filename Path ke file database kata
-     * @return true jika berhasil, false jika file tidak ditemukan
+     * @param filename Path ke file database kata (binary .rtwb atau teks)
+     * @return true jika berhasil, false jika file tidak ditemukan/tidak valid
+     *
+     * Format file dideteksi dari magic header: file binary hasil
+     * compileWordFile() di-map langsung ke memory, sedangkan file teks
+     * (misalnya daftar kata dari user) di-parse seperti biasa.
      */
     bool loadWords(const std::string& language, const std::string& filename);
+
+    /**
+     * @brief Load korpus kalimat dan bangun model Markov per difficulty
+     * @param language Kode bahasa ("id", "en")
+     * @param filename Path ke file korpus teks (Qt resource atau file biasa)
+     * @return true jika korpus berisi minimal satu kalimat
+     *
+     * Kalimat dipisahkan oleh baris baru atau tanda . ! ?; tanda baca
+     * lainnya dibuang. Kata yang tidak valid untuk suatu difficulty
+     * memotong kalimat di model difficulty tersebut.
+     */
+    bool loadCorpus(const std::string& language, const std::string& filename);
+
+    /**
+     * @brief Set bobot kelemahan per bigram untuk TextMode::WEAK_BIGRAMS
+     * @param weights Skor per bigram (ukuran 128 * 128, index a * 128 + b),
+     *        misalnya KeyStats::weaknessWeights(); kosong = mode nonaktif
+     *
+     * Tabel sampling per bucket dibangun ulang secara lazy saat dipakai.
+     */
+    void setBigramWeights(std::vector<float> weights);
     
     /**
      * @brief Mendapatkan list kata acak sesuai kriteria
      * @param language Kode bahasa
      * @param difficulty Tingkat kesulitan
      * @param count Jumlah kata yang diinginkan
-     * @return Vector berisi kata-kata acak yang sudah difilter
+     * @param mode Kata acak (default) atau teks dari model Markov
+     * @return Vector berisi view ke kata-kata acak yang sudah difilter
+     *
+     * @warning View menunjuk ke pool milik TextProvider dan menjadi tidak
+     *          valid jika bahasa yang sama di-load ulang.
      */
-    std::vector<std::string> getWords(
+    std::vector<std::string_view> getWords(
         const std::string& language, 
         Difficulty difficulty, 
-        int count
+        int count,
+        TextMode mode = TextMode::RANDOM_WORDS
     );
 
+    /**
+     * @struct WordDeck
+     * @brief State pengambilan kata berkelanjutan dari satu bucket
+     *
+     * Deck adalah Fisher-Yates yang dijalankan sedikit demi sedikit: kata
+     * tidak berulang sampai seluruh bucket terambil, lalu deck dikocok
+     * ulang. Memory-nya dibatasi ukuran bucket, bukan lama permainan.
+     * Pada TextMode::MARKOV, deck hanya menyimpan state rantai sehingga
+     * setiap chunk melanjutkan kalimat chunk sebelumnya. Pada
+     * TextMode::WEAK_BIGRAMS kata boleh berulang, tetapi tidak dua kali
+     * berturut-turut.
+     */
+    struct WordDeck {
+        std::string language;                            ///< Kode bahasa
+        Difficulty difficulty = Difficulty::EASY;        ///< Bucket difficulty
+        TextMode mode = TextMode::RANDOM_WORDS;          ///< Sumber kata
+        uint32_t drawn = 0;                              ///< Kata yang sudah diambil dari deck
+        std::unordered_map<uint32_t, uint32_t> displaced; ///< Posisi bucket yang sudah di-swap
+        uint32_t chainState = MarkovModel::NO_STATE;     ///< State rantai (TextMode::MARKOV)
+        uint32_t lastPicked = UINT32_MAX;                ///< Posisi bucket terakhir (TextMode::WEAK_BIGRAMS)
+    };
+
+    /**
+     * @brief Mengambil kata berikutnya dari deck (untuk text streaming)
+     * @param deck Deck yang dibuat sekali per permainan
+     * @param count Jumlah kata yang diinginkan (boleh melebihi ukuran bucket)
+     * @return Vector berisi view kata; kosong jika bahasa/bucket tidak ada
+     */
+    std::vector<std::string_view> drawWords(WordDeck& deck, int count);
+
+    /**
+     * @brief Mendapatkan kata acak yang sepenuhnya ditentukan oleh seed
+     * @param language Kode bahasa
+     * @param difficulty Tingkat kesulitan
+     * @param count Jumlah kata yang diinginkan
+     * @param seed Seed (misalnya dari host multiplayer)
+     * @return Vector berisi view kata; identik di semua platform untuk
+     *         seed dan bankHash() yang sama
+     *
+     * Tidak memakai maupun mengubah RNG sesi.
+     */
+    std::vector<std::string_view> getSeededWords(const std::string& language, Difficulty difficulty,
+                                                 int count, uint64_t seed) const;
+
+    /**
+     * @brief Hash isi word bank (FNV-1a 64-bit)
+     * @param language Kode bahasa
+     * @return Hash, atau 0 jika bahasa belum di-load
+     *
+     * Dua word bank dengan hash sama menghasilkan getSeededWords() yang sama.
+     */
+    uint64_t bankHash(const std::string& language) const;
+
+    /**
+     * @brief Kode bahasa semua word bank yang sudah di-load
+     */
+    std::vector<std::string> languages() const;
+
+    /**
+     * @brief Compile file kata teks menjadi word bank binary (.rtwb)
+     * @param textFile Path ke file kata teks
+     * @param binaryFile Path output file binary
+     * @return true jika berhasil ditulis
+     *
+     * Dipakai oleh tool build-time `rapidtexter_wordbank` sehingga aplikasi
+     * tidak perlu mem-parse file teks saat startup.
+     */
+    static bool compileWordFile(const std::string& textFile, const std::string& binaryFile);
+
 private:
+    /**
+     * @struct WordBank
+     * @brief View ke word bank binary satu bahasa
+     *
+     * Layout binary (little-endian, lihat TextProvider.cpp):
+     * header, tabel `offsets` (u32), tabel `order` (u32), tabel `lengths`
+     * (u16), lalu arena karakter. `order` berisi index kata yang diurutkan
+     * berdasarkan panjang, sehingga setiap difficulty cukup direpresentasikan
+     * sebagai prefix `order[0 .. bucketSize[d])`.
+     *
+     * Data bisa dimiliki sendiri (`storage`, hasil parse file teks) atau
+     * berasal dari file yang di-map (`mapping` menjaga file tetap terbuka).
+     */
+    struct WordBank {
+        std::vector<unsigned char> storage;   ///< Buffer milik sendiri (jika bukan hasil map)
+        std::shared_ptr<void> mapping;        ///< Pemilik memory mapping (jika di-map)
+        const unsigned char* offsets = nullptr; ///< Tabel offset kata di arena
+        const unsigned char* order = nullptr;   ///< Tabel index kata urut panjang
+        const unsigned char* lengths = nullptr; ///< Tabel panjang kata
+        const char* arena = nullptr;            ///< Arena karakter semua kata
+        uint32_t wordCount = 0;                 ///< Jumlah kata
+        std::array<uint32_t, 4> bucketSize{};   ///< Jumlah kata valid per Difficulty
+        uint64_t contentHash = 0;               ///< Hash bucket + kata (lihat bankHash())
+
+        /**
+         * @brief Ambil kata dengan index tertentu sebagai view ke arena
+         */
+        std::string_view word(uint32_t index) const;
+    };
+
     /**
      * @brief Map untuk menyimpan database kata
      * 
      * Key: Kode bahasa ("id", "en", "prog")
-     * Value: Vector berisi semua kata dalam bahasa tersebut
+     * Value: WordBank berisi semua kata dalam bahasa tersebut
+     */
+    std::map<std::string, WordBank> wordBanks;
+
+    /**
+     * @brief Model Markov per bahasa, satu per Difficulty
+     *
+     * Hanya berisi bahasa yang korpusnya berhasil di-load.
      */
-    std::map<std::string, std::vector<std::string>> wordBanks;
+    std::map<std::string, std::array<MarkovModel, 4>> corpusModels;
+
+    /// Skor kelemahan per bigram (kosong = TextMode::WEAK_BIGRAMS nonaktif)
+    std::vector<float> bigramWeights;
+
+    /**
+     * @brief Bobot kumulatif kata per bahasa dan Difficulty
+     *
+     * Entry k = total bobot posisi bucket 0..k, sehingga satu sampel cukup
+     * satu binary search. Dibangun lazy oleh findWeakTable().
+     */
+    std::map<std::string, std::array<std::vector<double>, 4>> weakTables;
+
+    /// Pengali skor bigram terhadap bobot dasar 1 setiap kata
+    static constexpr double WEAK_BIAS = 4.0;
     
     /**
      * @brief Mersenne Twister RNG untuk randomization yang lebih baik
@@ -94,7 +272,52 @@ private:
      * @param difficulty Tingkat kesulitan
      * @return true jika kata valid untuk difficulty tersebut
      */
-    bool isWordValidForDifficulty(const std::string& word, Difficulty difficulty);
+    static bool isWordValidForDifficulty(const std::string& word, Difficulty difficulty);
+
+    /**
+     * @brief Membaca dan men-sanitize kata dari file teks
+     * @param filename Path file (Qt resource atau file biasa)
+     * @param words Output kata-kata sesuai urutan file
+     * @return true jika file berhasil dibaca
+     */
+    static bool readWordFile(const std::string& filename, std::vector<std::string>& words);
+
+    /**
+     * @brief Membaca korpus teks menjadi kalimat-kalimat
+     * @param filename Path file (Qt resource atau file biasa)
+     * @param sentences Output kalimat sebagai daftar kata yang sudah di-sanitize
+     * @return true jika file berhasil dibaca
+     */
+    static bool readCorpusFile(const std::string& filename,
+                               std::vector<std::vector<std::string>>& sentences);
+
+    /**
+     * @brief Model Markov untuk bahasa dan difficulty tertentu
+     * @return nullptr jika bahasa tidak punya korpus atau modelnya kosong
+     */
+    const MarkovModel* findModel(const std::string& language, Difficulty difficulty) const;
+
+    /**
+     * @brief Tabel bobot kumulatif untuk bahasa dan difficulty tertentu
+     * @return nullptr jika belum ada bobot bigram atau bucket kosong
+     */
+    const std::vector<double>* findWeakTable(const std::string& language, Difficulty difficulty);
+
+    /**
+     * @brief Serialize kata-kata ke format word bank binary
+     * @param words Kata-kata yang sudah di-sanitize, sesuai urutan file
+     * @return Buffer binary (header, tabel index, dan arena)
+     */
+    static std::vector<unsigned char> buildBank(const std::vector<std::string>& words);
+
+    /**
+     * @brief Memasang view WordBank di atas buffer binary
+     * @param data Pointer ke awal buffer binary
+     * @param size Ukuran buffer dalam byte
+     * @param bank WordBank yang akan diisi pointer-pointernya
+     * @return true jika header dan tabel valid
+     */
+    static bool attachBank(const unsigned char* data, size_t size, WordBank& bank);
 };
 
 #endif // TEXTPROVIDER_H
@@ -0,0 +1,273 @@
+/**
+ * @file TypingSession.h
+ * @brief Engine pengetikan per-keystroke untuk gameplay
+ * @author Alea Farrel & Team
+ * @date 2025
+ *
+ * TypingSession menyimpan target text, buffer ketikan, state per posisi,
+ * dan Stats permainan. Setiap keystroke diproses secara incremental O(1)
+ * sehingga latency tetap konstan berapapun panjang teksnya.
+ */
+
+#ifndef TYPINGSESSION_H
+#define TYPINGSESSION_H
+
+#include <QBitArray>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QObject>
+#include <QString>
+#include <QVariantMap>
+
+#include "CharacterModel.h"
+#include "KeyStats.h"
+#include "Replay.h"
+#include "Stats.h"
+
+/**
+ * @class TypingSession
+ * @brief QObject yang memproses input gameplay karakter demi karakter
+ *
+ * Aturan yang dipakai sama dengan GameEngine versi TUI:
+ * - Correct/error dihitung sekali per posisi (tidak double counting saat
+ *   karakter dihapus lalu diketik ulang)
+ * - Backspace tidak bisa melewati checkpoint, yaitu spasi terakhir yang
+ *   diketik benar saat seluruh ketikan sebelumnya juga benar
+ *
+ * Checkpoint dan jumlah karakter salah di buffer di-maintain secara
+ * incremental, jadi canBackspace() tidak perlu memindai ulang dari awal.
+ *
+ * Dengan streaming = true (mode unlimited / durasi panjang), target text
+ * adalah jendela beberapa baris: textNeeded() meminta chunk kata baru
+ * (appendText) saat sisa baris di depan cursor tinggal sedikit, dan baris
+ * yang sudah selesai di belakang checkpoint dibuang. Session tidak selesai
+ * di akhir teks; finish() dipanggil oleh timer atau user. Semua index
+ * (cursorPosition, charState, ...) relatif terhadap jendela.
+ *
+ * Setiap keystroke yang diproses juga direkam ke Replay (beberapa byte per
+ * key) untuk ghost race melawan personal best; lihat replayData(). Latency
+ * dan salah ketik per tombol/bigram dikumpulkan ke KeyStats; lihat
+ * keyStatsData().
+ *
+ * @par Contoh penggunaan di QML:
+ * @code
+ * TypingSession {
+ *     id: session
+ *     targetText: "darah salah tidak"
+ *     onCharStateChanged: function(index) { refreshChar(index) }
+ *     onSessionFinished: showResults(session.results())
+ * }
+ * @endcode
+ */
+class TypingSession : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QString targetText READ targetText WRITE setTargetText NOTIFY targetTextChanged)
+    Q_PROPERTY(int length READ length NOTIFY targetTextChanged)
+    Q_PROPERTY(int cursorPosition READ cursorPosition NOTIFY cursorPositionChanged)
+    Q_PROPERTY(int cursorLine READ cursorLine NOTIFY cursorLineChanged)
+    Q_PROPERTY(int correctChars READ correctChars NOTIFY statsChanged)
+    Q_PROPERTY(int incorrectChars READ incorrectChars NOTIFY statsChanged)
+    Q_PROPERTY(int totalKeystrokes READ totalKeystrokes NOTIFY statsChanged)
+    Q_PROPERTY(bool started READ isStarted NOTIFY startedChanged)
+    Q_PROPERTY(bool finished READ isFinished NOTIFY finishedChanged)
+    Q_PROPERTY(bool streaming READ isStreaming WRITE setStreaming NOTIFY streamingChanged)
+    Q_PROPERTY(CharacterModel* characters READ characters CONSTANT)
+
+public:
+    /**
+     * @brief State tampilan satu karakter target
+     */
+    enum CharState {
+        Pending,    ///< Belum diketik
+        Current,    ///< Posisi cursor
+        Correct,    ///< Diketik benar
+        Incorrect   ///< Diketik salah
+    };
+    Q_ENUM(CharState)
+
+    explicit TypingSession(QObject* parent = nullptr);
+
+    QString targetText() const;
+
+    /**
+     * @brief Set target text baru dan reset session
+     */
+    void setTargetText(const QString& text);
+
+    int length() const;
+    int cursorPosition() const;
+
+    /**
+     * @brief Baris (hasil word wrap) tempat cursor berada
+     */
+    int cursorLine() const;
+    int correctChars() const;
+    int incorrectChars() const;
+    int totalKeystrokes() const;
+    bool isStarted() const;
+    bool isFinished() const;
+    bool isStreaming() const;
+
+    /**
+     * @brief Aktifkan text streaming (set sebelum targetText)
+     */
+    void setStreaming(bool streaming);
+
+    /// Baris selesai yang tetap ditampilkan di atas baris cursor
+    static constexpr int RETAINED_LINES = 1;
+    /// Minimal baris di bawah baris cursor sebelum textNeeded() di-emit
+    static constexpr int LOOKAHEAD_LINES = 3;
+
+    /**
+     * @brief Model cell karakter untuk Repeater teks
+     *
+     * Di-update bersamaan dengan charStateChanged(), hanya untuk cell
+     * yang berubah.
+     */
+    CharacterModel* characters() const;
+
+    /**
+     * @brief Memproses teks input (satu atau beberapa karakter)
+     * @param text Teks dari input handler; '\\r' dan '\\n' diabaikan
+     *
+     * Keystroke pertama memulai timer. Session selesai otomatis saat
+     * cursor mencapai akhir target text.
+     */
+    Q_INVOKABLE void inputText(const QString& text);
+
+    /**
+     * @brief Menambah kata di akhir target text (mode streaming)
+     * @param text Kata-kata dipisah spasi; spasi penyambung ditambahkan otomatis
+     *
+     * Ketikan dan Stats tidak di-reset.
+     */
+    Q_INVOKABLE void appendText(const QString& text);
+
+    /**
+     * @brief Menghapus karakter terakhir jika tidak melewati checkpoint
+     * @return true jika karakter dihapus
+     */
+    Q_INVOKABLE bool backspace();
+
+    /**
+     * @brief Cek apakah backspace diizinkan pada posisi cursor saat ini
+     */
+    Q_INVOKABLE bool canBackspace() const;
+
+    /**
+     * @brief Reset buffer, state, dan Stats (target text tetap)
+     */
+    Q_INVOKABLE void reset();
+
+    /**
+     * @brief Mengakhiri session (misalnya saat waktu habis)
+     */
+    Q_INVOKABLE void finish();
+
+    /**
+     * @brief State karakter pada index tertentu
+     * @return Nilai CharState
+     */
+    Q_INVOKABLE int charState(int index) const;
+
+    /**
+     * @brief Karakter yang diketik pada index tertentu (kosong jika belum)
+     */
+    Q_INVOKABLE QString typedCharAt(int index) const;
+
+    /**
+     * @brief Hasil permainan dihitung dengan Stats::calculate()
+     * @return QVariantMap berisi wpm, accuracy, timeElapsed, errors
+     */
+    Q_INVOKABLE QVariantMap results() const;
+
+    /**
+     * @brief Milidetik sejak keystroke pertama (durasi final jika selesai)
+     */
+    Q_INVOKABLE int elapsedMs() const;
+
+    /**
+     * @brief Rekaman keystroke session yang sudah selesai
+     * @return Replay::serialize(), atau kosong jika session belum selesai
+     *         atau streaming (target text tidak tetap, tidak bisa jadi ghost)
+     */
+    Q_INVOKABLE QByteArray replayData() const;
+
+    /**
+     * @brief Statistik per tombol dan per bigram session yang sudah selesai
+     * @return KeyStats::serialize(), atau kosong jika session belum selesai
+     *         atau belum ada keystroke; streaming tetap didukung
+     */
+    Q_INVOKABLE QByteArray keyStatsData() const;
+
+signals:
+    void targetTextChanged();
+    void cursorPositionChanged();
+    void cursorLineChanged();
+    void statsChanged();
+    void startedChanged();
+    void finishedChanged();
+    void streamingChanged();
+
+    /**
+     * @brief Sisa teks di depan cursor tinggal sedikit (mode streaming)
+     *
+     * Handler diharapkan memanggil appendText() dengan chunk berikutnya.
+     */
+    void textNeeded();
+
+    /**
+     * @brief State satu karakter berubah (maksimal dua index per keystroke)
+     */
+    void charStateChanged(int index);
+
+    /**
+     * @brief Semua state karakter di-reset
+     */
+    void stateReset();
+
+    /**
+     * @brief Karakter salah diketik (untuk SFX)
+     */
+    void errorTyped();
+
+    /**
+     * @brief Karakter benar diketik (untuk SFX)
+     */
+    void correctTyped();
+
+    /**
+     * @brief Session selesai (teks habis atau finish() dipanggil)
+     */
+    void sessionFinished();
+
+private:
+    QString m_targetText;
+    QString m_typed;             // Buffer ketikan, panjang = cursor position
+    QBitArray m_correctCounted;  // Posisi yang sudah dihitung sebagai correct
+    QBitArray m_errorCounted;    // Posisi yang sudah dihitung sebagai error
+    int m_wrongInBuffer;         // Jumlah posisi salah di buffer saat ini
+    int m_lockedLimit;           // Posisi minimum yang bisa di-backspace
+    Stats m_stats;
+    Replay m_replay;             // Timeline keystroke sejak keystroke pertama
+    KeyStats m_keyStats;         // Latency/error per tombol dan bigram
+    quint64 m_lastKeyUs;         // Waktu keystroke terakhir (mikrodetik)
+    bool m_cleanRun;             // Keystroke terakhir benar (sampel latency valid)
+    QElapsedTimer m_timer;
+    qint64 m_elapsedMs;          // Durasi final setelah session selesai
+    bool m_started;
+    bool m_finished;
+    bool m_streaming;
+    CharacterModel* m_characters;
+
+    void typeChar(QChar ch);
+    void maintainWindow();
+    void retire(int count);
+    void notifyCell(int index);
+    void recordKey(ReplayEvent event, int pos);
+    double elapsedSeconds() const;
+};
+
+#endif // TYPINGSESSION_H
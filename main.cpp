@@ -11,14 +11,22 @@
  * @see GameBackend For the C++ backend handling game state, history,
  *      word generation, and sound effects.
  * @see NetworkManager For the multiplayer networking backend.
+ * @see TypingSession For the per-keystroke typing engine used by gameplay.
+ * @see PerfMonitor For the latency instrumentation behind --perf-log and
+ *      the Ctrl+Shift+P overlay.
  * @see Main.qml For the main QML application window and UI components.
  */
 
+#include <QCommandLineParser>
 #include <QGuiApplication>
 #include <QQmlApplicationEngine>
 #include <QQmlContext>
+#include <QQuickWindow>
 #include "GameBackend.h"
 #include "NetworkManager.h"
+#include "PerfMonitor.h"
+#include "PersistenceService.h"
+#include "TypingSession.h"
 
 /**
  * @brief Application entry point.
@@ -33,6 +41,9 @@
  *    "import rapid_texter 1.0"
  * 5. Loads the main QML module and starts the event loop
  *
+ * Options: --perf-log <file> enables PerfMonitor from startup and writes
+ * every latency sample to a CSV file.
+ *
  * @param argc Command-line argument count
  * @param argv Command-line argument values
  * @return Exit code (0 for success, -1 if QML object creation fails)
@@ -49,11 +60,38 @@ int main(int argc, char *argv[])
     app.setOrganizationName("RapidTexter");
     app.setApplicationName("RapidTexter");
 
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    const QCommandLineOption perfLogOption(
+        "perf-log", "Record latency samples (keystroke, frame, network) to a CSV <file>.", "file");
+    parser.addOption(perfLogOption);
+    parser.process(app);
+
+    /*
+     * PerfMonitor stays disabled (and costs next to nothing) unless
+     * --perf-log is given or the overlay is toggled with Ctrl+Shift+P.
+     */
+    PerfMonitor* perfMonitor = PerfMonitor::instance();
+    if (parser.isSet(perfLogOption)) {
+        perfMonitor->setLogFile(parser.value(perfLogOption));
+    }
+    QObject::connect(&app, &QCoreApplication::aboutToQuit, perfMonitor, &PerfMonitor::flush);
+
+    /*
+     * Settings, progress and history are written on PersistenceService's
+     * worker after a short debounce; write out anything still pending
+     * before the process exits.
+     */
+    QObject::connect(&app, &QCoreApplication::aboutToQuit, [] {
+        PersistenceService::instance().flush();
+    });
+
     /*
      * Create GameBackend singleton instance BEFORE loading QML.
-     * This ensures the backend is fully initialized when QML components
-     * attempt to access it. The singleton pattern guarantees only one
-     * instance exists throughout the application lifecycle.
+     * This ensures the backend object exists when QML components
+     * attempt to access it. Word banks, history and progress are loaded
+     * on a worker thread while the splash screen is showing; QML waits
+     * for GameBackend.ready before enabling the menus.
      */
     GameBackend* backend = GameBackend::instance();
     
@@ -79,6 +117,17 @@ int main(int argc, char *argv[])
      */
     qmlRegisterSingletonInstance("rapid_texter", 1, 0, "NetworkManager", networkManager);
 
+    /*
+     * Register TypingSession as an instantiable type. Each gameplay page
+     * owns one session that runs the per-keystroke typing engine in C++.
+     */
+    qmlRegisterType<TypingSession>("rapid_texter", 1, 0, "TypingSession");
+
+    /*
+     * Register PerfMonitor for the performance overlay and keystroke marks.
+     */
+    qmlRegisterSingletonInstance("rapid_texter", 1, 0, "PerfMonitor", perfMonitor);
+
     /*
      * Connect to objectCreationFailed signal to handle QML loading errors.
      * If the main QML file fails to load, exit with error code -1.
@@ -95,6 +144,11 @@ int main(int argc, char *argv[])
     /* Load the main QML module - this triggers the UI creation */
     engine.loadFromModule("rapid_texter", "Main");
 
+    /* Frame timing comes from the main window's frame swaps */
+    if (auto* window = qobject_cast<QQuickWindow*>(engine.rootObjects().value(0))) {
+        perfMonitor->attachWindow(window);
+    }
+
     /* Start the Qt event loop - blocks until application quits */
     return app.exec();
 }
@@ -3,6 +3,7 @@
  * @brief Full-screen countdown overlay (3, 2, 1, GO!)
  *
  * Uses clean text design without emojis.
+ * startIn() aligns "GO!" with the synchronized race start instant.
  */
 import QtQuick
 import "."
@@ -20,9 +21,16 @@ Rectangle {
     signal finished
 
     function start() {
-        countdown = 3;
+        startIn(3000);
+    }
+
+    // Show "GO!" exactly msUntilStart from now
+    function startIn(msUntilStart) {
+        countdown = Math.max(0, Math.ceil(msUntilStart / 1000));
         visible = true;
         isActive = true;
+        // First tick is shortened so later ticks land on whole seconds before GO
+        countdownTimer.interval = Math.max(1, msUntilStart - (countdown - 1) * 1000);
         countdownTimer.start();
     }
 
@@ -37,6 +45,7 @@ Rectangle {
         interval: 1000
         repeat: true
         onTriggered: {
+            interval = 1000;
             countdown--;
             if (countdown < 0) {
                 stop();
@@ -0,0 +1,467 @@
+/**
+ * @file KeyHeatmap.qml
+ * @brief Modal overlay showing weak keys and letter pairs from history.
+ * @author RapidTexter Team
+ * @date 2026
+ *
+ * Colors a keyboard by how slow / error-prone each key is across all
+ * saved games, and lists the weakest bigrams. Data comes from the lifetime
+ * aggregates in the backend, so opening the overlay never scans history.
+ *
+ * @section shortcuts Keyboard Shortcuts
+ * - Key_W: Toggle weak-bigram practice text
+ * - Key_Escape: Close overlay
+ */
+import QtQuick
+import QtQuick.Controls
+import QtQuick.Layouts
+import Qt5Compat.GraphicalEffects
+
+/**
+ * @brief Modal overlay for the weak-keys heatmap.
+ * @inherits Rectangle
+ */
+Rectangle {
+    id: overlay
+    anchors.fill: parent
+    color: Qt.rgba(0.05, 0.067, 0.09, 0.85)
+    visible: false
+    opacity: 0
+    z: 10000
+
+    /** @property language @brief Language filter ("All", "ID", "EN", "PROG"). */
+    property string language: "All"
+
+    /** @property practiceEnabled @brief Whether new games use the "weak" text mode. */
+    property bool practiceEnabled: false
+
+    /** @property showOverlay @brief Controls the overlay visibility with animation */
+    property bool showOverlay: false
+
+    /** @property heatmap @brief Per-key cells from GameBackend.keyHeatmap(). */
+    property var heatmap: ({})
+
+    /** @property bigrams @brief Weakest bigrams from GameBackend.weakBigrams(). */
+    property var bigrams: []
+
+    /** @property maxScore @brief Highest key score, used to scale colors. */
+    property real maxScore: 0
+
+    /** @property hoveredKey @brief Key under the mouse, shown in the detail line. */
+    property string hoveredKey: ""
+
+    readonly property var keyRows: ["1234567890-=", "qwertyuiop[]", "asdfghjkl;'", "zxcvbnm,./"]
+
+    /** @signal close @brief Emitted when overlay should be closed. */
+    signal close
+
+    /** @signal practiceToggled @brief Emitted when the practice toggle is clicked. */
+    signal practiceToggled
+
+    /** @function refresh @brief Reads the current aggregates from the backend */
+    function refresh() {
+        heatmap = GameBackend.keyHeatmap(language);
+        bigrams = GameBackend.weakBigrams(8, language);
+        var highest = 0;
+        for (var key in heatmap)
+            highest = Math.max(highest, heatmap[key].score);
+        maxScore = highest;
+    }
+
+    /** @function mix @brief Linear blend between two colors */
+    function mix(a, b, t) {
+        return Qt.rgba(a.r + (b.r - a.r) * t, a.g + (b.g - a.g) * t, a.b + (b.b - a.b) * t, 1);
+    }
+
+    /** @function heatColor @brief Green (fine) through yellow to red (weakest) */
+    function heatColor(key) {
+        var cell = heatmap[key];
+        if (!cell)
+            return Theme.bgTertiary;
+        var t = maxScore > 0 ? cell.score / maxScore : 0;
+        return t < 0.5 ? mix(Theme.accentGreen, Theme.accentYellow, t * 2) : mix(Theme.accentYellow, Theme.accentRed, (t - 0.5) * 2);
+    }
+
+    /** @function keyLabel @brief Makes the space key visible in labels */
+    function keyLabel(text) {
+        return text.replace(/ /g, "␣");
+    }
+
+    /** @function describe @brief One-line summary of a key or bigram cell */
+    function describe(cell) {
+        if (!cell)
+            return "No data yet";
+        return Math.round(cell.meanMs) + " ms avg  ·  " + (cell.errorRate * 100).toFixed(1) + "% errors  ·  " + cell.count + " samples";
+    }
+
+    onShowOverlayChanged: {
+        if (showOverlay)
+            refresh();
+    }
+    onLanguageChanged: {
+        if (showOverlay)
+            refresh();
+    }
+
+    // State machine for smooth open/close animations
+    states: [
+        State {
+            name: "hidden"
+            when: !showOverlay
+            PropertyChanges {
+                target: overlay
+                opacity: 0
+            }
+            PropertyChanges {
+                target: contentCard
+                scale: 0.95
+                opacity: 0
+            }
+        },
+        State {
+            name: "visible"
+            when: showOverlay
+            PropertyChanges {
+                target: overlay
+                visible: true
+                opacity: 1
+            }
+            PropertyChanges {
+                target: contentCard
+                scale: 1
+                opacity: 1
+            }
+        }
+    ]
+
+    transitions: [
+        Transition {
+            from: "hidden"
+            to: "visible"
+            SequentialAnimation {
+                PropertyAction {
+                    target: overlay
+                    property: "visible"
+                    value: true
+                }
+                ParallelAnimation {
+                    NumberAnimation {
+                        target: overlay
+                        property: "opacity"
+                        duration: 200
+                        easing.type: Easing.OutQuad
+                    }
+                    NumberAnimation {
+                        target: contentCard
+                        properties: "scale,opacity"
+                        duration: 200
+                        easing.type: Easing.OutQuad
+                    }
+                }
+            }
+        },
+        Transition {
+            from: "visible"
+            to: "hidden"
+            SequentialAnimation {
+                ParallelAnimation {
+                    NumberAnimation {
+                        target: overlay
+                        property: "opacity"
+                        duration: 150
+                        easing.type: Easing.InQuad
+                    }
+                    NumberAnimation {
+                        target: contentCard
+                        properties: "scale,opacity"
+                        duration: 150
+                        easing.type: Easing.InQuad
+                    }
+                }
+                PropertyAction {
+                    target: overlay
+                    property: "visible"
+                    value: false
+                }
+            }
+        }
+    ]
+
+    // Focus handling for keyboard
+    focus: showOverlay
+    Keys.onPressed: function (event) {
+        if (event.key === Qt.Key_Escape) {
+            close();
+            event.accepted = true;
+        } else if (event.key === Qt.Key_W) {
+            practiceToggled();
+            event.accepted = true;
+        }
+    }
+
+    // Background click to close
+    MouseArea {
+        anchors.fill: parent
+        onClicked: overlay.close()
+    }
+
+    // Content card
+    Rectangle {
+        id: contentCard
+        anchors.centerIn: parent
+        width: Math.min(parent.width - Theme.paddingHuge * 2, 640)
+        height: contentColumn.implicitHeight + Theme.paddingXXL * 2
+        color: Theme.bgSecondary
+        border.width: 1
+        border.color: Theme.borderPrimary
+        radius: 8
+        opacity: 0
+        scale: 0.95
+
+        // Prevent clicks from closing overlay
+        MouseArea {
+            anchors.fill: parent
+            onClicked: {} // Absorb click
+        }
+
+        ColumnLayout {
+            id: contentColumn
+            anchors.fill: parent
+            anchors.margins: Theme.paddingXXL
+            spacing: Theme.spacingXL
+
+            // Header with title and close button
+            RowLayout {
+                Layout.fillWidth: true
+
+                Row {
+                    spacing: Theme.spacingS
+                    Item {
+                        width: 20
+                        height: 20
+                        anchors.verticalCenter: parent.verticalCenter
+                        Image {
+                            id: headerIcon
+                            source: "qrc:/qt/qml/rapid_texter/assets/icons/fire.svg"
+                            anchors.fill: parent
+                            sourceSize: Qt.size(20, 20)
+                            visible: false
+                        }
+                        ColorOverlay {
+                            anchors.fill: headerIcon
+                            source: headerIcon
+                            color: Theme.accentRed
+                        }
+                    }
+                    Text {
+                        text: "WEAK KEYS"
+                        color: Theme.textPrimary
+                        font.family: Theme.fontFamily
+                        font.pixelSize: Theme.fontSizeXXL
+                        font.bold: true
+                        anchors.verticalCenter: parent.verticalCenter
+                    }
+                    Text {
+                        text: overlay.language === "All" ? "all languages" : overlay.language.toUpperCase()
+                        color: Theme.textSecondary
+                        font.family: Theme.fontFamily
+                        font.pixelSize: Theme.fontSizeM
+                        anchors.verticalCenter: parent.verticalCenter
+                    }
+                }
+
+                Item {
+                    Layout.fillWidth: true
+                }
+
+                // Close button
+                Rectangle {
+                    width: 28
+                    height: 28
+                    radius: 4
+                    color: closeBtn.containsMouse ? Theme.bgTertiary : "transparent"
+
+                    Item {
+                        width: 16
+                        height: 16
+                        anchors.centerIn: parent
+                        Image {
+                            id: closeIcon
+                            source: "qrc:/qt/qml/rapid_texter/assets/icons/close.svg"
+                            anchors.fill: parent
+                            sourceSize: Qt.size(16, 16)
+                            visible: false
+                        }
+                        ColorOverlay {
+                            anchors.fill: closeIcon
+                            source: closeIcon
+                            color: closeBtn.containsMouse ? Theme.textPrimary : Theme.textSecondary
+                        }
+                    }
+
+                    MouseArea {
+                        id: closeBtn
+                        anchors.fill: parent
+                        hoverEnabled: true
+                        cursorShape: Qt.PointingHandCursor
+                        onClicked: overlay.close()
+                    }
+                }
+            }
+
+            // Keyboard heatmap
+            Column {
+                Layout.alignment: Qt.AlignHCenter
+                spacing: Theme.spacingS
+
+                Repeater {
+                    model: overlay.keyRows
+
+                    Row {
+                        // Stagger rows like a physical keyboard
+                        x: index * 12
+                        spacing: Theme.spacingS
+
+                        Repeater {
+                            model: modelData.split("")
+
+                            Rectangle {
+                                width: 36
+                                height: 36
+                                radius: 4
+                                color: overlay.heatColor(modelData)
+                                border.width: overlay.hoveredKey === modelData ? 2 : 0
+                                border.color: Theme.textPrimary
+
+                                Text {
+                                    anchors.centerIn: parent
+                                    text: modelData
+                                    color: overlay.heatmap[modelData] ? Theme.bgPrimary : Theme.textMuted
+                                    font.family: Theme.fontFamily
+                                    font.pixelSize: Theme.fontSizeL
+                                    font.bold: true
+                                }
+
+                                MouseArea {
+                                    anchors.fill: parent
+                                    hoverEnabled: true
+                                    onEntered: overlay.hoveredKey = modelData
+                                    onExited: if (overlay.hoveredKey === modelData) overlay.hoveredKey = ""
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // Space bar
+                Rectangle {
+                    x: 4 * 12 + 2 * (36 + Theme.spacingS)
+                    width: 6 * 36 + 5 * Theme.spacingS
+                    height: 28
+                    radius: 4
+                    color: overlay.heatColor(" ")
+                    border.width: overlay.hoveredKey === " " ? 2 : 0
+                    border.color: Theme.textPrimary
+
+                    MouseArea {
+                        anchors.fill: parent
+                        hoverEnabled: true
+                        onEntered: overlay.hoveredKey = " "
+                        onExited: if (overlay.hoveredKey === " ") overlay.hoveredKey = ""
+                    }
+                }
+            }
+
+            // Hovered key detail
+            Text {
+                Layout.alignment: Qt.AlignHCenter
+                text: overlay.hoveredKey === "" ? "Hover a key for details" : overlay.keyLabel(overlay.hoveredKey) + "  ·  " + overlay.describe(overlay.heatmap[overlay.hoveredKey])
+                color: Theme.textSecondary
+                font.family: Theme.fontFamily
+                font.pixelSize: Theme.fontSizeM
+            }
+
+            // Weakest bigrams
+            Rectangle {
+                Layout.fillWidth: true
+                Layout.preferredHeight: bigramCol.implicitHeight + Theme.paddingL * 2
+                color: Theme.bgPrimary
+                border.width: 1
+                border.color: Theme.borderPrimary
+                radius: 6
+
+                Column {
+                    id: bigramCol
+                    anchors.fill: parent
+                    anchors.margins: Theme.paddingL
+                    spacing: Theme.spacingSM
+
+                    Text {
+                        text: "WEAKEST LETTER PAIRS"
+                        color: Theme.textMuted
+                        font.family: Theme.fontFamily
+                        font.pixelSize: Theme.fontSizeS
+                        font.letterSpacing: 1
+                    }
+
+                    Text {
+                        visible: overlay.bigrams.length === 0
+                        text: "Play a few more games to find your weak spots"
+                        color: Theme.textSecondary
+                        font.family: Theme.fontFamily
+                        font.pixelSize: Theme.fontSizeM
+                    }
+
+                    GridLayout {
+                        width: parent.width
+                        columns: 2
+                        rowSpacing: Theme.spacingS
+                        columnSpacing: Theme.spacingL
+
+                        Repeater {
+                            model: overlay.bigrams
+
+                            RowLayout {
+                                Layout.fillWidth: true
+                                spacing: Theme.spacingM
+
+                                Text {
+                                    text: overlay.keyLabel(modelData.bigram)
+                                    color: Theme.accentRed
+                                    font.family: Theme.fontFamily
+                                    font.pixelSize: Theme.fontSizeL
+                                    font.bold: true
+                                    Layout.preferredWidth: 28
+                                }
+                                Text {
+                                    text: Math.round(modelData.meanMs) + " ms  ·  " + (modelData.errorRate * 100).toFixed(0) + "% err"
+                                    color: Theme.textPrimary
+                                    font.family: Theme.fontFamily
+                                    font.pixelSize: Theme.fontSizeM
+                                    Layout.fillWidth: true
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Practice toggle
+            NavBtn {
+                Layout.alignment: Qt.AlignHCenter
+                iconSource: "qrc:/qt/qml/rapid_texter/assets/icons/target.svg"
+                labelText: overlay.practiceEnabled ? "Practice Weak Pairs: ON (W)" : "Practice Weak Pairs: OFF (W)"
+                onClicked: overlay.practiceToggled()
+            }
+
+            // Close hint
+            Text {
+                Layout.alignment: Qt.AlignHCenter
+                text: "Press ESC or click outside to close"
+                color: Theme.textMuted
+                font.family: Theme.fontFamily
+                font.pixelSize: Theme.fontSizeSM
+            }
+        }
+    }
+}
@@ -14,7 +14,7 @@
  *     iconSource: "qrc:/icons/arrow-left.svg"
  *     labelText: "Back (ESC)"
  *     variant: "default"
- *     onClicked: stackView.pop()
+ *     onClicked: navigator.back()
  * }
  * @endcode
  *
@@ -0,0 +1,102 @@
+/**
+ * @file PageNavigator.qml
+ * @brief Bounded navigation over the main StackView.
+ * @author RapidTexter Team
+ * @date 2026
+ *
+ * Every page (an inline Component or a PagePool) appears at most once on
+ * the stack. Opening a page that is already there unwinds to that entry
+ * instead of pushing a second copy, so the depth is bounded by the number
+ * of distinct pages however long the session runs. Pooled pages are taken
+ * from their pool; they hand themselves back from StackView.onRemoved.
+ *
+ * All navigation in Main.qml goes through this object so the page list
+ * stays in step with the stack.
+ *
+ * @code
+ * PageNavigator {
+ *     id: navigator
+ *     stack: stackView
+ *     initialPage: mainMenuComponent
+ * }
+ * onClicked: navigator.open(historyComponent)
+ * @endcode
+ */
+import QtQuick
+import QtQuick.Controls
+
+/**
+ * @brief Non-visual navigation controller.
+ * @inherits QtObject
+ */
+QtObject {
+    id: navigator
+
+    /** @property stack @brief The StackView being driven. */
+    property StackView stack: null
+
+    /** @property initialPage @brief Page used as the stack's initialItem. */
+    property var initialPage: null
+
+    // Page (Component or PagePool) of each stack entry, bottom first
+    property var entries: [initialPage]
+
+    // Drop entries for items the stack has already removed
+    function sync() {
+        if (entries.length > stack.depth)
+            entries = entries.slice(0, stack.depth);
+    }
+
+    function indexOf(page) {
+        sync();
+        return entries.indexOf(page);
+    }
+
+    function isPool(page) {
+        return typeof page.acquire === "function";
+    }
+
+    /** @function open @brief Push a page, or unwind to it if it is already on the stack */
+    function open(page, properties) {
+        var index = indexOf(page);
+        if (index >= 0) {
+            unwindTo(index);
+            return stack.get(index);
+        }
+        var item = isPool(page) ? stack.push(page.acquire(properties)) : stack.push(page, properties || {});
+        entries.push(page);
+        return item;
+    }
+
+    /** @function replaceTop @brief Swap the current page for another (unwinds if already present) */
+    function replaceTop(page, properties) {
+        var index = indexOf(page);
+        if (index >= 0) {
+            unwindTo(index);
+            return stack.get(index);
+        }
+        var item = isPool(page) ? stack.replace(page.acquire(properties)) : stack.replace(page, properties || {});
+        entries[entries.length - 1] = page;
+        return item;
+    }
+
+    /** @function back @brief Pop the current page (never the root) */
+    function back() {
+        if (stack.depth > 1)
+            stack.pop();
+        sync();
+    }
+
+    /** @function unwind @brief Pop several pages at once */
+    function unwind(levels) {
+        unwindTo(stack.depth - 1 - levels);
+    }
+
+    /** @function unwindTo @brief Pop down to the entry at index (0 = root) */
+    function unwindTo(index) {
+        index = Math.max(0, index);
+        if (index < stack.depth - 1)
+            stack.popToIndex(index);
+        sync();
+    }
+}
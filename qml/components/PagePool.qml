@@ -0,0 +1,92 @@
+/**
+ * @file PagePool.qml
+ * @brief Small pool of pre-incubated page instances.
+ * @author RapidTexter Team
+ * @date 2026
+ *
+ * Heavy pages (gameplay, race gameplay) are created once and reused, so
+ * entering a game no longer pays full component creation and a long
+ * session keeps a fixed number of live instances. prewarm() incubates an
+ * instance asynchronously while the user is still in the menus.
+ *
+ * @section hooks Page Hooks
+ * - activate(): called by acquire() before the page is pushed; loads new
+ *   text and restarts the page's state
+ * - deactivate(): called by release() once the stack has removed the page;
+ *   stops timers so an idle page does no work
+ *
+ * Pages call release() themselves from StackView.onRemoved, because only
+ * the page can see that attached signal.
+ */
+import QtQuick
+
+/**
+ * @brief Non-visual pool used by PageNavigator.
+ * @inherits QtObject
+ */
+QtObject {
+    id: pool
+
+    /** @property component @brief Component the pooled pages are created from. */
+    property Component component: null
+
+    /** @property holder @brief Hidden parent of idle pages. */
+    property Item holder: null
+
+    /** @property capacity @brief Idle instances kept; extra releases are destroyed. */
+    property int capacity: 1
+
+    // Ready, unused instances
+    property var idle: []
+
+    // Pending asynchronous creation, if any
+    property var incubator: null
+
+    /** @function prewarm @brief Start incubating an instance in the background */
+    function prewarm() {
+        if (!component || incubator || idle.length >= capacity)
+            return;
+        var pending = component.incubateObject(holder, {
+            "visible": false
+        }, Qt.Asynchronous);
+        if (!pending)
+            return;
+        if (pending.status === Component.Ready) {
+            idle.push(pending.object);
+            return;
+        }
+        incubator = pending;
+        pending.onStatusChanged = function (status) {
+            if (status === Component.Ready)
+                idle.push(pending.object);
+            if (status !== Component.Loading && pool.incubator === pending)
+                pool.incubator = null;
+        };
+    }
+
+    /** @function acquire @brief Take a page (finishing incubation if needed) and activate it */
+    function acquire(properties) {
+        if (incubator)
+            incubator.forceCompletion();
+        var item = idle.length > 0 ? idle.pop() : component.createObject(holder, {
+            "visible": false
+        });
+        for (var key in properties)
+            item[key] = properties[key];
+        if (typeof item.activate === "function")
+            item.activate();
+        return item;
+    }
+
+    /** @function release @brief Return a page removed from the stack */
+    function release(item) {
+        if (idle.indexOf(item) >= 0)
+            return;
+        if (typeof item.deactivate === "function")
+            item.deactivate();
+        if (idle.length < capacity)
+            idle.push(item);
+        else
+            item.destroy();
+    }
+}
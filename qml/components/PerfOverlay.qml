@@ -0,0 +1,92 @@
+/**
+ * @file PerfOverlay.qml
+ * @brief Corner overlay with live latency percentiles from PerfMonitor.
+ * @author RapidTexter Team
+ * @date 2026
+ *
+ * Shows keystroke-to-frame, frame interval, peer RTT and the busiest
+ * packet types (p50 / p99 / max in milliseconds). Visible only while
+ * PerfMonitor is enabled (Ctrl+Shift+P); click to reset the histograms.
+ */
+import QtQuick
+import rapid_texter
+
+/**
+ * @brief Read-only performance readout.
+ * @inherits Rectangle
+ */
+Rectangle {
+    id: perfOverlay
+
+    readonly property var stats: PerfMonitor.stats
+
+    visible: PerfMonitor.enabled
+    width: readout.implicitWidth + 16
+    height: readout.implicitHeight + 12
+    color: Qt.rgba(0, 0, 0, 0.75)
+    border.color: Theme.borderSecondary
+    border.width: 1
+
+    function row(label, summary) {
+        if (!summary || !summary.count)
+            return label + "  -";
+        return label + "  " + summary.p50.toFixed(1) + " / " + summary.p99.toFixed(1)
+                + " / " + summary.max.toFixed(1) + "  (" + summary.count + ")";
+    }
+
+    Column {
+        id: readout
+        anchors.centerIn: parent
+        spacing: 2
+
+        Text {
+            text: "PERF  p50 / p99 / max ms"
+            color: Theme.accentYellow
+            font.family: Theme.fontFamily
+            font.pixelSize: 10
+            font.bold: true
+        }
+
+        Repeater {
+            model: [
+                { label: "key->frame", key: "keyToFrame" },
+                { label: "frame     ", key: "frameInterval" },
+                { label: "rtt       ", key: "peerRtt" }
+            ]
+
+            Text {
+                required property var modelData
+                text: perfOverlay.row(modelData.label, perfOverlay.stats[modelData.key])
+                color: Theme.textPrimary
+                font.family: Theme.fontFamily
+                font.pixelSize: 10
+            }
+        }
+
+        // Busiest packet types
+        Repeater {
+            model: perfOverlay.stats.packets ? perfOverlay.stats.packets.slice(0, 5) : []
+
+            Text {
+                required property var modelData
+                text: perfOverlay.row(modelData.type.toLowerCase().substring(0, 10).padEnd(10), modelData)
+                color: Theme.textSecondary
+                font.family: Theme.fontFamily
+                font.pixelSize: 10
+            }
+        }
+
+        Text {
+            visible: perfOverlay.stats.dropped > 0
+            text: "dropped " + perfOverlay.stats.dropped
+            color: Theme.accentRed
+            font.family: Theme.fontFamily
+            font.pixelSize: 10
+        }
+    }
+
+    MouseArea {
+        anchors.fill: parent
+        onClicked: PerfMonitor.reset()
+    }
+}
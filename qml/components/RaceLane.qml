@@ -76,12 +76,7 @@ Item {
         x: trackStart + trackWidth * Math.min(progress, 1.0)
         anchors.verticalCenter: parent.verticalCenter
 
-        Behavior on x {
-            NumberAnimation {
-                duration: 80
-                easing.type: Easing.OutQuad
-            }
-        }
+        // No Behavior on x: progress is already smoothed per frame by PlayersModel
 
         // Arrow icon inside car (direction indicator)
         Item {
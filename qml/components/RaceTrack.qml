@@ -3,6 +3,10 @@
  * @brief Compact race track visualization showing all players' progress.
  *
  * Designed to be non-intrusive during typing - uses minimal vertical space.
+ * Lanes are created once per player from NetworkManager.playersModel and
+ * only their changed roles update, so cars animate instead of respawning.
+ * Remote cars follow the interpolated smoothProgress role, which the model
+ * advances once per rendered frame.
  */
 import QtQuick
 import QtQuick.Layouts
@@ -11,9 +15,9 @@ import "."
 Rectangle {
     id: raceTrack
 
-    // Array of {id, name, progress, wpm, isLocal, finished, position}
-    property var players: []
-    property int trackHeight: Math.min(players.length * 28 + 16, 150)
+    // PlayersModel with roles: playerId, name, progress, smoothProgress, wpm, isLocal, finished, position
+    property var players: null
+    property int trackHeight: Math.min(laneRepeater.count * 28 + 16, 150)
 
     implicitHeight: trackHeight
     color: Theme.bgSecondary
@@ -50,6 +54,12 @@ Rectangle {
         }
     }
 
+    // Sample interpolated progress at render rate
+    FrameAnimation {
+        running: raceTrack.visible && raceTrack.players !== null
+        onTriggered: raceTrack.players.advance()
+    }
+
     // Player lanes
     Column {
         anchors.fill: parent
@@ -58,17 +68,18 @@ Rectangle {
         spacing: 2
 
         Repeater {
+            id: laneRepeater
             model: raceTrack.players
 
             delegate: RaceLane {
                 width: parent.width
                 height: 24
-                playerName: modelData.name || "Player"
-                progress: modelData.progress || 0
-                wpm: modelData.wpm || 0
-                isLocal: modelData.isLocal || false
-                finished: modelData.finished || false
-                position: modelData.position || 0
+                playerName: model.name || "Player"
+                progress: model.smoothProgress
+                wpm: model.wpm
+                isLocal: model.isLocal
+                finished: model.finished
+                position: model.position
             }
         }
     }
@@ -76,7 +87,7 @@ Rectangle {
     // Empty state
     Text {
         anchors.centerIn: parent
-        visible: players.length === 0
+        visible: laneRepeater.count === 0
         text: "Waiting for players..."
         color: Theme.textMuted
         font.family: Theme.fontFamily
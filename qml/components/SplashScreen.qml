@@ -16,6 +16,7 @@ import Qt5Compat.GraphicalEffects
  * @inherits Rectangle
  *
  * @property bool applicationReady - Set to true when app is ready to dismiss splash
+ * @property real loadProgress - Background loading progress (0.0 - 1.0)
  * @signal finished() - Emitted when splash screen fade-out is complete
  */
 Rectangle {
@@ -26,6 +27,7 @@ Rectangle {
 
     // Public properties
     property bool applicationReady: false
+    property real loadProgress: 0.0
     property int minimumDisplayTime: 2000  // Minimum time to show splash (ms)
 
     // Internal state
@@ -237,6 +239,29 @@ Rectangle {
             }
         }
 
+        // Loading progress bar
+        Rectangle {
+            anchors.horizontalCenter: parent.horizontalCenter
+            width: 160
+            height: 2
+            radius: 1
+            color: Theme.borderPrimary
+
+            Rectangle {
+                width: parent.width * Math.max(0, Math.min(1, splashRoot.loadProgress))
+                height: parent.height
+                radius: parent.radius
+                color: Theme.accentBlue
+
+                Behavior on width {
+                    NumberAnimation {
+                        duration: 200
+                        easing.type: Easing.OutQuad
+                    }
+                }
+            }
+        }
+
         // Loading status text
         Text {
             id: loadingText
@@ -0,0 +1,150 @@
+/**
+ * @file TypingText.qml
+ * @brief Character grid that renders a TypingSession's target text.
+ * @author RapidTexter Team
+ * @date 2026
+ *
+ * Renders one delegate per character from TypingSession.characters. Word
+ * wrapping is computed in C++ for the monospace font (the model is told
+ * how many columns fit), and each delegate is positioned from its
+ * line/column roles. A keystroke only changes the one or two cells it
+ * affects, so render cost does not grow with the text length.
+ *
+ * With maxLines set (streaming sessions), only that many lines are shown,
+ * starting one line above the cursor line.
+ *
+ * @section usage Usage Example
+ * @code
+ * TypingText {
+ *     Layout.fillWidth: true
+ *     session: typingSession
+ *     caretBlinking: !typingSession.started
+ * }
+ * @endcode
+ */
+import QtQuick
+import rapid_texter
+
+/**
+ * @brief Positioned character cells with per-character styling.
+ * @inherits Item
+ */
+Item {
+    id: typingText
+
+    /** @property session @brief TypingSession providing the character model. */
+    property TypingSession session: null
+
+    /** @property fontSize @brief Glyph pixel size. */
+    property int fontSize: 28
+
+    /** @property lineHeight @brief Height of one text line (font + vertical gap). */
+    property int lineHeight: 48
+
+    /** @property caretBlinking @brief Blink the caret (before typing starts). */
+    property bool caretBlinking: false
+
+    /** @property maxLines @brief Visible line limit, 0 to show every line. */
+    property int maxLines: 0
+
+    // First visible line: keep one finished line above the cursor
+    readonly property int firstLine: session && maxLines > 0 ? Math.max(0, session.cursorLine - 1) : 0
+
+    // Monospace cell width, including the letter spacing used by the glyphs
+    readonly property real cellWidth: glyphMetrics.advanceWidth("M") + 0.5
+
+    implicitHeight: {
+        if (!session)
+            return 0;
+        const lines = session.characters.lineCount;
+        return (maxLines > 0 ? Math.min(lines, maxLines) : lines) * lineHeight;
+    }
+
+    FontMetrics {
+        id: glyphMetrics
+        font.family: Theme.fontFamily
+        font.pixelSize: typingText.fontSize
+    }
+
+    // Tell the model how many characters fit on one line
+    Binding {
+        target: typingText.session ? typingText.session.characters : null
+        property: "columns"
+        value: Math.max(1, Math.floor(typingText.width / typingText.cellWidth))
+        when: typingText.session !== null && typingText.width > 0
+    }
+
+    Repeater {
+        model: typingText.session ? typingText.session.characters : null
+
+        Text {
+            id: charText
+
+            required property int charState
+            required property int line
+            required property int column
+            required property string displayChar
+            required property bool isSpace
+
+            x: column * typingText.cellWidth
+            y: (line - typingText.firstLine) * typingText.lineHeight
+            visible: typingText.maxLines <= 0 || (line >= typingText.firstLine && line < typingText.firstLine + typingText.maxLines)
+            height: typingText.lineHeight
+            verticalAlignment: Text.AlignVCenter
+
+            text: displayChar
+            font.family: Theme.fontFamily
+            font.pixelSize: typingText.fontSize
+            font.letterSpacing: 0.5
+
+            color: {
+                switch (charState) {
+                case TypingSession.Correct:
+                    // Correct spaces stay muted, like untyped ones
+                    return isSpace ? Theme.textMuted : Theme.textPrimary;
+                case TypingSession.Incorrect:
+                    return Theme.accentRed;
+                case TypingSession.Current:
+                case TypingSession.Pending:
+                default:
+                    return Theme.textMuted;
+                }
+            }
+
+            // Background for incorrect chars - fixed height
+            Rectangle {
+                visible: charText.charState === TypingSession.Incorrect
+                anchors.left: parent.left
+                anchors.right: parent.right
+                anchors.verticalCenter: parent.verticalCenter
+                height: typingText.fontSize + 8
+                color: Qt.rgba(248 / 255, 81 / 255, 73 / 255, 0.15)
+                z: -1
+            }
+
+            // Caret cursor (vertical bar)
+            Rectangle {
+                visible: charText.charState === TypingSession.Current
+                anchors.left: parent.left
+                anchors.leftMargin: -1
+                anchors.verticalCenter: parent.verticalCenter
+                width: 2
+                height: typingText.fontSize + 6
+                color: Theme.accentBlue
+
+                SequentialAnimation on opacity {
+                    running: charText.charState === TypingSession.Current && typingText.caretBlinking
+                    loops: Animation.Infinite
+                    NumberAnimation {
+                        to: 0
+                        duration: 500
+                    }
+                    NumberAnimation {
+                        to: 1
+                        duration: 500
+                    }
+                }
+            }
+        }
+    }
+}
@@ -409,12 +409,31 @@ FocusScope {
                         }
 
                         Text {
-                            text: "PLAYERS (" + players.length + "/8)"
+                            text: "PLAYERS (" + players.length + "/" + NetworkManager.maxPlayers + ")"
                             color: Theme.textSecondary
                             font.family: Theme.fontFamily
                             font.pixelSize: Theme.fontSizeSM
                             font.bold: true
                         }
+
+                        // Topology toggle (host only, before anyone joins)
+                        Text {
+                            visible: isHost
+                            text: NetworkManager.starTopology ? "[STAR]" : "[MESH]"
+                            color: topologyMouse.enabled && topologyMouse.containsMouse ? Theme.accentBlue : Theme.textMuted
+                            font.family: Theme.fontFamily
+                            font.pixelSize: Theme.fontSizeSM
+                            font.bold: true
+
+                            MouseArea {
+                                id: topologyMouse
+                                anchors.fill: parent
+                                hoverEnabled: true
+                                enabled: NetworkManager.peerCount === 0
+                                cursorShape: enabled ? Qt.PointingHandCursor : Qt.ArrowCursor
+                                onClicked: NetworkManager.starTopology = !NetworkManager.starTopology
+                            }
+                        }
                     }
                 }
 
@@ -18,22 +18,15 @@ FocusScope {
 
     // Game state
     property string targetText: NetworkManager.gameText
-    property var typedChars: []
-    property string typedText: typedChars.join("")
-    property int cursorPosition: typedChars.length
-    property bool gameStarted: false
-    property bool gameEnded: false
-    property int correctChars: 0
-    property int incorrectChars: 0
-    property int totalKeystrokes: 0
-    property real startTime: 0
+    readonly property int cursorPosition: typingSession.cursorPosition
+    readonly property bool gameStarted: typingSession.started
+    readonly property bool gameEnded: typingSession.finished
+    readonly property int correctChars: typingSession.correctChars
+    readonly property int incorrectChars: typingSession.incorrectChars
+    readonly property int totalKeystrokes: typingSession.totalKeystrokes
     property int elapsedTime: 0
-    property var correctPositions: ({})
-    property var errorPositions: ({})
 
-    // Race state - use a simple counter to force rebinding
-    property var players: NetworkManager.players
-    property int playerUpdateCounter: 0
+    // Race state
     property bool showCountdown: false
     property int trackHeight: 100
 
@@ -50,155 +43,60 @@ FocusScope {
         z: -100
     }
 
-    // Word processing
-    property var words: targetText.split(" ")
-
-    function buildWordInfo() {
-        var result = [];
-        var currentIndex = 0;
-        for (var i = 0; i < words.length; i++) {
-            result.push({
-                word: words[i],
-                startIndex: currentIndex,
-                endIndex: currentIndex + words[i].length - 1
-            });
-            currentIndex += words[i].length + 1;
-        }
-        return result;
-    }
-    property var wordInfo: buildWordInfo()
-
-    function getCharState(index) {
-        if (index < cursorPosition) {
-            if (index < typedChars.length) {
-                var typedChar = typedChars[index];
-                var targetChar = targetText.charAt(index);
-                return typedChar === targetChar ? "correct" : "incorrect";
-            }
-            return "pending";
-        } else if (index === cursorPosition) {
-            return "current";
-        }
-        return "pending";
-    }
+    // Typing engine shared with single-player (C++ TypingSession)
+    TypingSession {
+        id: typingSession
+        targetText: raceGameplayPage.targetText
 
-    function findCurrentWordStart() {
-        for (var i = 0; i < wordInfo.length; i++) {
-            if (cursorPosition >= wordInfo[i].startIndex && cursorPosition <= wordInfo[i].endIndex + 1) {
-                return wordInfo[i].startIndex;
+        onStartedChanged: {
+            if (started) {
+                elapsedTimer.start();
+                statsTimer.start();
             }
         }
-        return cursorPosition;
-    }
+        onCorrectTyped: GameBackend.playCorrectSound()
+        onErrorTyped: GameBackend.playErrorSound()
+        onCursorPositionChanged: {
+            if (!started)
+                return;
+            updateStats();
 
-    function canDeleteAtPosition() {
-        if (cursorPosition <= 0)
-            return false;
-        var lockedLimit = 0;
-        for (var i = 0; i < wordInfo.length - 1; i++) {
-            var wordEnd = wordInfo[i].endIndex;
-            var spacePos = wordEnd + 1;
-            if (spacePos < cursorPosition) {
-                var wordAllCorrect = true;
-                for (var j = wordInfo[i].startIndex; j <= wordEnd; j++) {
-                    if (j >= typedChars.length || typedChars[j] !== targetText.charAt(j)) {
-                        wordAllCorrect = false;
-                        break;
-                    }
-                }
-                if (wordAllCorrect && spacePos < typedChars.length && typedChars[spacePos] === " ") {
-                    lockedLimit = spacePos + 1;
-                }
-            }
+            // Update network progress
+            NetworkManager.updateProgress(cursorPosition, length, raceGameplayPage.currentWpm);
         }
-        return cursorPosition > lockedLimit;
+        onSessionFinished: finishRace()
     }
 
     function updateStats() {
-        if (!gameStarted || startTime <= 0) {
+        if (!gameStarted) {
             currentWpm = 0;
             currentAccuracy = 100;
             return;
         }
-        var elapsedSecs = (Date.now() - startTime) / 1000;
-        if (elapsedSecs < 0.5) {
+        var results = typingSession.results();
+        if (results.timeElapsed < 0.5) {
             currentWpm = 0;
             currentAccuracy = 100;
             return;
         }
-        var minutes = elapsedSecs / 60;
-        currentWpm = Math.round((correctChars / 5) / minutes);
-        currentAccuracy = totalKeystrokes > 0 ? Math.round((correctChars / totalKeystrokes) * 1000) / 10 : 100;
+        currentWpm = Math.round(results.wpm);
+        currentAccuracy = totalKeystrokes > 0 ? Math.round(results.accuracy * 10) / 10 : 100;
     }
 
     function handleKeyPress(event) {
         if (gameEnded)
             return;
 
-        // Start game on first keystroke
-        if (!gameStarted && event.text.length === 1) {
-            gameStarted = true;
-            startTime = Date.now();
-            elapsedTimer.start();
-            statsTimer.start();
-        }
-
         if (event.key === Qt.Key_Backspace) {
-            if (canDeleteAtPosition() && typedChars.length > 0) {
-                var deletedPos = typedChars.length - 1;
-                if (correctPositions[deletedPos])
-                    delete correctPositions[deletedPos];
-                if (errorPositions[deletedPos])
-                    delete errorPositions[deletedPos];
-                typedChars = typedChars.slice(0, -1);
-                typedCharsChanged();
-            }
-        } else if (event.text.length === 1 && cursorPosition < targetText.length) {
-            var inputChar = event.text;
-            var expectedChar = targetText.charAt(cursorPosition);
-            var isCorrect = (inputChar === expectedChar);
-
-            // Save position BEFORE modifying array
-            var typedPosition = cursorPosition;
-
-            var newTypedChars = typedChars.slice();
-            newTypedChars.push(inputChar);
-            typedChars = newTypedChars;
-
-            totalKeystrokes++;
-
-            // Use saved position for correct tracking
-            if (isCorrect && !correctPositions[typedPosition]) {
-                correctChars++;
-                correctPositions[typedPosition] = true;
-                GameBackend.playCorrectSound();
-            } else if (!isCorrect && !errorPositions[typedPosition]) {
-                incorrectChars++;
-                errorPositions[typedPosition] = true;
-                GameBackend.playErrorSound();
-            }
-
-            // Update stats
-            updateStats();
-
-            // Update network progress
-            NetworkManager.updateProgress(typedChars.length, targetText.length, currentWpm);
-
-            // Force refresh players list to update race track
-            playerUpdateCounter++;
-            players = NetworkManager.players;
-
-            // Check completion
-            if (typedChars.length >= targetText.length) {
-                finishRace();
-            }
+            typingSession.backspace();
+        } else if (event.text.length === 1) {
+            // Session starts its timer on the first keystroke and finishes
+            // itself when the last character is typed
+            typingSession.inputText(event.text);
         }
     }
 
     function finishRace() {
-        if (gameEnded)
-            return;
-        gameEnded = true;
         elapsedTimer.stop();
         statsTimer.stop();
         updateStats();
@@ -207,15 +105,7 @@ FocusScope {
     }
 
     function resetGame() {
-        typedChars = [];
-        correctPositions = {};
-        errorPositions = {};
-        correctChars = 0;
-        incorrectChars = 0;
-        totalKeystrokes = 0;
-        gameStarted = false;
-        gameEnded = false;
-        startTime = 0;
+        typingSession.reset();
         elapsedTime = 0;
         currentWpm = 0;
         currentAccuracy = 100;
@@ -223,6 +113,21 @@ FocusScope {
         hiddenInput.forceActiveFocus();
     }
 
+    // PagePool hooks: the page is reused across races instead of recreated
+    function activate() {
+        resetGame();
+        // Scheduled against the host clock so all players see GO together
+        countdownOverlay.startIn(NetworkManager.msUntilRaceStart());
+    }
+
+    function deactivate() {
+        countdownOverlay.stop();
+        elapsedTimer.stop();
+        statsTimer.stop();
+        typingSession.reset();
+        hiddenInput.clear();
+    }
+
     // Timers
     Timer {
         id: elapsedTimer
@@ -238,13 +143,10 @@ FocusScope {
         onTriggered: updateStats()
     }
 
-    // Network event handlers
+    // Network event handlers (only while on screen; the page idles in a pool between races)
     Connections {
         target: NetworkManager
-
-        function onPlayerProgressUpdated(id, name, progress, wpm, finished, position) {
-            players = NetworkManager.players;
-        }
+        enabled: raceGameplayPage.StackView.status === StackView.Active
 
         function onRaceFinished(rankings) {
             raceGameplayPage.raceCompleted(currentWpm, currentAccuracy, incorrectChars);
@@ -269,8 +171,7 @@ FocusScope {
         anchors.right: parent.right
         anchors.margins: Theme.paddingL
         height: trackHeight
-        // Bind with counter to force updates
-        players: playerUpdateCounter >= 0 ? raceGameplayPage.players : []
+        players: NetworkManager.playersModel
     }
 
     // Main centered content (like single-player)
@@ -314,138 +215,15 @@ FocusScope {
                 // Text Display (borderless, clean like single-player)
                 Rectangle {
                     Layout.fillWidth: true
-                    Layout.preferredHeight: textFlow.implicitHeight + 96
+                    Layout.preferredHeight: textGrid.implicitHeight + 96
                     color: "transparent"
 
-                    Flow {
-                        id: textFlow
+                    TypingText {
+                        id: textGrid
                         anchors.fill: parent
                         anchors.margins: 48
-                        spacing: 0
-
-                        Repeater {
-                            model: wordInfo.length
-
-                            Row {
-                                property int wordIndex: index
-                                spacing: 0
-                                height: 48
-
-                                Repeater {
-                                    model: wordInfo[wordIndex] ? wordInfo[wordIndex].word.length : 0
-
-                                    Text {
-                                        property int charIndex: wordInfo[parent.wordIndex].startIndex + index
-                                        // Explicitly depend on cursorPosition for reactivity
-                                        property string charState: cursorPosition >= 0 ? getCharState(charIndex) : "pending"
-
-                                        text: targetText.charAt(charIndex)
-                                        font.family: Theme.fontFamily
-                                        font.pixelSize: 28
-                                        font.letterSpacing: 0.5
-
-                                        color: {
-                                            switch (charState) {
-                                            case "correct":
-                                                return Theme.textPrimary;
-                                            case "incorrect":
-                                                return Theme.accentRed;
-                                            case "current":
-                                                return Theme.textMuted;
-                                            default:
-                                                return Theme.textMuted;
-                                            }
-                                        }
-
-                                        // Background for incorrect chars
-                                        Rectangle {
-                                            anchors.left: parent.left
-                                            anchors.right: parent.right
-                                            anchors.verticalCenter: parent.verticalCenter
-                                            height: parent.font.pixelSize + 8
-                                            color: parent.charState === "incorrect" ? Qt.rgba(248 / 255, 81 / 255, 73 / 255, 0.15) : "transparent"
-                                            z: -1
-                                        }
-
-                                        // Caret cursor
-                                        Rectangle {
-                                            visible: parent.charState === "current"
-                                            anchors.left: parent.left
-                                            anchors.leftMargin: -1
-                                            anchors.verticalCenter: parent.verticalCenter
-                                            width: 2
-                                            height: parent.font.pixelSize + 6
-                                            color: Theme.accentBlue
-
-                                            SequentialAnimation on opacity {
-                                                running: parent.charState === "current" && !gameStarted
-                                                loops: Animation.Infinite
-                                                NumberAnimation {
-                                                    to: 0
-                                                    duration: 500
-                                                }
-                                                NumberAnimation {
-                                                    to: 1
-                                                    duration: 500
-                                                }
-                                            }
-                                        }
-                                    }
-                                }
-
-                                // Space after word
-                                Text {
-                                    id: spaceText
-                                    visible: wordIndex < wordInfo.length - 1
-                                    property int spaceIndex: wordInfo[wordIndex].endIndex + 1
-                                    // Explicitly depend on cursorPosition for reactivity
-                                    property string charState: cursorPosition >= 0 ? getCharState(spaceIndex) : "pending"
-                                    property string typedChar: spaceIndex < typedChars.length ? typedChars[spaceIndex] : ""
-                                    property string displayChar: charState === "incorrect" && typedChar.length > 0 ? typedChar : " "
-
-                                    text: displayChar
-                                    font.family: Theme.fontFamily
-                                    font.pixelSize: 28
-                                    font.letterSpacing: 0.5
-                                    color: charState === "incorrect" ? Theme.accentRed : Theme.textMuted
-
-                                    // Background for incorrect space
-                                    Rectangle {
-                                        visible: parent.charState === "incorrect"
-                                        anchors.left: parent.left
-                                        anchors.right: parent.right
-                                        anchors.verticalCenter: parent.verticalCenter
-                                        height: 36
-                                        color: Qt.rgba(248 / 255, 81 / 255, 73 / 255, 0.15)
-                                        z: -1
-                                    }
-
-                                    // Caret cursor at space
-                                    Rectangle {
-                                        visible: parent.charState === "current"
-                                        anchors.left: parent.left
-                                        anchors.leftMargin: -1
-                                        anchors.verticalCenter: parent.verticalCenter
-                                        width: 2
-                                        height: 34
-                                        color: Theme.accentBlue
-
-                                        SequentialAnimation on opacity {
-                                            running: parent.charState === "current" && !gameStarted
-                                            loops: Animation.Infinite
-                                            NumberAnimation {
-                                                to: 0
-                                                duration: 500
-                                            }
-                                            NumberAnimation {
-                                                to: 1
-                                                duration: 500
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
+                        session: typingSession
+                        caretBlinking: !gameStarted
                     }
                 }
 
@@ -562,6 +340,8 @@ FocusScope {
         focus: true
 
         Keys.onPressed: function (event) {
+            if (PerfMonitor.enabled)
+                PerfMonitor.markKeystroke();
             // ESC key: leave race instead of processing as input
             if (event.key === Qt.Key_Escape) {
                 NetworkManager.leaveRoom();
@@ -588,8 +368,4 @@ FocusScope {
             event.accepted = true;
         }
     }
-
-    Component.onCompleted: {
-        countdownOverlay.start();
-    }
 }
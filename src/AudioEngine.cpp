@@ -0,0 +1,367 @@
+#include "AudioEngine.h"
+#include <QAudioDevice>
+#include <QAudioSink>
+#include <QDebug>
+#include <QFile>
+#include <QMediaDevices>
+#include <QThread>
+#include <QTimer>
+#include <QtEndian>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// ============================================================================
+// WAV DECODING
+// ============================================================================
+
+// Read one PCM sample as float in [-1, 1]
+float readPcm(const uchar* p, int bits, bool isFloat) {
+    if (isFloat) {
+        float value;
+        const quint32 raw = qFromLittleEndian<quint32>(p);
+        std::memcpy(&value, &raw, sizeof(value));
+        return value;
+    }
+    switch (bits) {
+        case 8:  return (int(p[0]) - 128) / 128.0f;
+        case 16: return qFromLittleEndian<qint16>(p) / 32768.0f;
+        case 24: return qint32((quint32(p[0]) << 8) | (quint32(p[1]) << 16) | (quint32(p[2]) << 24))
+                        / 2147483648.0f;
+        case 32: return qFromLittleEndian<qint32>(p) / 2147483648.0f;
+        default: return 0.0f;
+    }
+}
+
+// Decode a RIFF/WAVE file into interleaved stereo float at targetRate
+bool decodeWav(const QByteArray& file, int targetRate, std::vector<float>& out) {
+    const uchar* data = reinterpret_cast<const uchar*>(file.constData());
+    const qsizetype size = file.size();
+    if (size < 12 || std::memcmp(data, "RIFF", 4) != 0 || std::memcmp(data + 8, "WAVE", 4) != 0) {
+        return false;
+    }
+
+    int channels = 0, rate = 0, bits = 0;
+    bool isFloat = false;
+    const uchar* pcm = nullptr;
+    qsizetype pcmBytes = 0;
+
+    // Walk the chunks; "fmt " must precede "data"
+    for (qsizetype offset = 12; offset + 8 <= size;) {
+        const quint32 chunkSize = qFromLittleEndian<quint32>(data + offset + 4);
+        const uchar* body = data + offset + 8;
+        const qsizetype available = qMin<qsizetype>(chunkSize, size - offset - 8);
+
+        if (std::memcmp(data + offset, "fmt ", 4) == 0 && available >= 16) {
+            const quint16 tag = qFromLittleEndian<quint16>(body);
+            channels = qFromLittleEndian<quint16>(body + 2);
+            rate = int(qFromLittleEndian<quint32>(body + 4));
+            bits = qFromLittleEndian<quint16>(body + 14);
+            isFloat = tag == 3;
+            if (tag != 1 && tag != 3 && tag != 0xFFFE) return false;  // PCM, float, extensible
+            if (tag == 0xFFFE && available >= 26) {
+                isFloat = qFromLittleEndian<quint16>(body + 24) == 3;
+            }
+        } else if (std::memcmp(data + offset, "data", 4) == 0) {
+            pcm = body;
+            pcmBytes = available;
+            break;
+        }
+        offset += 8 + qsizetype(chunkSize) + (chunkSize & 1);  // Chunks are word aligned
+    }
+
+    // Only depths readPcm knows; anything else (including 0) would leave
+    // frameBytes meaningless or zero
+    const bool supportedBits = isFloat ? bits == 32 : (bits == 8 || bits == 16 || bits == 24 || bits == 32);
+    if (!pcm || channels < 1 || rate <= 0 || !supportedBits) {
+        return false;
+    }
+
+    // To float stereo at the source rate
+    const int frameBytes = channels * bits / 8;
+    const qsizetype frames = pcmBytes / frameBytes;
+    std::vector<float> source(size_t(frames) * 2);
+    for (qsizetype i = 0; i < frames; ++i) {
+        const uchar* frame = pcm + i * frameBytes;
+        const float left = readPcm(frame, bits, isFloat);
+        const float right = channels > 1 ? readPcm(frame + bits / 8, bits, isFloat) : left;
+        source[size_t(i) * 2] = left;
+        source[size_t(i) * 2 + 1] = right;
+    }
+
+    if (rate == targetRate) {
+        out = std::move(source);
+        return true;
+    }
+
+    // Linear resampling is plenty for short UI effects
+    const double step = double(rate) / double(targetRate);
+    const qsizetype outFrames = qsizetype(double(frames) / step);
+    out.resize(size_t(outFrames) * 2);
+    for (qsizetype i = 0; i < outFrames; ++i) {
+        const double position = i * step;
+        const qsizetype index = qsizetype(position);
+        const float t = float(position - double(index));
+        const qsizetype next = qMin(index + 1, frames - 1);
+        for (int c = 0; c < 2; ++c) {
+            const float a = source[size_t(index) * 2 + c];
+            const float b = source[size_t(next) * 2 + c];
+            out[size_t(i) * 2 + c] = a + (b - a) * t;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+// ============================================================================
+// AUDIO ENGINE
+// ============================================================================
+
+AudioEngine::AudioEngine(QObject* parent)
+    : QObject(parent)
+    , m_samples(std::make_shared<std::vector<Sample>>())
+{
+    // Ask for stereo 16-bit at the device's own rate so nothing resamples
+    // behind our back; fall back to whatever the device prefers
+    const QAudioDevice device = QMediaDevices::defaultAudioOutput();
+    m_format = device.preferredFormat();
+    QAudioFormat stereo16 = m_format;
+    stereo16.setChannelCount(2);
+    stereo16.setSampleFormat(QAudioFormat::Int16);
+    if (device.isFormatSupported(stereo16)) {
+        m_format = stereo16;
+    }
+    if (m_format.sampleRate() <= 0) {
+        m_format.setSampleRate(48000);
+    }
+}
+
+AudioEngine::~AudioEngine() {
+    if (m_thread) {
+        QMetaObject::invokeMethod(m_mixer, &AudioMixer::stopOutput, Qt::BlockingQueuedConnection);
+        m_thread->quit();
+        m_thread->wait();
+        delete m_mixer;
+        delete m_thread;
+    }
+}
+
+int AudioEngine::loadSample(const QString& path) {
+    if (m_thread) {
+        qWarning() << "[AudioEngine] loadSample after start() ignored:" << path;
+        return -1;
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "[AudioEngine] Cannot open" << path;
+        return -1;
+    }
+
+    Sample sample;
+    if (!decodeWav(file.readAll(), m_format.sampleRate(), sample.frames)) {
+        qWarning() << "[AudioEngine] Unsupported WAV file:" << path;
+        return -1;
+    }
+
+    m_samples->push_back(std::move(sample));
+    return int(m_samples->size()) - 1;
+}
+
+void AudioEngine::start() {
+    if (m_thread) return;
+
+    m_thread = new QThread();
+    m_thread->setObjectName("AudioEngine");
+    m_mixer = new AudioMixer(m_format, m_samples, &m_triggers);
+    m_mixer->moveToThread(m_thread);
+    connect(m_thread, &QThread::started, m_mixer, &AudioMixer::startOutput);
+
+    // Default output changed (headphones plugged, device removed): queued
+    // onto the audio thread, where the sink lives
+    m_devices = new QMediaDevices(this);
+    connect(m_devices, &QMediaDevices::audioOutputsChanged, m_mixer, &AudioMixer::scheduleRestart);
+
+    m_thread->start(QThread::TimeCriticalPriority);
+}
+
+void AudioEngine::play(int sampleId, float volume) {
+    if (!m_thread || sampleId < 0 || sampleId >= int(m_samples->size())) return;
+    m_triggers.push({ sampleId, volume });  // Dropped if 64 triggers are already pending
+}
+
+// ============================================================================
+// AUDIO MIXER (audio thread)
+// ============================================================================
+
+AudioMixer::AudioMixer(const QAudioFormat& format,
+                       std::shared_ptr<const std::vector<AudioEngine::Sample>> samples,
+                       SpscRing<AudioEngine::Trigger, 64>* triggers)
+    : m_format(format)
+    , m_samples(std::move(samples))
+    , m_triggers(triggers)
+{
+}
+
+void AudioMixer::startOutput() {
+    open(QIODevice::ReadOnly);
+    openSink();
+}
+
+void AudioMixer::stopOutput() {
+    closeSink();
+    close();
+}
+
+void AudioMixer::openSink() {
+    const QAudioDevice device = QMediaDevices::defaultAudioOutput();
+    if (device.isNull()) {
+        // No output at all: wait for audioOutputsChanged
+        qWarning() << "[AudioEngine] No audio output device";
+        return;
+    }
+    if (!device.isFormatSupported(m_format)) {
+        qWarning() << "[AudioEngine] Output" << device.description()
+                   << "does not report support for the mixer format; trying anyway";
+    }
+
+    m_sink = new QAudioSink(device, m_format, this);
+    m_sink->setBufferSize(m_format.bytesForDuration(AudioEngine::BUFFER_MS * 1000));
+    connect(m_sink, &QAudioSink::stateChanged, this, &AudioMixer::onSinkStateChanged);
+    m_sink->start(this);  // Pull mode: the sink calls readData() as it needs data
+
+    qDebug() << "[AudioEngine] Output" << device.description() << m_format.sampleRate() << "Hz,"
+             << m_format.channelCount() << "ch, buffer" << m_sink->bufferSize() << "bytes";
+}
+
+void AudioMixer::closeSink() {
+    if (!m_sink) return;
+
+    // Disconnect first: stop() reports StoppedState, which is not a failure here
+    m_sink->disconnect(this);
+    m_sink->stop();
+    delete m_sink;
+    m_sink = nullptr;
+}
+
+void AudioMixer::onSinkStateChanged() {
+    // IdleState (underrun) recovers by itself; a stop with an error does not
+    if (m_sink->state() == QAudio::StoppedState && m_sink->error() != QAudio::NoError) {
+        qWarning() << "[AudioEngine] Output stopped with error" << m_sink->error() << "- reopening";
+        scheduleRestart();
+    }
+}
+
+void AudioMixer::scheduleRestart() {
+    if (m_restartPending || !isOpen()) return;  // Already queued, or shutting down
+
+    // Deferred: never delete the sink from inside its own signal, and a
+    // device that keeps failing is retried at most every RESTART_DELAY_MS
+    m_restartPending = true;
+    QTimer::singleShot(RESTART_DELAY_MS, this, [this]() {
+        m_restartPending = false;
+        if (!isOpen()) return;
+        closeSink();
+        openSink();
+    });
+}
+
+qint64 AudioMixer::bytesAvailable() const {
+    // An endless stream: there is always a buffer's worth to pull
+    return (m_sink ? m_sink->bufferSize() : 0) + QIODevice::bytesAvailable();
+}
+
+qint64 AudioMixer::writeData(const char* data, qint64 maxSize) {
+    Q_UNUSED(data)
+    Q_UNUSED(maxSize)
+    return 0;
+}
+
+qint64 AudioMixer::readData(char* data, qint64 maxSize) {
+    m_triggers->drain([this](const AudioEngine::Trigger& trigger) { startVoice(trigger); });
+
+    const int frameBytes = m_format.bytesPerFrame();
+    if (frameBytes <= 0) return 0;
+
+    const qint64 frames = maxSize / frameBytes;
+    float stereo[MIX_CHUNK_FRAMES * 2];
+    for (qint64 done = 0; done < frames;) {
+        const int chunk = int(qMin<qint64>(MIX_CHUNK_FRAMES, frames - done));
+        mix(stereo, chunk);
+        convert(stereo, data + done * frameBytes, chunk);
+        done += chunk;
+    }
+    return frames * frameBytes;
+}
+
+void AudioMixer::startVoice(const AudioEngine::Trigger& trigger) {
+    // Free voice, or steal the oldest one
+    Voice* target = &m_voices[0];
+    for (Voice& voice : m_voices) {
+        if (voice.sampleId < 0) {
+            target = &voice;
+            break;
+        }
+        if (voice.age < target->age) target = &voice;
+    }
+    target->sampleId = trigger.sampleId;
+    target->position = 0;
+    target->volume = trigger.volume;
+    target->age = ++m_triggerCount;
+}
+
+void AudioMixer::mix(float* stereo, int frames) {
+    std::fill(stereo, stereo + frames * 2, 0.0f);
+
+    for (Voice& voice : m_voices) {
+        if (voice.sampleId < 0) continue;
+
+        const AudioEngine::Sample& sample = (*m_samples)[size_t(voice.sampleId)];
+        const qint64 count = qMin<qint64>(frames, sample.frameCount() - voice.position);
+        const float* src = sample.frames.data() + voice.position * 2;
+        for (qint64 i = 0; i < count * 2; ++i) {
+            stereo[i] += src[i] * voice.volume;
+        }
+
+        voice.position += count;
+        if (voice.position >= sample.frameCount()) {
+            voice.sampleId = -1;
+        }
+    }
+}
+
+void AudioMixer::convert(const float* stereo, char* out, int frames) const {
+    const int channels = m_format.channelCount();
+    const int bytes = m_format.bytesPerSample();
+    std::memset(out, 0, size_t(frames) * size_t(m_format.bytesPerFrame()));
+
+    for (int i = 0; i < frames; ++i) {
+        const float left = std::clamp(stereo[i * 2], -1.0f, 1.0f);
+        const float right = std::clamp(stereo[i * 2 + 1], -1.0f, 1.0f);
+        char* frame = out + i * channels * bytes;
+
+        // Mono devices get the average; extra channels stay silent
+        const int written = qMin(channels, 2);
+        for (int c = 0; c < written; ++c) {
+            const float value = channels == 1 ? (left + right) * 0.5f : (c == 0 ? left : right);
+            switch (m_format.sampleFormat()) {
+                case QAudioFormat::UInt8:
+                    reinterpret_cast<quint8*>(frame)[c] = quint8(value * 127.0f + 128.0f);
+                    break;
+                case QAudioFormat::Int16:
+                    reinterpret_cast<qint16*>(frame)[c] = qint16(value * 32767.0f);
+                    break;
+                case QAudioFormat::Int32:
+                    reinterpret_cast<qint32*>(frame)[c] = qint32(value * 2147483647.0);
+                    break;
+                case QAudioFormat::Float:
+                    reinterpret_cast<float*>(frame)[c] = value;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
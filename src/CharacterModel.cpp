@@ -0,0 +1,216 @@
+/**
+ * @file CharacterModel.cpp
+ * @brief Implementation of CharacterModel list model
+ * @author Alea Farrel & Team
+ * @date 2025
+ */
+
+#include "CharacterModel.h"
+#include "TypingSession.h"
+
+CharacterModel::CharacterModel(const TypingSession *session, QObject *parent)
+    : QAbstractListModel(parent), m_session(session), m_columns(40),
+      m_lineCount(0) {}
+
+// ============================================================================
+// QABSTRACTLISTMODEL INTERFACE
+// ============================================================================
+
+int CharacterModel::rowCount(const QModelIndex &parent) const {
+  if (parent.isValid())
+    return 0;
+  return int(m_cells.size());
+}
+
+QVariant CharacterModel::data(const QModelIndex &index, int role) const {
+  if (!index.isValid() || index.row() < 0 ||
+      index.row() >= int(m_cells.size()))
+    return QVariant();
+
+  const int row = index.row();
+  const Cell &cell = m_cells[size_t(row)];
+  switch (role) {
+  case CharacterRole:
+    return QString(m_text.at(row));
+  case StateRole:
+    return m_session->charState(row);
+  case WordIndexRole:
+    return cell.wordIndex;
+  case LineRole:
+    return cell.line;
+  case ColumnRole:
+    return cell.column;
+  case DisplayRole: {
+    // A mistyped space shows what was actually typed
+    if (m_text.at(row) == QLatin1Char(' ') &&
+        m_session->charState(row) == TypingSession::Incorrect)
+      return m_session->typedCharAt(row);
+    return QString(m_text.at(row));
+  }
+  case IsSpaceRole:
+    return m_text.at(row) == QLatin1Char(' ');
+  default:
+    return QVariant();
+  }
+}
+
+QHash<int, QByteArray> CharacterModel::roleNames() const {
+  return {{CharacterRole, "character"}, {StateRole, "charState"},
+          {WordIndexRole, "wordIndex"}, {LineRole, "line"},
+          {ColumnRole, "column"},       {DisplayRole, "displayChar"},
+          {IsSpaceRole, "isSpace"}};
+}
+
+// ============================================================================
+// LAYOUT
+// ============================================================================
+
+int CharacterModel::columns() const { return m_columns; }
+
+void CharacterModel::setColumns(int columns) {
+  columns = qMax(1, columns);
+  if (columns == m_columns)
+    return;
+  m_columns = columns;
+  emit columnsChanged();
+
+  layoutCells();
+  if (!m_cells.empty())
+    emit dataChanged(index(0), index(int(m_cells.size()) - 1),
+                     {LineRole, ColumnRole});
+}
+
+int CharacterModel::lineCount() const { return m_lineCount; }
+
+void CharacterModel::setText(const QString &text) {
+  beginResetModel();
+  m_text = text;
+  m_cells.assign(size_t(text.size()), Cell{0, 0, 0});
+
+  int word = 0;
+  for (qsizetype i = 0; i < text.size(); ++i) {
+    m_cells[size_t(i)].wordIndex = word;
+    if (text.at(i) == QLatin1Char(' '))
+      ++word;
+  }
+
+  layoutCells();
+  endResetModel();
+}
+
+void CharacterModel::appendText(const QString &text) {
+  if (text.isEmpty())
+    return;
+
+  const int first = int(m_cells.size());
+  int word = 0;
+  if (first > 0)
+    word = m_cells.back().wordIndex +
+           (m_text.at(first - 1) == QLatin1Char(' ') ? 1 : 0);
+
+  beginInsertRows(QModelIndex(), first, first + int(text.size()) - 1);
+  m_text += text;
+  m_cells.resize(size_t(m_text.size()), Cell{0, 0, 0});
+  for (qsizetype i = first; i < m_text.size(); ++i) {
+    m_cells[size_t(i)].wordIndex = word;
+    if (m_text.at(i) == QLatin1Char(' '))
+      ++word;
+  }
+  layoutCells();
+  endInsertRows();
+
+  // The old last word gained a trailing space and may have wrapped
+  if (first > 0)
+    emit dataChanged(index(0), index(first - 1), {LineRole, ColumnRole});
+}
+
+void CharacterModel::removeLeading(int count) {
+  count = qMin(count, int(m_cells.size()));
+  if (count <= 0)
+    return;
+
+  beginRemoveRows(QModelIndex(), 0, count - 1);
+  m_text.remove(0, count);
+  m_cells.erase(m_cells.begin(), m_cells.begin() + count);
+  layoutCells();
+  endRemoveRows();
+
+  // Every remaining cell moved up by the retired lines
+  if (!m_cells.empty())
+    emit dataChanged(index(0), index(int(m_cells.size()) - 1),
+                     {LineRole, ColumnRole});
+}
+
+int CharacterModel::lineOf(int index) const {
+  if (m_cells.empty())
+    return 0;
+  if (index >= int(m_cells.size()))
+    return m_cells.back().line;
+  return m_cells[size_t(qMax(0, index))].line;
+}
+
+int CharacterModel::lineStart(int line) const {
+  if (line <= 0)
+    return 0;
+  // Cells are few (a window of lines), a linear scan is enough
+  for (size_t i = 0; i < m_cells.size(); ++i) {
+    if (m_cells[i].line >= line)
+      return int(i);
+  }
+  return int(m_cells.size());
+}
+
+/**
+ * Greedy word wrap, matching the previous Flow of per-word Rows: a word and
+ * its trailing space move to the next line together when they do not fit.
+ * Words longer than a line start on their own line and overflow.
+ */
+void CharacterModel::layoutCells() {
+  const int count = int(m_cells.size());
+  int line = 0;
+  int column = 0;
+
+  int start = 0;
+  while (start < count) {
+    int end = start;
+    while (end < count && m_text.at(end) != QLatin1Char(' '))
+      ++end;
+    // Include the trailing space in the unit
+    const int unitEnd = end < count ? end + 1 : end;
+    const int unitLength = unitEnd - start;
+
+    if (column > 0 && column + unitLength > m_columns) {
+      ++line;
+      column = 0;
+    }
+    for (int i = start; i < unitEnd; ++i) {
+      m_cells[size_t(i)].line = line;
+      m_cells[size_t(i)].column = column++;
+    }
+    start = unitEnd;
+  }
+
+  const int lines = count > 0 ? line + 1 : 0;
+  if (lines != m_lineCount) {
+    m_lineCount = lines;
+    emit lineCountChanged();
+  }
+}
+
+// ============================================================================
+// STATE UPDATES
+// ============================================================================
+
+void CharacterModel::cellChanged(int row) {
+  if (row < 0 || row >= int(m_cells.size()))
+    return;
+  const QModelIndex idx = index(row);
+  emit dataChanged(idx, idx, {StateRole, DisplayRole});
+}
+
+void CharacterModel::allCellsChanged() {
+  if (m_cells.empty())
+    return;
+  emit dataChanged(index(0), index(int(m_cells.size()) - 1),
+                   {StateRole, DisplayRole});
+}
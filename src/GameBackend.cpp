@@ -6,14 +6,16 @@
  */
 
 #include "GameBackend.h"
+#include "AudioEngine.h"
 #include <QDir>
 #include <QFile>
 #include <QJSEngine>
 #include <QQmlEngine>
-#include <QSoundEffect>
 #include <QStandardPaths>
-#include <QTimer>
+#include <QtConcurrent/QtConcurrentRun>
 #include <algorithm>
+#include <utility>
+#include <iterator>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -22,48 +24,51 @@
 // Static instance
 GameBackend *GameBackend::s_instance = nullptr;
 
+/**
+ * Data loaded by the background initialization task. The managers are
+ * built on the worker thread and moved into GameBackend on the GUI thread,
+ * so no member is ever touched from two threads.
+ */
+struct GameBackend::InitialData {
+  TextProvider textProvider;
+  HistoryManager historyManager{false};
+  ProgressManager progressManager{false};
+};
+
 // ============================================================================
 // CONSTRUCTOR & SINGLETON
 // ============================================================================
 
 GameBackend::GameBackend(QObject *parent)
-    : QObject(parent), m_correctSound(nullptr), m_errorSound(nullptr),
-      m_audioKeepAliveTimer(nullptr), m_sfxEnabled(true),
+    : QObject(parent), m_initWatcher(nullptr), m_ready(false),
+      m_loadProgress(0.0), m_historyManager(false), m_progressManager(false),
+      m_historyModel(nullptr), m_ghostPlayers(nullptr), m_ghostElapsedUs(0),
+      m_ghostLoaded(false), m_audio(nullptr), m_correctSample(-1),
+      m_errorSample(-1), m_sfxEnabled(true),
       m_defaultDuration(30) {
+  // History list model reads straight from m_historyManager's columns
+  m_historyModel = new HistoryModel(&m_historyManager, this);
+  m_ghostPlayers = new PlayersModel(this);
+
   // Load settings from file
   loadSettings();
 
   // Initialize SFX
   initializeSfx();
 
-  // Start timers for rate limiting and audio keepalive
-  m_errorSoundTimer.start();
-  m_lastSoundPlayedTimer.start();
-
-  // Setup audio keepalive timer - prevent Windows audio device sleep
-  m_audioKeepAliveTimer = new QTimer(this);
-  connect(m_audioKeepAliveTimer, &QTimer::timeout, this,
-          &GameBackend::onAudioKeepAlive);
-  m_audioKeepAliveTimer->start(AUDIO_KEEPALIVE_MS);
-
-  // Load word banks
   QString dataPath =
       QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
   QDir().mkpath(dataPath);
 
-  // Load from Qt resources (Qt 6 QML module path format)
-  m_textProvider.loadWords("id", ":/qt/qml/rapid_texter/assets/id.txt");
-  m_textProvider.loadWords("en", ":/qt/qml/rapid_texter/assets/en.txt");
-  m_textProvider.loadWords("prog", ":/qt/qml/rapid_texter/assets/prog.txt");
+  // Word banks, history and progress load off the GUI thread so the first
+  // frame (SplashScreen) does not wait on disk
+  startBackgroundLoad();
 }
 
 GameBackend::~GameBackend() {
-  if (m_audioKeepAliveTimer) {
-    m_audioKeepAliveTimer->stop();
-    delete m_audioKeepAliveTimer;
-  }
-  delete m_correctSound;
-  delete m_errorSound;
+  if (m_initWatcher)
+    m_initWatcher->waitForFinished();
+  delete m_audio;
 }
 
 GameBackend *GameBackend::instance() {
@@ -87,98 +92,182 @@ GameBackend *GameBackend::create(QQmlEngine *qmlEngine, QJSEngine *jsEngine) {
   return s_instance;
 }
 
+// ============================================================================
+// BACKGROUND INITIALIZATION
+// ============================================================================
+
+void GameBackend::startBackgroundLoad() {
+  m_initWatcher = new QFutureWatcher<std::shared_ptr<InitialData>>(this);
+  connect(m_initWatcher,
+          &QFutureWatcher<std::shared_ptr<InitialData>>::progressValueChanged,
+          this, [this](int value) {
+            const int range = m_initWatcher->progressMaximum();
+            m_loadProgress = range > 0 ? double(value) / range : 0.0;
+            emit loadProgressChanged();
+          });
+  connect(m_initWatcher,
+          &QFutureWatcher<std::shared_ptr<InitialData>>::finished, this,
+          &GameBackend::onBackgroundLoadFinished);
+
+  m_initWatcher->setFuture(QtConcurrent::run(
+      [](QPromise<std::shared_ptr<InitialData>> &promise) {
+        const char *languages[] = {"id", "en", "prog"};
+        const char *corpora[] = {"id", "en"}; // "prog" has no sentences
+        // One step per word bank and corpus, plus history and progress
+        promise.setProgressRange(
+            0, int(std::size(languages)) + int(std::size(corpora)) + 2);
+        int step = 0;
+
+        auto data = std::make_shared<InitialData>();
+
+        // Load from Qt resources (Qt 6 QML module path format). The binary
+        // word banks are generated at build time and mapped without
+        // parsing; the text lists stay as a fallback.
+        const std::string assets = ":/qt/qml/rapid_texter/assets/";
+        for (const std::string lang : languages) {
+          if (!data->textProvider.loadWords(lang, assets + "wordbanks/" +
+                                                      lang + ".rtwb"))
+            data->textProvider.loadWords(lang, assets + lang + ".txt");
+          promise.setProgressValue(++step);
+        }
+
+        // Markov tables for the "natural" text mode are built here, once
+        for (const std::string lang : corpora) {
+          data->textProvider.loadCorpus(lang,
+                                        assets + "corpus/" + lang + ".txt");
+          promise.setProgressValue(++step);
+        }
+
+        data->historyManager.loadHistory();
+        promise.setProgressValue(++step);
+
+        data->progressManager.loadProgress();
+        promise.setProgressValue(++step);
+
+        promise.addResult(std::move(data));
+      }));
+}
+
+void GameBackend::onBackgroundLoadFinished() {
+  const QFuture<std::shared_ptr<InitialData>> future = m_initWatcher->future();
+  if (future.resultCount() > 0) {
+    std::shared_ptr<InitialData> data = future.result();
+    m_textProvider = std::move(data->textProvider);
+    m_historyManager = std::move(data->historyManager);
+    m_progressManager = std::move(data->progressManager);
+  }
+
+  m_initWatcher->deleteLater();
+  m_initWatcher = nullptr;
+
+  m_loadProgress = 1.0;
+  m_ready = true;
+
+  // Writes requested while loading are applied on top of the loaded data
+  const QList<std::function<void()>> deferred =
+      std::exchange(m_deferredWrites, {});
+  for (const std::function<void()> &write : deferred)
+    write();
+
+  m_historyModel->reload();
+  updateBigramWeights();
+  emit loadProgressChanged();
+  emit readyChanged();
+  emit historyUpdated();
+  emit progressUpdated();
+}
+
+bool GameBackend::isReady() const { return m_ready; }
+
+double GameBackend::loadProgress() const { return m_loadProgress; }
+
 // ============================================================================
 // TEXT PROVIDER INTERFACE
 // ============================================================================
 
-QString GameBackend::getRandomText(const QString &language,
-                                   const QString &difficulty, int wordCount) {
-  Difficulty diff = stringToDifficulty(difficulty);
-  std::vector<std::string> words =
-      m_textProvider.getWords(language.toStdString(), diff, wordCount);
+// Join words with single spaces
+static QString joinWords(const std::vector<std::string_view> &words) {
+  // Word banks are sanitized to printable ASCII, so Latin-1 is exact
+  qsizetype totalLength = words.empty() ? 0 : qsizetype(words.size()) - 1;
+  for (const std::string_view &word : words)
+    totalLength += qsizetype(word.size());
 
   QString result;
+  result.reserve(totalLength);
   for (size_t i = 0; i < words.size(); ++i) {
     if (i > 0)
-      result += " ";
-    result += QString::fromStdString(words[i]);
+      result += QLatin1Char(' ');
+    result += QLatin1StringView(words[i].data(), qsizetype(words[i].size()));
   }
   return result;
 }
 
+QString GameBackend::getRandomText(const QString &language,
+                                   const QString &difficulty, int wordCount,
+                                   const QString &textMode) {
+  Difficulty diff = stringToDifficulty(difficulty);
+  return joinWords(m_textProvider.getWords(language.toStdString(), diff,
+                                           wordCount,
+                                           stringToTextMode(textMode)));
+}
+
+void GameBackend::startTextStream(const QString &language,
+                                  const QString &difficulty,
+                                  const QString &textMode) {
+  m_textStream = TextProvider::WordDeck();
+  m_textStream.language = language.toStdString();
+  m_textStream.difficulty = stringToDifficulty(difficulty);
+  m_textStream.mode = stringToTextMode(textMode);
+}
+
+QString GameBackend::nextTextChunk(int wordCount) {
+  return joinWords(m_textProvider.drawWords(m_textStream, wordCount));
+}
+
+QString GameBackend::getSeededText(const QString &language,
+                                   const QString &difficulty, int wordCount,
+                                   quint64 seed) {
+  return joinWords(m_textProvider.getSeededWords(
+      language.toStdString(), stringToDifficulty(difficulty), wordCount, seed));
+}
+
+quint64 GameBackend::wordBankHash(const QString &language) const {
+  return m_textProvider.bankHash(language.toStdString());
+}
+
+QVariantMap GameBackend::wordBankHashes() const {
+  // Hex strings: JSON numbers cannot carry 64 bits exactly
+  QVariantMap hashes;
+  for (const std::string &lang : m_textProvider.languages())
+    hashes.insert(QString::fromStdString(lang),
+                  QString::number(m_textProvider.bankHash(lang), 16));
+  return hashes;
+}
+
 // ============================================================================
 // SFX INTERFACE
 // ============================================================================
 
 void GameBackend::initializeSfx() {
-  m_correctSound = new QSoundEffect(this);
-  m_correctSound->setSource(
-      QUrl("qrc:/qt/qml/rapid_texter/assets/sfx/true.wav"));
-  m_correctSound->setVolume(0.5);
-
-  m_errorSound = new QSoundEffect(this);
-  m_errorSound->setSource(
-      QUrl("qrc:/qt/qml/rapid_texter/assets/sfx/false.wav"));
-  m_errorSound->setVolume(0.5);
-}
-
-// Reinitialize audio - recreate both QSoundEffect instances
-// Call this proactively to keep Windows audio device awake
-void GameBackend::reinitializeAudio() {
-  // Save current volumes
-  qreal correctVol = m_correctSound ? m_correctSound->volume() : 0.5;
-  qreal errorVol = m_errorSound ? m_errorSound->volume() : 0.5;
-
-  // Delete old instances
-  delete m_correctSound;
-  delete m_errorSound;
-
-  // Create new instances
-  m_correctSound = new QSoundEffect(this);
-  m_correctSound->setSource(
-      QUrl("qrc:/qt/qml/rapid_texter/assets/sfx/true.wav"));
-  m_correctSound->setVolume(correctVol);
-
-  m_errorSound = new QSoundEffect(this);
-  m_errorSound->setSource(
-      QUrl("qrc:/qt/qml/rapid_texter/assets/sfx/false.wav"));
-  m_errorSound->setVolume(errorVol);
-}
-
-// Called periodically by timer to keep audio device awake
-void GameBackend::onAudioKeepAlive() {
-  // Only reinitialize if audio hasn't been used recently
-  // This prevents Windows audio device from going to sleep
-  if (m_lastSoundPlayedTimer.elapsed() >= AUDIO_KEEPALIVE_MS) {
-    reinitializeAudio();
-    m_lastSoundPlayedTimer.restart();
-  }
+  // Decode both effects once; the engine's output stream stays open for
+  // the whole session (its silence also keeps Windows audio awake)
+  m_audio = new AudioEngine();
+  m_correctSample =
+      m_audio->loadSample(":/qt/qml/rapid_texter/assets/sfx/true.wav");
+  m_errorSample =
+      m_audio->loadSample(":/qt/qml/rapid_texter/assets/sfx/false.wav");
+  m_audio->start();
 }
 
 void GameBackend::playCorrectSound() {
-  if (m_sfxEnabled && m_correctSound) {
-    if (m_correctSound->status() == QSoundEffect::Ready) {
-      m_correctSound->play();
-      m_lastSoundPlayedTimer.restart(); // Mark audio as active
-    } else if (m_correctSound->status() == QSoundEffect::Error) {
-      reinitializeAudio();
-    }
-  }
+  if (m_sfxEnabled)
+    m_audio->play(m_correctSample, SFX_VOLUME);
 }
 
 void GameBackend::playErrorSound() {
-  if (m_sfxEnabled && m_errorSound) {
-    // Rate limiting
-    if (m_errorSoundTimer.elapsed() >= SOUND_COOLDOWN_MS) {
-      if (m_errorSound->status() == QSoundEffect::Ready) {
-        m_errorSound->play();
-        m_lastSoundPlayedTimer.restart(); // Mark audio as active
-      } else if (m_errorSound->status() == QSoundEffect::Error) {
-        reinitializeAudio();
-      }
-      m_errorSoundTimer.restart();
-    }
-  }
+  // Voices overlap, so rapid errors no longer need a cooldown
+  if (m_sfxEnabled)
+    m_audio->play(m_errorSample, SFX_VOLUME);
 }
 
 void GameBackend::toggleSfx() { setSfxEnabled(!m_sfxEnabled); }
@@ -221,7 +310,18 @@ void GameBackend::setSfxEnabled(bool enabled) {
 void GameBackend::saveGameResult(double wpm, double accuracy, int errors,
                                  int targetWPM, const QString &difficulty,
                                  const QString &language, const QString &mode,
-                                 double timeElapsed) {
+                                 double timeElapsed, const QByteArray &replay,
+                                 const QByteArray &keyStats) {
+  // History is still loading in the background; saving now would be
+  // lost when the loaded data is moved in, so save once it is ready
+  if (!m_ready) {
+    m_deferredWrites.append([=] {
+      saveGameResult(wpm, accuracy, errors, targetWPM, difficulty, language,
+                     mode, timeElapsed, replay, keyStats);
+    });
+    return;
+  }
+
   HistoryEntry entry;
   entry.wpm = wpm;
   entry.accuracy = accuracy;
@@ -238,7 +338,14 @@ void GameBackend::saveGameResult(double wpm, double accuracy, int errors,
   entry.mode = mode.toStdString();
   // timestamp is set automatically by HistoryManager
 
-  m_historyManager.saveEntry(entry);
+  // The replay goes to its own file; the journal record only flags it.
+  // Key stats go to their own journal and the lifetime aggregates.
+  m_historyManager.saveEntry(entry, replay.toStdString(),
+                             keyStats.toStdString());
+  m_historyModel->entryAppended(
+      uint32_t(m_historyManager.getTotalEntries() - 1));
+  if (!keyStats.isEmpty())
+    updateBigramWeights();
   emit historyUpdated();
 }
 
@@ -268,105 +375,41 @@ QVariantList GameBackend::getHistoryPageSorted(
     int pageNumber, int pageSize, const QString &sortBy, bool ascending,
     const QString &modeFilter, const QString &languageFilter,
     const QString &difficultyFilter) {
-  // Get all entries first, then filter, sort, then paginate
-  int totalEntries = m_historyManager.getTotalEntries();
-  if (totalEntries == 0) {
-    return QVariantList();
-  }
-
-  // Get all entries (use a large page to get all)
-  int allPageSize = totalEntries;
-  std::vector<HistoryEntry> allEntries =
-      m_historyManager.getPage(1, allPageSize);
-
-  // Filter by mode, language, and difficulty
-  std::vector<HistoryEntry> filteredEntries;
-  for (const auto &entry : allEntries) {
-    // Mode filter
-    if (modeFilter != "All" && !modeFilter.isEmpty()) {
-      if (entry.mode != modeFilter.toStdString()) {
-        continue;
-      }
-    }
-
-    // Language filter (case-insensitive)
-    if (languageFilter != "All" && !languageFilter.isEmpty()) {
-      QString entryLang = QString::fromStdString(entry.language).toUpper();
-      if (entryLang != languageFilter.toUpper()) {
-        continue;
-      }
-    }
-
-    // Difficulty filter (case-insensitive)
-    if (difficultyFilter != "All" && !difficultyFilter.isEmpty()) {
-      QString entryDiff = QString::fromStdString(entry.difficulty).toLower();
-      if (entryDiff != difficultyFilter.toLower()) {
-        continue;
-      }
-    }
-
-    filteredEntries.push_back(entry);
-  }
+  return queryHistoryPage(m_historyManager, pageNumber, pageSize, sortBy,
+                          ascending, modeFilter, languageFilter,
+                          difficultyFilter);
+}
 
-  if (filteredEntries.empty()) {
+QVariantList GameBackend::queryHistoryPage(
+    const HistoryManager &history, int pageNumber, int pageSize,
+    const QString &sortBy, bool ascending, const QString &modeFilter,
+    const QString &languageFilter, const QString &difficultyFilter) {
+  if (pageNumber < 1 || pageSize < 1)
     return QVariantList();
-  }
-
-  // Sort based on sortBy and ascending
-  if (sortBy == "wpm") {
-    std::sort(filteredEntries.begin(), filteredEntries.end(),
-              [ascending](const HistoryEntry &a, const HistoryEntry &b) {
-                return ascending ? (a.wpm < b.wpm) : (a.wpm > b.wpm);
-              });
-  } else if (sortBy == "accuracy") {
-    std::sort(filteredEntries.begin(), filteredEntries.end(),
-              [ascending](const HistoryEntry &a, const HistoryEntry &b) {
-                return ascending ? (a.accuracy < b.accuracy)
-                                 : (a.accuracy > b.accuracy);
-              });
-  } else if (sortBy == "time") {
-    std::sort(filteredEntries.begin(), filteredEntries.end(),
-              [ascending](const HistoryEntry &a, const HistoryEntry &b) {
-                return ascending ? (a.timeElapsed < b.timeElapsed)
-                                 : (a.timeElapsed > b.timeElapsed);
-              });
-  } else {
-    // Sort by date (timestamp) - default
-    // Timestamp format: DD/MM/YYYY HH:MM:SS
-    // For proper date comparison, we need to parse it
-    std::sort(filteredEntries.begin(), filteredEntries.end(),
-              [ascending](const HistoryEntry &a, const HistoryEntry &b) {
-                // Parse timestamps for comparison
-                // Format: DD/MM/YYYY HH:MM:SS
-                auto parseTimestamp = [](const std::string &ts) -> long long {
-                  if (ts.length() < 19)
-                    return 0;
-                  int day = std::stoi(ts.substr(0, 2));
-                  int month = std::stoi(ts.substr(3, 2));
-                  int year = std::stoi(ts.substr(6, 4));
-                  int hour = std::stoi(ts.substr(11, 2));
-                  int minute = std::stoi(ts.substr(14, 2));
-                  int second = std::stoi(ts.substr(17, 2));
-                  // Convert to comparable number (YYYYMMDDHHmmss)
-                  return (long long)year * 10000000000LL +
-                         (long long)month * 100000000LL +
-                         (long long)day * 1000000LL +
-                         (long long)hour * 10000LL + (long long)minute * 100LL +
-                         (long long)second;
-                };
-                long long timeA = parseTimestamp(a.timestamp);
-                long long timeB = parseTimestamp(b.timestamp);
-                return ascending ? (timeA < timeB) : (timeA > timeB);
-              });
-  }
 
-  // Paginate
-  int startIdx = (pageNumber - 1) * pageSize;
-  int endIdx = std::min(startIdx + pageSize, (int)filteredEntries.size());
+  // Filter and sort run on HistoryManager's columnar indices; only the rows
+  // of the requested page are materialized
+  const HistoryFilter filter = HistoryManager::makeFilter(
+      modeFilter.toStdString(), languageFilter.toStdString(),
+      difficultyFilter.toStdString());
+
+  HistorySortKey key = HistorySortKey::DATE;
+  if (sortBy == "wpm")
+    key = HistorySortKey::WPM;
+  else if (sortBy == "accuracy")
+    key = HistorySortKey::ACCURACY;
+  else if (sortBy == "time")
+    key = HistorySortKey::TIME;
+
+  std::vector<uint32_t> ids;
+  history.queryPage(filter, key, ascending,
+                    size_t(pageNumber - 1) * size_t(pageSize),
+                    size_t(pageSize), ids);
 
   QVariantList result;
-  for (int i = startIdx; i < endIdx; ++i) {
-    const auto &entry = filteredEntries[i];
+  result.reserve(qsizetype(ids.size()));
+  for (uint32_t id : ids) {
+    const HistoryEntry entry = history.getEntry(id);
     QVariantMap item;
     item["wpm"] = entry.wpm;
     item["accuracy"] = entry.accuracy;
@@ -392,10 +435,192 @@ int GameBackend::getHistoryTotalEntries() {
 }
 
 void GameBackend::clearHistory() {
+  if (!m_ready) {
+    m_deferredWrites.append([this] { clearHistory(); });
+    return;
+  }
+  clearGhost();
   m_historyManager.clearHistory();
+  m_historyModel->reload();
+  updateBigramWeights();
   emit historyUpdated();
 }
 
+HistoryModel *GameBackend::historyModel() const { return m_historyModel; }
+
+QVariantMap GameBackend::getHistoryStats(const QString &modeFilter,
+                                         const QString &languageFilter,
+                                         const QString &difficultyFilter) const {
+  const StatsBucket &bucket = m_historyManager.getStats(
+      modeFilter.toStdString(), languageFilter.toStdString(),
+      difficultyFilter.toStdString());
+
+  QVariantMap result;
+  result["count"] = int(bucket.count);
+  result["bestWpm"] = bucket.count > 0 ? bucket.wpm.max : 0.0;
+  result["worstWpm"] = bucket.count > 0 ? bucket.wpm.min : 0.0;
+  result["avgWpm"] = bucket.wpm.mean(bucket.count);
+  result["stdDevWpm"] = bucket.wpm.stdDev(bucket.count);
+  result["recentWpm"] = bucket.wpm.ema;
+  result["p50Wpm"] = bucket.wpmP50.value();
+  result["p90Wpm"] = bucket.wpmP90.value();
+  result["avgAccuracy"] = bucket.accuracy.mean(bucket.count);
+  result["bestAccuracy"] = bucket.count > 0 ? bucket.accuracy.max : 0.0;
+  result["recentAccuracy"] = bucket.accuracy.ema;
+  return result;
+}
+
+// Shared shape of one key or bigram cell for QML
+static QVariantMap keyCell(uint32_t count, uint32_t errors, double meanUs,
+                           float score) {
+  const uint32_t attempts = count + errors;
+  QVariantMap cell;
+  cell["count"] = int(count);
+  cell["errors"] = int(errors);
+  cell["meanMs"] = meanUs / 1000.0;
+  cell["errorRate"] = attempts > 0 ? double(errors) / attempts : 0.0;
+  cell["score"] = double(score);
+  return cell;
+}
+
+QVariantMap GameBackend::keyHeatmap(const QString &languageFilter) const {
+  const KeyStats &stats =
+      m_historyManager.getKeyStats(languageFilter.toStdString());
+
+  QVariantMap result;
+  for (uint32_t key = ' '; key < KeyStats::KEYS - 1; ++key) {
+    if (stats.keySamples(key) + stats.keyMisses(key) == 0)
+      continue;
+    result[QString(QChar(key))] =
+        keyCell(stats.keySamples(key), stats.keyMisses(key),
+                stats.keyMeanUs(key),
+                stats.keyWeakness(key, KEYSTATS_MIN_SAMPLES));
+  }
+  return result;
+}
+
+QVariantList GameBackend::weakBigrams(int limit,
+                                      const QString &languageFilter) const {
+  const KeyStats &stats =
+      m_historyManager.getKeyStats(languageFilter.toStdString());
+
+  QVariantList result;
+  for (uint32_t index :
+       stats.weakestBigrams(size_t(qMax(0, limit)), KEYSTATS_MIN_SAMPLES)) {
+    QVariantMap cell =
+        keyCell(stats.bigramSamples(index), stats.bigramMisses(index),
+                stats.bigramMeanUs(index),
+                stats.bigramWeakness(index, KEYSTATS_MIN_SAMPLES));
+    cell["bigram"] = QString(QChar(index / KeyStats::KEYS)) +
+                     QChar(index % KeyStats::KEYS);
+    result.append(cell);
+  }
+  return result;
+}
+
+double GameBackend::personalBestWpm() const {
+  const StatsBucket &bucket = m_historyManager.getStats("All", "All", "All");
+  return bucket.count > 0 ? bucket.wpm.max : 0.0;
+}
+
+// ============================================================================
+// GHOST RACE INTERFACE
+// ============================================================================
+
+bool GameBackend::loadGhost(const QString &mode, const QString &language,
+                            const QString &difficulty) {
+  clearGhost();
+  if (!m_ready)
+    return false;
+
+  const HistoryFilter filter = HistoryManager::makeFilter(
+      mode.toStdString(), language.toStdString(), difficulty.toStdString());
+  const int64_t id = m_historyManager.bestReplayId(filter);
+
+  // A missing or damaged file just means no ghost for this run
+  std::string data;
+  if (id < 0 || !m_historyManager.loadReplay(uint32_t(id), data) ||
+      !m_ghostReplay.deserialize(data) || m_ghostReplay.textLength() == 0) {
+    m_ghostReplay.clear(0);
+    return false;
+  }
+
+  m_ghostCursor.reset(&m_ghostReplay);
+  m_ghostElapsedUs = 0;
+
+  PlayersModel::Player local;
+  local.uuid = QStringLiteral("local");
+  local.name = QStringLiteral("You");
+  local.isLocal = true;
+  PlayersModel::Player ghost;
+  ghost.uuid = QStringLiteral("ghost");
+  m_ghostName = QStringLiteral("Best (%1 WPM)")
+                    .arg(qRound(m_historyManager.wpmAt(uint32_t(id))));
+  ghost.name = m_ghostName;
+  m_ghostPlayers->setPlayer(local);
+  m_ghostPlayers->setPlayer(ghost);
+  m_ghostPlayers->flush();
+
+  m_ghostLoaded = true;
+  emit ghostChanged();
+  return true;
+}
+
+void GameBackend::clearGhost() {
+  m_ghostCursor.reset(nullptr);
+  m_ghostReplay.clear(0);
+  m_ghostPlayers->clear();
+  if (m_ghostLoaded) {
+    m_ghostLoaded = false;
+    emit ghostChanged();
+  }
+}
+
+void GameBackend::advanceGhost(TypingSession *session) {
+  if (!m_ghostLoaded || !session)
+    return;
+
+  // The ghost starts with the player's first keystroke; a reset (or a new
+  // text) rewinds it
+  const quint64 elapsedUs =
+      session->isStarted() ? quint64(session->elapsedMs()) * 1000 : 0;
+  if (elapsedUs < m_ghostElapsedUs || !session->isStarted())
+    m_ghostCursor.reset(&m_ghostReplay);
+  m_ghostElapsedUs = elapsedUs;
+  if (session->isStarted())
+    m_ghostCursor.advanceTo(elapsedUs);
+
+  // Same formula as Stats::calculate(); a finished ghost keeps its final WPM
+  auto wpm = [](int correct, quint64 us) {
+    return us > 0 ? qRound(correct / 5.0 / (double(us) / 60e6)) : 0;
+  };
+
+  PlayersModel::Player local;
+  local.uuid = QStringLiteral("local");
+  local.name = QStringLiteral("You");
+  local.isLocal = true;
+  local.progress = session->length() > 0
+                       ? double(session->cursorPosition()) / session->length()
+                       : 0.0;
+  local.wpm = wpm(session->correctChars(), elapsedUs);
+  local.finished = session->isFinished();
+
+  PlayersModel::Player ghost;
+  ghost.uuid = QStringLiteral("ghost");
+  ghost.name = m_ghostName;
+  ghost.progress = m_ghostCursor.progress();
+  ghost.wpm = wpm(int(m_ghostCursor.correctChars()),
+                  std::min<quint64>(elapsedUs, m_ghostReplay.durationUs()));
+  ghost.finished = m_ghostCursor.finished() && session->isStarted();
+
+  m_ghostPlayers->setPlayer(local);
+  m_ghostPlayers->setPlayer(ghost);
+}
+
+PlayersModel *GameBackend::ghostPlayers() const { return m_ghostPlayers; }
+
+bool GameBackend::ghostLoaded() const { return m_ghostLoaded; }
+
 // ============================================================================
 // PROGRESS INTERFACE
 // ============================================================================
@@ -442,6 +667,18 @@ bool GameBackend::completeLevel(const QString &language,
     break;
   }
 
+  // Progress is still loading; report the result now and unlock the
+  // levels once the loaded progress is in place
+  if (!m_ready) {
+    passed = wpm >= requiredWPM && accuracy >= requiredAccuracy;
+    if (passed) {
+      m_deferredWrites.append([=] {
+        completeLevel(language, difficulty, wpm, accuracy);
+      });
+    }
+    return passed;
+  }
+
   if (wpm >= requiredWPM && accuracy >= requiredAccuracy) {
     passed = true;
     m_progressManager.setCompleted(lang, diff, true);
@@ -469,6 +706,10 @@ bool GameBackend::completeLevel(const QString &language,
 }
 
 void GameBackend::resetProgress() {
+  if (!m_ready) {
+    m_deferredWrites.append([this] { resetProgress(); });
+    return;
+  }
   m_progressManager.resetProgress();
   emit progressUpdated();
 }
@@ -537,3 +778,11 @@ Difficulty GameBackend::stringToDifficulty(const QString &diff) {
     return Difficulty::PROGRAMMER;
   return Difficulty::EASY; // default
 }
+
+TextMode GameBackend::stringToTextMode(const QString &mode) {
+  if (mode.toLower() == "natural")
+    return TextMode::MARKOV;
+  if (mode.toLower() == "weak")
+    return TextMode::WEAK_BIGRAMS;
+  return TextMode::RANDOM_WORDS; // default
+}
@@ -8,13 +8,66 @@
  * untuk menyimpan, memuat, dan mengelola riwayat permainan pengguna.
  * 
  * @section features Fitur Utama
- * - Penyimpanan history dalam format JSON
+ * - Penyimpanan history dalam journal binary append-only
+ * - Layout kolumnar di memory dengan index sorting yang di-update incremental
  * - Cross-platform data directory (Windows: %APPDATA%, Linux/Mac: XDG_DATA_HOME)
  * - Pagination untuk menampilkan history secara bertahap
  * - Auto-timestamp untuk setiap entry
+ * - Migrasi satu kali dari history.json format lama
  * 
- * @section json_format Format JSON
- * File history.json memiliki struktur:
+ * @section journal_format Format Journal
+ * File history.journal terdiri dari header 16 byte diikuti record
+ * berukuran tetap (56 byte, little-endian):
+ * 
+ * | Offset | Ukuran | Field                                   |
+ * |--------|--------|-----------------------------------------|
+ * | 0      | 8      | epoch seconds (i64)                     |
+ * | 8      | 8      | wpm (f64)                               |
+ * | 16     | 8      | accuracy (f64)                          |
+ * | 24     | 8      | timeElapsed (f64)                       |
+ * | 32     | 4      | targetWPM (i32)                         |
+ * | 36     | 4      | errors (i32)                            |
+ * | 40     | 1      | kode difficulty                         |
+ * | 41     | 1      | kode language                           |
+ * | 42     | 1      | kode mode                               |
+ * | 43     | 1      | flags (bit 0: punya file replay)        |
+ * | 44     | 8      | replay ID (u64)                         |
+ * | 52     | 4      | checksum FNV-1a byte 0-51 (u32)         |
+ * 
+ * Rekaman keystroke (Replay) tidak disimpan di journal: setiap replay
+ * punya file replay_<replay ID>.rtr sendiri di direktori yang sama, dan
+ * record hanya membawa ID-nya. Query history tidak pernah membukanya.
+ * 
+ * Journal versi 1 (record 48 byte, tanpa replay ID, checksum di offset
+ * 44) masih dibaca: replay-nya bernama replay_<epoch>.rtr, jadi epoch
+ * dipakai sebagai replay ID, lalu journal ditulis ulang sebagai versi 2.
+ * 
+ * @section keystats_format Format KeyStats Journal
+ * Statistik per tombol/bigram (KeyStats) tiap permainan di-append ke
+ * keystats.journal: header 8 byte ("RTKJ", versi u16, reserved u16), lalu
+ * record berukuran variabel:
+ * 
+ * | Offset | Ukuran | Field                                   |
+ * |--------|--------|-----------------------------------------|
+ * | 0      | 4      | panjang payload (u32)                   |
+ * | 4      | 4      | checksum FNV-1a payload (u32)           |
+ * | 8      | 1      | kode language                           |
+ * | 9      | ...    | KeyStats::serialize()                   |
+ * 
+ * Saat loading setiap record dijumlahkan langsung ke agregat padat per
+ * bahasa, sehingga heatmap tidak pernah perlu membaca journal ini lagi.
+ * 
+ * Entry baru cukup di-append (O(1)), tidak perlu menulis ulang seluruh
+ * file. Saat loading, journal di-compact (ditulis ulang) jika:
+ * - Ada record yang rusak/terpotong (misalnya karena crash saat menulis);
+ *   record tersebut dibuang
+ * - Journal masih versi 1; semua record ditulis ulang sebagai versi 2
+ * 
+ * Compaction hanya menulis ulang file; entry yang valid tidak pernah dibuang.
+ * 
+ * @section json_format Format JSON Lama
+ * File history.json versi lama memiliki struktur berikut dan hanya dibaca
+ * satu kali untuk migrasi (kemudian di-rename menjadi history.json.migrated):
  * @code{.json}
  * {
  *   "entries": [
@@ -32,127 +85,181 @@
  * @endcode
  * 
  * @section storage Lokasi Penyimpanan
- * - Windows: %APPDATA%\\RapidTexter\\history.json
- * - Linux: $XDG_DATA_HOME/RapidTexter/history.json atau ~/.local/share/RapidTexter/history.json
- * - macOS: ~/.local/share/RapidTexter/history.json
+ * - Windows: %APPDATA%\\RapidTexter\\history.journal
+ * - Linux: $XDG_DATA_HOME/RapidTexter/history.journal atau ~/.local/share/RapidTexter/history.journal
+ * - macOS: ~/.local/share/RapidTexter/history.journal
  */
 
 #include "HistoryManager.h"
+#include "PersistenceService.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <cmath>
 #include <cstdlib>
-#include <sys/stat.h>
-
-#ifdef _WIN32
-#include <windows.h>
-#include <shlobj.h>
-#include <direct.h>
-#else
-#include <unistd.h>
-#endif
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
 
 // ============================================================================
-// HELPER FUNCTIONS (Static/Internal)
+// JOURNAL RECORD ENCODING
 // ============================================================================
 
-/**
- * @brief Mendapatkan path direktori data aplikasi sesuai platform
- * 
- * Fungsi ini menentukan lokasi penyimpanan data yang sesuai dengan
- * konvensi masing-masing sistem operasi:
- * 
- * @par Windows
- * Menggunakan CSIDL_APPDATA (%APPDATA%) yang biasanya mengarah ke:
- * C:\\Users\\{username}\\AppData\\Roaming\\RapidTexter\\
- * 
- * @par Linux/macOS
- * Mengikuti XDG Base Directory Specification:
- * - Jika XDG_DATA_HOME di-set: $XDG_DATA_HOME/RapidTexter/
- * - Jika tidak: ~/.local/share/RapidTexter/
- * 
- * @note Fungsi ini akan otomatis membuat direktori jika belum ada
- * 
- * @return std::string Path ke direktori data dengan trailing separator,
- *         atau string kosong jika gagal mendapatkan path
- * 
- * @warning Fungsi ini bersifat static dan hanya digunakan internal
- */
-static std::string getDataDirectory() {
-#ifdef _WIN32
-    char appDataPath[MAX_PATH];
-    if (SUCCEEDED(SHGetFolderPathA(NULL, CSIDL_APPDATA, NULL, 0, appDataPath))) {
-        std::string dataDir = std::string(appDataPath) + "\\RapidTexter";
-        struct _stat st;
-        if (_stat(dataDir.c_str(), &st) != 0) {
-            _mkdir(dataDir.c_str());
-        }
-        return dataDir + "\\";
+namespace {
+    constexpr char JOURNAL_MAGIC[4] = {'R', 'T', 'H', 'J'};
+    constexpr uint16_t JOURNAL_VERSION = 2;
+    constexpr size_t JOURNAL_HEADER_SIZE = 16;
+    constexpr size_t RECORD_SIZE = 56;
+    constexpr size_t RECORD_CHECKSUM_OFFSET = 52;
+    constexpr uint8_t RECORD_FLAG_REPLAY = 0x01;
+
+    // Versi 1: record tanpa replay ID (lihat @ref journal_format)
+    constexpr uint16_t LEGACY_JOURNAL_VERSION = 1;
+    constexpr size_t LEGACY_RECORD_SIZE = 48;
+    constexpr size_t LEGACY_RECORD_CHECKSUM_OFFSET = 44;
+
+    constexpr char KEYSTATS_MAGIC[4] = {'R', 'T', 'K', 'J'};
+    constexpr uint16_t KEYSTATS_VERSION = 1;
+    constexpr size_t KEYSTATS_HEADER_SIZE = 8;
+    constexpr size_t KEYSTATS_RECORD_HEADER_SIZE = 8;
+    constexpr uint32_t KEYSTATS_MAX_PAYLOAD = 1u << 20;  // Tabel penuh jauh di bawah ini
+
+    using Record = unsigned char[RECORD_SIZE];
+
+    void putU16(unsigned char* p, uint16_t v) {
+        p[0] = static_cast<unsigned char>(v);
+        p[1] = static_cast<unsigned char>(v >> 8);
     }
-    return "";
-#else
-    const char* xdgDataHome = std::getenv("XDG_DATA_HOME");
-    std::string baseDir;
-    
-    if (xdgDataHome && xdgDataHome[0] != '\0') {
-        baseDir = std::string(xdgDataHome);
-    } else {
-        const char* home = std::getenv("HOME");
-        if (home) {
-            baseDir = std::string(home) + "/.local/share";
-        } else {
-            return "";
+
+    void putU32(unsigned char* p, uint32_t v) {
+        for (int i = 0; i < 4; ++i) p[i] = static_cast<unsigned char>(v >> (8 * i));
+    }
+
+    void putU64(unsigned char* p, uint64_t v) {
+        for (int i = 0; i < 8; ++i) p[i] = static_cast<unsigned char>(v >> (8 * i));
+    }
+
+    uint16_t getU16(const unsigned char* p) {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    uint32_t getU32(const unsigned char* p) {
+        uint32_t v = 0;
+        for (int i = 3; i >= 0; --i) v = (v << 8) | p[i];
+        return v;
+    }
+
+    uint64_t getU64(const unsigned char* p) {
+        uint64_t v = 0;
+        for (int i = 7; i >= 0; --i) v = (v << 8) | p[i];
+        return v;
+    }
+
+    void putF64(unsigned char* p, double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        putU64(p, bits);
+    }
+
+    double getF64(const unsigned char* p) {
+        uint64_t bits = getU64(p);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /**
+     * @brief Checksum FNV-1a 32-bit untuk mendeteksi record yang rusak
+     */
+    uint32_t checksum(const unsigned char* data, size_t size) {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= data[i];
+            hash *= 16777619u;
         }
+        return hash;
     }
-    
-    struct stat st;
-    if (stat(baseDir.c_str(), &st) != 0) {
-        mkdir(baseDir.c_str(), 0755);
+
+    void writeHeader(unsigned char* header) {
+        std::memset(header, 0, JOURNAL_HEADER_SIZE);
+        std::memcpy(header, JOURNAL_MAGIC, 4);
+        putU16(header + 4, JOURNAL_VERSION);
+        putU16(header + 6, static_cast<uint16_t>(RECORD_SIZE));
     }
-    
-    std::string dataDir = baseDir + "/RapidTexter";
-    if (stat(dataDir.c_str(), &st) != 0) {
-        mkdir(dataDir.c_str(), 0755);
+
+    std::string keyStatsHeader() {
+        unsigned char header[KEYSTATS_HEADER_SIZE] = {};
+        std::memcpy(header, KEYSTATS_MAGIC, 4);
+        putU16(header + 4, KEYSTATS_VERSION);
+        return std::string(reinterpret_cast<const char*>(header), KEYSTATS_HEADER_SIZE);
+    }
+
+    std::string toLowerAscii(std::string value) {
+        for (char& c : value) {
+            if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+        }
+        return value;
     }
-    return dataDir + "/";
-#endif
 }
 
 /**
- * @brief Melakukan escape pada karakter khusus untuk format JSON
- * 
- * Mengkonversi karakter-karakter yang memiliki makna khusus dalam JSON
- * menjadi escape sequence yang valid. Karakter yang di-escape:
- * - " (double quote) -> \"
- * - \\ (backslash) -> \\\\
- * - \\n (newline) -> \\n
- * - \\r (carriage return) -> \\r
- * - \\t (tab) -> \\t
- * 
- * @param str String input yang akan di-escape
- * @return std::string String yang sudah di-escape, aman untuk disimpan dalam JSON
- * 
- * @par Contoh Penggunaan
- * @code
- * std::string raw = "Hello \"World\"";
- * std::string escaped = escapeJsonString(raw);
- * // escaped = "Hello \\\"World\\\""
- * @endcode
- * 
- * @note Fungsi ini bersifat static dan hanya digunakan internal oleh saveHistory()
+ * @brief Serialize entry menjadi record journal berukuran tetap
+ * @param entry Nilai numerik entry
+ * @param codes Kode mode/bahasa/difficulty hasil packCodes()
+ * @param out Buffer record output
  */
-static std::string escapeJsonString(const std::string& str) {
-    std::string escaped;
-    for (char c : str) {
-        if (c == '"') escaped += "\\\"";
-        else if (c == '\\') escaped += "\\\\";
-        else if (c == '\n') escaped += "\\n";
-        else if (c == '\r') escaped += "\\r";
-        else if (c == '\t') escaped += "\\t";
-        else escaped += c;
+static void encodeRecord(const HistoryEntry& entry, uint16_t codes, Record out) {
+    auto unpack = [codes](int shift) -> unsigned char {
+        uint8_t code = (codes >> shift) & 0xF;
+        return code == 0xF ? HistoryManager::UNKNOWN_CODE : code;
+    };
+
+    std::memset(out, 0, RECORD_SIZE);
+    putU64(out + 0, static_cast<uint64_t>(entry.epoch));
+    putF64(out + 8, entry.wpm);
+    putF64(out + 16, entry.accuracy);
+    putF64(out + 24, entry.timeElapsed);
+    putU32(out + 32, static_cast<uint32_t>(entry.targetWPM));
+    putU32(out + 36, static_cast<uint32_t>(entry.errors));
+    out[40] = unpack(8);   // difficulty
+    out[41] = unpack(4);   // language
+    out[42] = unpack(0);   // mode
+    out[43] = entry.replayId != 0 ? RECORD_FLAG_REPLAY : 0;
+    putU64(out + 44, entry.replayId);
+    putU32(out + RECORD_CHECKSUM_OFFSET, checksum(out, RECORD_CHECKSUM_OFFSET));
+}
+
+/**
+ * @brief Deserialize record journal (hanya field numerik, tanpa string)
+ * @param in Buffer record
+ * @param entry Output nilai numerik entry
+ * @param difficulty Output kode difficulty
+ * @param language Output kode bahasa
+ * @param mode Output kode mode
+ * @param legacy true untuk record journal versi 1
+ * @return false jika checksum tidak cocok (record rusak)
+ */
+static bool decodeRecord(const unsigned char* in, HistoryEntry& entry,
+                         uint8_t& difficulty, uint8_t& language, uint8_t& mode, bool legacy) {
+    const size_t checksumOffset = legacy ? LEGACY_RECORD_CHECKSUM_OFFSET : RECORD_CHECKSUM_OFFSET;
+    if (getU32(in + checksumOffset) != checksum(in, checksumOffset)) {
+        return false;
     }
-    return escaped;
+    entry.epoch = static_cast<int64_t>(getU64(in + 0));
+    entry.wpm = getF64(in + 8);
+    entry.accuracy = getF64(in + 16);
+    entry.timeElapsed = getF64(in + 24);
+    entry.targetWPM = static_cast<int32_t>(getU32(in + 32));
+    entry.errors = static_cast<int32_t>(getU32(in + 36));
+    difficulty = in[40];
+    language = in[41];
+    mode = in[42];
+    entry.replayId = 0;
+    if (in[43] & RECORD_FLAG_REPLAY) {
+        // Replay versi 1 dinamai dengan epoch
+        entry.replayId = legacy ? static_cast<uint64_t>(entry.epoch) : getU64(in + 44);
+    }
+    return true;
 }
 
 // ============================================================================
@@ -163,14 +270,35 @@ static std::string escapeJsonString(const std::string& str) {
  * @brief Constructor - Inisialisasi HistoryManager dan load history existing
  * 
  * Constructor akan:
- * 1. Menentukan path file history.json berdasarkan platform
+ * 1. Menentukan path file history.journal berdasarkan platform
  * 2. Memuat history yang sudah ada dari file (jika ada)
  * 
- * @note History akan otomatis di-load saat objek dibuat
+ * @param autoLoad Jika false, loadHistory() harus dipanggil manual
+ * @note Secara default history otomatis di-load saat objek dibuat
  * @see loadHistory()
  */
-HistoryManager::HistoryManager() : filename(getDataDirectory() + "history.json") {
-    loadHistory();
+HistoryManager::HistoryManager(bool autoLoad)
+    : filename(PersistenceService::dataDirectory() + "history.journal"),
+      keyStatsFilename(PersistenceService::dataDirectory() + "keystats.journal"),
+      legacyFilename(PersistenceService::dataDirectory() + "history.json") {
+    if (autoLoad) {
+        loadHistory();
+    }
+}
+
+/**
+ * @brief Constructor dengan path journal eksplisit
+ * 
+ * Legacy filename dikosongkan sehingga tidak ada migrasi dari history.json.
+ * 
+ * @param journalPath Path file journal
+ * @param autoLoad Jika false, loadHistory() harus dipanggil manual
+ */
+HistoryManager::HistoryManager(const std::string& journalPath, bool autoLoad)
+    : filename(journalPath), keyStatsFilename(siblingPath("keystats.journal")) {
+    if (autoLoad) {
+        loadHistory();
+    }
 }
 
 // ============================================================================
@@ -196,18 +324,66 @@ HistoryManager::HistoryManager() : filename(getDataDirectory() + "history.json")
  * @par Contoh Output
  * "30/12/2025 17:30:45"
  * 
- * @note Fungsi ini menggunakan std::localtime() yang bersifat thread-unsafe.
- *       Untuk aplikasi multi-threaded, pertimbangkan menggunakan localtime_r() atau localtime_s()
+ * @see formatTimestamp()
  */
 std::string HistoryManager::getCurrentTimestamp() {
-    std::time_t now = std::time(nullptr);
-    std::tm* localTime = std::localtime(&now);
-    
+    return formatTimestamp(static_cast<int64_t>(std::time(nullptr)));
+}
+
+/**
+ * @brief Format epoch seconds menjadi timestamp waktu lokal
+ * 
+ * Journal menyimpan waktu sebagai epoch seconds; string timestamp
+ * dibangun ulang saat loading untuk ditampilkan di UI.
+ * 
+ * @param epoch Epoch seconds
+ * @return std::string Timestamp dalam format "DD/MM/YYYY HH:MM:SS"
+ * 
+ * @note Menggunakan localtime_r()/localtime_s() karena history bisa
+ *       di-load dari background thread.
+ */
+std::string HistoryManager::formatTimestamp(int64_t epoch) {
+    std::time_t time = static_cast<std::time_t>(epoch);
+    std::tm localTime{};
+#ifdef _WIN32
+    localtime_s(&localTime, &time);
+#else
+    localtime_r(&time, &localTime);
+#endif
+
     char buffer[20];
-    std::strftime(buffer, sizeof(buffer), "%d/%m/%Y %H:%M:%S", localTime);
+    std::strftime(buffer, sizeof(buffer), "%d/%m/%Y %H:%M:%S", &localTime);
     return std::string(buffer);
 }
 
+/**
+ * @brief Parse timestamp "DD/MM/YYYY HH:MM:SS" (waktu lokal) ke epoch seconds
+ * 
+ * Dipakai saat migrasi history.json lama, yang hanya menyimpan string.
+ * 
+ * @param timestamp String timestamp
+ * @return int64_t Epoch seconds, atau 0 jika format tidak valid
+ */
+int64_t HistoryManager::parseTimestamp(const std::string& timestamp) {
+    int day = 0, month = 0, year = 0, hour = 0, minute = 0, second = 0;
+    if (std::sscanf(timestamp.c_str(), "%d/%d/%d %d:%d:%d",
+                    &day, &month, &year, &hour, &minute, &second) != 6) {
+        return 0;
+    }
+
+    std::tm localTime{};
+    localTime.tm_mday = day;
+    localTime.tm_mon = month - 1;
+    localTime.tm_year = year - 1900;
+    localTime.tm_hour = hour;
+    localTime.tm_min = minute;
+    localTime.tm_sec = second;
+    localTime.tm_isdst = -1;  // Biarkan mktime menentukan DST
+
+    std::time_t time = std::mktime(&localTime);
+    return time == static_cast<std::time_t>(-1) ? 0 : static_cast<int64_t>(time);
+}
+
 // ============================================================================
 // SAVE ENTRY
 // ============================================================================
@@ -215,53 +391,236 @@ std::string HistoryManager::getCurrentTimestamp() {
 /**
  * @brief Menyimpan entry permainan baru ke history
  * 
- * Menambahkan entry baru ke awal list history (urutan terbaru di atas)
- * dan langsung menyimpan ke file. Timestamp akan otomatis di-set jika kosong.
+ * Menambahkan entry baru ke akhir list (urutan kronologis) dan
+ * meng-append satu record ke journal. Timestamp akan otomatis di-set jika kosong.
  * 
  * @param entry HistoryEntry yang berisi data permainan yang akan disimpan
  * 
  * @par Proses Penyimpanan
  * 1. Membuat copy dari entry untuk modifikasi
- * 2. Jika timestamp kosong, set dengan waktu saat ini
- * 3. Insert entry ke awal vector (index 0)
- * 4. Save seluruh history ke file JSON
+ * 2. Jika epoch/timestamp kosong, set dengan waktu saat ini
+ * 3. Tambahkan baris ke kolom dan sisipkan ID ke setiap index sorting
+ * 4. Append satu record 56 byte ke journal
+ * 5. Jika ada replay, beri replay ID baru lalu jadwalkan penulisan file-nya
+ * 6. Jika ada KeyStats, jumlahkan ke agregat bahasanya lalu append
+ *    record-nya ke keystats.journal
  * 
  * @par Urutan Entry
- * Entry baru selalu dimasukkan di awal list, sehingga entry terbaru
- * akan muncul pertama saat ditampilkan (halaman 1, baris pertama).
- * 
- * @note Fungsi ini akan otomatis memanggil saveHistory() setelah menambahkan entry
+ * Entry disimpan kronologis; getPage() membaca dari belakang sehingga
+ * entry terbaru tetap muncul pertama (halaman 1, baris pertama).
  * 
  * @see HistoryEntry
- * @see saveHistory()
+ * @see appendRow()
+ * @see appendRecord()
  * @see getCurrentTimestamp()
  */
-void HistoryManager::saveEntry(const HistoryEntry& entry) {
+void HistoryManager::saveEntry(const HistoryEntry& entry, const std::string& replay,
+                               const std::string& keyStats) {
     HistoryEntry entryToSave = entry;  
     
-    // Auto-set timestamp jika kosong  
-    if (entryToSave.timestamp.empty()) {  // Jika timestamp belum di-set
-        entryToSave.timestamp = getCurrentTimestamp();  // Set timestamp saat ini
-    }  
-    
-    // Tambahkan entry baru ke awal list (paling baru di atas)
-    entries.insert(entries.begin(), entryToSave);
+    // Auto-set waktu jika kosong. Epoch adalah sumber kebenaran,
+    // timestamp string selalu diturunkan darinya.
+    if (entryToSave.epoch == 0) {
+        entryToSave.epoch = entryToSave.timestamp.empty()
+            ? static_cast<int64_t>(std::time(nullptr))
+            : parseTimestamp(entryToSave.timestamp);
+    }
+    entryToSave.timestamp = formatTimestamp(entryToSave.epoch);
+
+    // ID replay unik dan naik terus; tidak kurang dari epoch agar tidak
+    // bertabrakan dengan replay journal versi 1 (replay_<epoch>.rtr)
+    entryToSave.replayId = replay.empty()
+        ? 0 : std::max(nextReplayId, static_cast<uint64_t>(entryToSave.epoch));
+
+    const uint16_t codes = packCodes(modeCode(entryToSave.mode),
+                                     languageCode(entryToSave.language),
+                                     difficultyCode(entryToSave.difficulty));
+
+    // Nilai yang tidak dikenal disimpan sebagai UNKNOWN_CODE dan terbaca
+    // kembali sebagai string kosong
+    if (difficultyCode(entryToSave.difficulty) == UNKNOWN_CODE ||
+        languageCode(entryToSave.language) == UNKNOWN_CODE ||
+        modeCode(entryToSave.mode) == UNKNOWN_CODE) {
+        std::cerr << "History entry has unknown difficulty/language/mode: \""
+                  << entryToSave.difficulty << "\", \"" << entryToSave.language
+                  << "\", \"" << entryToSave.mode << "\"" << std::endl;
+    }
+
+    appendRow(entryToSave, codes, true);
     
-    // Save ke file
-    saveHistory();
+    // Append ke journal
+    appendRecord(entryToSave, codes);
+
+    if (entryToSave.replayId != 0) {
+        PersistenceService::instance().scheduleWrite(
+            replayPath(static_cast<uint32_t>(codeColumn.size() - 1)),
+            [replay]() { return replay; }, 0);
+    }
+
+    // Data yang tidak valid tidak pernah masuk journal maupun agregat
+    const uint8_t language = static_cast<uint8_t>((codes >> 4) & 0xF);
+    if (!keyStats.empty() && keyStats.size() < KEYSTATS_MAX_PAYLOAD &&
+        keyStatsByLanguage[keyStatsSlot(language)].accumulate(keyStats)) {
+        keyStatsAllValid = false;
+        const std::string payload = static_cast<char>(language) + keyStats;
+        unsigned char recordHeader[KEYSTATS_RECORD_HEADER_SIZE];
+        putU32(recordHeader, static_cast<uint32_t>(payload.size()));
+        putU32(recordHeader + 4, checksum(reinterpret_cast<const unsigned char*>(payload.data()),
+                                          payload.size()));
+        PersistenceService::instance().scheduleAppend(
+            keyStatsFilename,
+            std::string(reinterpret_cast<const char*>(recordHeader), KEYSTATS_RECORD_HEADER_SIZE) + payload,
+            keyStatsHeader());
+    }
+}
+
+/**
+ * @brief Append satu record ke journal
+ * 
+ * Record di-encode di sini (56 byte) lalu ditulis oleh worker
+ * PersistenceService. Jika file belum ada (atau kosong), header ditulis
+ * terlebih dahulu.
+ * 
+ * @param entry Entry yang akan ditulis
+ * @param codes Kode mode/bahasa/difficulty hasil packCodes()
+ * @return true jika record berhasil dijadwalkan
+ */
+bool HistoryManager::appendRecord(const HistoryEntry& entry, uint16_t codes) {
+    unsigned char header[JOURNAL_HEADER_SIZE];
+    writeHeader(header);
+
+    Record record;
+    encodeRecord(entry, codes, record);
+    PersistenceService::instance().scheduleAppend(
+        filename, std::string(reinterpret_cast<const char*>(record), RECORD_SIZE),
+        std::string(reinterpret_cast<const char*>(header), JOURNAL_HEADER_SIZE));
+    return true;
 }
 
 // ============================================================================
-// LOAD HISTORY (JSON PARSER)
+// LOAD HISTORY (JOURNAL READER)
 // ============================================================================
 
 /**
- * @brief Memuat history dari file JSON ke memory
+ * @brief Memuat history dari journal binary ke memory
+ * 
+ * @return true jika journal (atau history.json lama) berhasil dibaca
+ * @return false jika belum ada history sama sekali
+ * 
+ * @par Proses Loading
+ * 1. Jika journal tidak ada tetapi history.json ada, migrasikan: baca
+ *    JSON lama, tulis journal baru, lalu rename JSON menjadi
+ *    history.json.migrated (sebagai backup)
+ * 2. Validasi header (magic, versi, ukuran record); journal dengan header
+ *    rusak di-rename menjadi *.corrupt dan diganti journal kosong. Journal
+ *    versi 1 dibaca dengan layout lamanya
+ * 3. Baca record satu per satu; record dengan checksum salah atau
+ *    terpotong di akhir file dibuang
+ * 4. Isi kolom tanpa membuat string, lalu bangun index sorting sekali
+ * 5. Jika ada record yang dibuang atau journal masih versi 1, journal
+ *    di-compact
+ * 
+ * @note History yang sudah ada akan di-clear sebelum loading
+ */
+bool HistoryManager::loadHistory() {
+    clearColumns();
+    loadKeyStats();
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        // Migrasi satu kali dari format JSON lama
+        std::vector<HistoryEntry> legacy;
+        if (!loadLegacyJson(legacy)) {
+            // File tidak ada, history kosong
+            return false;
+        }
+
+        // JSON lama urut terbaru-dulu, journal urut kronologis
+        for (auto it = legacy.rbegin(); it != legacy.rend(); ++it) {
+            it->epoch = parseTimestamp(it->timestamp);
+            appendRow(*it, packCodes(modeCode(it->mode), languageCode(it->language),
+                                     difficultyCode(it->difficulty)), false);
+        }
+        rebuildIndices();
+
+        // JSON lama baru di-rename setelah journal benar-benar tertulis
+        if (saveHistory() && PersistenceService::instance().flush()) {
+            PersistenceService::replaceFile(legacyFilename, legacyFilename + ".migrated");
+        }
+        return true;
+    }
+
+    unsigned char header[JOURNAL_HEADER_SIZE];
+    const bool headerRead = static_cast<bool>(file.read(reinterpret_cast<char*>(header), JOURNAL_HEADER_SIZE));
+    const bool legacy = headerRead && getU16(header + 4) == LEGACY_JOURNAL_VERSION;
+    const size_t recordSize = legacy ? LEGACY_RECORD_SIZE : RECORD_SIZE;
+    if (!headerRead ||
+        std::memcmp(header, JOURNAL_MAGIC, 4) != 0 ||
+        (getU16(header + 4) != JOURNAL_VERSION && !legacy) ||
+        getU16(header + 6) != recordSize) {
+        // Journal disisihkan sebagai backup, lalu diganti journal kosong
+        // dengan header valid agar append berikutnya bisa terbaca lagi
+        std::cerr << "Invalid history journal, moved to " << filename << ".corrupt" << std::endl;
+        file.close();
+        PersistenceService::instance().flush();
+        PersistenceService::replaceFile(filename, filename + ".corrupt");
+        saveHistory();
+        return false;
+    }
+
+    bool damaged = false;
+    size_t unknownCodes = 0;
+    Record record;
+    while (true) {
+        file.read(reinterpret_cast<char*>(record), recordSize);
+        if (file.gcount() == 0) {
+            break;
+        }
+        if (static_cast<size_t>(file.gcount()) < recordSize) {
+            // Record terakhir terpotong (crash saat append)
+            damaged = true;
+            break;
+        }
+
+        HistoryEntry entry;
+        uint8_t difficulty, language, mode;
+        if (!decodeRecord(record, entry, difficulty, language, mode, legacy)) {
+            damaged = true;
+            continue;
+        }
+        if (difficulty == UNKNOWN_CODE || language == UNKNOWN_CODE || mode == UNKNOWN_CODE) {
+            ++unknownCodes;
+        }
+        appendRow(entry, packCodes(mode, language, difficulty), false);
+    }
+    file.close();
+
+    if (unknownCodes > 0) {
+        std::cerr << unknownCodes << " history record(s) have unknown "
+                  << "difficulty/language/mode codes" << std::endl;
+    }
+
+    // Bulk load: index dibangun sekali (O(n log n)) daripada disisipkan satu per satu
+    rebuildIndices();
+
+    if (damaged || legacy) {
+        saveHistory();
+    }
+    return true;
+}
+
+// ============================================================================
+// LEGACY HISTORY (JSON PARSER)
+// ============================================================================
+
+/**
+ * @brief Membaca history dari file history.json format lama
  * 
  * Membaca dan mem-parse file history.json menggunakan simple line-by-line
  * JSON parser. Parser ini dirancang khusus untuk format JSON yang dihasilkan
  * oleh saveHistory().
  * 
+ * @param out Output entries sesuai urutan file (terbaru dulu)
  * @return true jika file berhasil dibaca dan di-parse
  * @return false jika file tidak ada atau tidak bisa dibuka
  * 
@@ -296,18 +655,18 @@ void HistoryManager::saveEntry(const HistoryEntry& entry) {
  * @warning Parser ini tidak menangani nested objects atau arrays di dalam entry.
  *          Hanya kompatibel dengan format yang dihasilkan oleh saveHistory().
  * 
- * @note History yang sudah ada akan di-clear sebelum loading
+ * @note Hanya dipakai untuk migrasi satu kali ke journal
  * 
- * @see saveHistory()
+ * @see loadHistory()
  */
-bool HistoryManager::loadHistory() {
-    std::ifstream file(filename);
+bool HistoryManager::loadLegacyJson(std::vector<HistoryEntry>& out) {
+    std::ifstream file(legacyFilename);
     if (!file.is_open()) {
-        // File tidak ada, history kosong
+        // File tidak ada, tidak ada yang perlu dimigrasi
         return false;
     }
     
-    entries.clear();
+    out.clear();
     
     // Simple JSON parser untuk array of objects
     std::string line;
@@ -343,7 +702,7 @@ bool HistoryManager::loadHistory() {
         
         // Detect end of entry object
         if (line.find("}") != std::string::npos && inEntry) {
-            entries.push_back(currentEntry);
+            out.push_back(currentEntry);
             inEntry = false;
             continue;
         }
@@ -460,80 +819,51 @@ bool HistoryManager::loadHistory() {
 }
 
 // ============================================================================
-// SAVE HISTORY (JSON WRITER)
+// SAVE HISTORY (JOURNAL COMPACTION)
 // ============================================================================
 
 /**
- * @brief Menyimpan seluruh history ke file JSON
- * 
- * Menulis semua entry yang ada di memory ke file history.json dalam
- * format JSON yang pretty-printed (dengan indentasi).
- * 
- * @return true jika berhasil menyimpan ke file
- * @return false jika gagal membuka file untuk penulisan
- * 
- * @par Format Output
- * @code{.json}
- * {
- *   "entries": [
- *     {
- *       "wpm": 45.5,
- *       "accuracy": 95.2,
- *       "errors": 3,
- *       "difficulty": "Medium",
- *       "language": "ID",
- *       "mode": "Campaign",
- *       "timestamp": "30/12/2025 17:30:00"
- *     },
- *     ...
- *   ]
- * }
- * @endcode
+ * @brief Menulis ulang seluruh history ke journal (compaction)
  * 
- * @par Indentasi
- * - Root object: 0 spaces
- * - "entries" key: 2 spaces
- * - Entry object: 4 spaces
- * - Entry fields: 6 spaces
+ * Dipakai saat migrasi, setelah record rusak dibuang, dan saat history
+ * di-clear. Penyimpanan entry biasa tidak memanggil fungsi ini karena
+ * cukup di-append (lihat appendRecord()).
  * 
- * @note String values akan di-escape menggunakan escapeJsonString()
- *       untuk menghindari karakter yang merusak format JSON
+ * @return true jika penulisan berhasil dijadwalkan
  * 
- * @warning Fungsi ini akan menimpa file yang sudah ada
+ * @par Atomic Write
+ * Kolom di-copy sebagai snapshot; encoding dan penulisan dilakukan worker
+ * PersistenceService ke file sementara (.tmp) yang lalu di-rename menimpa
+ * file lama, sehingga crash di tengah penulisan tidak merusak history.
+ * Compaction tidak di-debounce; append sesudahnya ditulis setelahnya.
  * 
- * @see escapeJsonString()
  * @see loadHistory()
  */
 bool HistoryManager::saveHistory() {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Failed to save history to " << filename << std::endl;
-        return false;
-    }
-    
-    file << "{\n";
-    file << "  \"entries\": [\n";
-    
-    for (size_t i = 0; i < entries.size(); ++i) {
-        const auto& entry = entries[i];
-        
-        file << "    {\n";
-        file << "      \"wpm\": " << entry.wpm << ",\n";
-        file << "      \"accuracy\": " << entry.accuracy << ",\n";
-        file << "      \"targetWPM\": " << entry.targetWPM << ",\n";
-        file << "      \"errors\": " << entry.errors << ",\n";
-        file << "      \"difficulty\": \"" << escapeJsonString(entry.difficulty) << "\",\n";
-        file << "      \"language\": \"" << escapeJsonString(entry.language) << "\",\n";
-        file << "      \"mode\": \"" << escapeJsonString(entry.mode) << "\",\n";
-        file << "      \"timestamp\": \"" << escapeJsonString(entry.timestamp) << "\",\n";
-        file << "      \"timeElapsed\": " << entry.timeElapsed << "\n";
-        file << "    }" << (i < entries.size() - 1 ? "," : "") << "\n";
-    }
-    
-    file << "  ]\n";
-    file << "}\n";
-    
-    file.close();
+    PersistenceService::instance().scheduleWrite(
+        filename,
+        [wpm = wpmColumn, accuracy = accuracyColumn, timeElapsed = timeElapsedColumn,
+         epoch = epochColumn, targetWpm = targetWpmColumn, errors = errorsColumn,
+         codes = codeColumn, replays = replayColumn]() {
+            std::string data(JOURNAL_HEADER_SIZE + codes.size() * RECORD_SIZE, '\0');
+            unsigned char* out = reinterpret_cast<unsigned char*>(&data[0]);
+            writeHeader(out);
+            out += JOURNAL_HEADER_SIZE;
+
+            HistoryEntry entry;
+            for (size_t id = 0; id < codes.size(); ++id, out += RECORD_SIZE) {
+                entry.wpm = wpm[id];
+                entry.accuracy = accuracy[id];
+                entry.timeElapsed = timeElapsed[id];
+                entry.epoch = epoch[id];
+                entry.targetWPM = targetWpm[id];
+                entry.errors = errors[id];
+                entry.replayId = replays[id];
+                encodeRecord(entry, codes[id], out);
+            }
+            return data;
+        },
+        0);
     return true;
 }
 
@@ -569,29 +899,24 @@ bool HistoryManager::saveHistory() {
  * @par Kalkulasi Index
  * - startIndex = (pageNumber - 1) * pageSize
  * - endIndex = min(startIndex + pageSize, entries.size())
+ * - Index dihitung dari entry terbaru (index DATE dibaca dari belakang)
  * 
  * @see getTotalPages()
  */
 std::vector<HistoryEntry> HistoryManager::getPage(int pageNumber, int pageSize) {
     std::vector<HistoryEntry> result;
     
-    if (pageNumber < 1 || entries.empty()) {
-        return result;
-    }
-    
-    int startIndex = (pageNumber - 1) * pageSize;
-    int endIndex = startIndex + pageSize;
-    
-    if (startIndex >= (int)entries.size()) {
+    if (pageNumber < 1 || pageSize < 1 || codeColumn.empty()) {
         return result;
     }
     
-    if (endIndex > (int)entries.size()) {
-        endIndex = entries.size();
-    }
-    
-    for (int i = startIndex; i < endIndex; ++i) {
-        result.push_back(entries[i]);
+    std::vector<uint32_t> ids;
+    queryPage(HistoryFilter(), HistorySortKey::DATE, false,
+              static_cast<size_t>(pageNumber - 1) * pageSize, pageSize, ids);
+
+    result.reserve(ids.size());
+    for (uint32_t id : ids) {
+        result.push_back(getEntry(id));
     }
     
     return result;
@@ -619,8 +944,8 @@ std::vector<HistoryEntry> HistoryManager::getPage(int pageNumber, int pageSize)
  * @see getPage()
  */
 int HistoryManager::getTotalPages(int pageSize) {
-    if (entries.empty()) return 0;
-    return (int)std::ceil((double)entries.size() / pageSize);
+    if (codeColumn.empty() || pageSize < 1) return 0;
+    return (int)std::ceil((double)codeColumn.size() / pageSize);
 }
 
 /**
@@ -628,11 +953,11 @@ int HistoryManager::getTotalPages(int pageSize) {
  * 
  * @return int Jumlah total entry yang tersimpan dalam history
  * 
- * @note Fungsi ini mengembalikan ukuran vector entries di memory,
+ * @note Fungsi ini mengembalikan jumlah baris kolom di memory,
  *       yang sudah disinkronkan dengan file setelah load/save
  */
 int HistoryManager::getTotalEntries() {
-    return entries.size();
+    return static_cast<int>(codeColumn.size());
 }
 
 // ============================================================================
@@ -642,16 +967,8 @@ int HistoryManager::getTotalEntries() {
 /**
  * @brief Menghapus seluruh history
  * 
- * Mengosongkan vector entries di memory dan menyimpan file JSON kosong.
- * Setelah operasi ini, file history.json akan berisi array entries kosong.
- * 
- * @par Hasil File Setelah Clear
- * @code{.json}
- * {
- *   "entries": [
- *   ]
- * }
- * @endcode
+ * Mengosongkan kolom history di memory dan menulis ulang journal
+ * sehingga hanya berisi header. File replay ikut dihapus.
  * 
  * @note Operasi ini tidak dapat di-undo. Seluruh history akan hilang permanen.
  * 
@@ -660,6 +977,424 @@ int HistoryManager::getTotalEntries() {
  * @see saveHistory()
  */
 void HistoryManager::clearHistory() {
-    entries.clear();
+    // Lewat PersistenceService agar terurut setelah penulisan replay yang
+    // masih tertunda
+    for (uint32_t id = 0; id < replayColumn.size(); ++id) {
+        if (replayColumn[id] != 0) {
+            PersistenceService::instance().scheduleRemove(replayPath(id));
+        }
+    }
+    clearColumns();
     saveHistory();
+
+    // clearColumns() sudah mengosongkan agregat; journal tinggal header
+    PersistenceService::instance().scheduleWrite(keyStatsFilename, []() { return keyStatsHeader(); }, 0);
+}
+
+// ============================================================================
+// ENUM CODES
+// ============================================================================
+
+/**
+ * @brief Konversi nama difficulty ke kode byte journal
+ * 
+ * Urutan kode sama dengan enum Difficulty di TextProvider.h.
+ * Perbandingan case-insensitive ("easy" dan "Easy" sama).
+ */
+uint8_t HistoryManager::difficultyCode(const std::string& difficulty) {
+    const std::string value = toLowerAscii(difficulty);
+    if (value == "easy") return 0;
+    if (value == "medium") return 1;
+    if (value == "hard") return 2;
+    if (value == "programmer") return 3;
+    return UNKNOWN_CODE;
+}
+
+uint8_t HistoryManager::languageCode(const std::string& language) {
+    const std::string value = toLowerAscii(language);
+    if (value == "id") return 0;
+    if (value == "en") return 1;
+    if (value == "prog") return 2;
+    return UNKNOWN_CODE;
+}
+
+uint8_t HistoryManager::modeCode(const std::string& mode) {
+    const std::string value = toLowerAscii(mode);
+    if (value == "manual") return 0;
+    if (value == "campaign") return 1;
+    return UNKNOWN_CODE;
+}
+
+std::string HistoryManager::difficultyName(uint8_t code) {
+    static const char* names[] = {"Easy", "Medium", "Hard", "Programmer"};
+    return code < 4 ? names[code] : "";
+}
+
+std::string HistoryManager::languageName(uint8_t code) {
+    static const char* names[] = {"ID", "EN", "PROG"};
+    return code < 3 ? names[code] : "";
+}
+
+std::string HistoryManager::modeName(uint8_t code) {
+    static const char* names[] = {"Manual", "Campaign"};
+    return code < 2 ? names[code] : "";
+}
+
+uint16_t HistoryManager::packCodes(uint8_t mode, uint8_t language, uint8_t difficulty) {
+    auto nibble = [](uint8_t code) -> uint16_t { return code < 0xF ? code : 0xF; };
+    return static_cast<uint16_t>(nibble(mode) | (nibble(language) << 4) | (nibble(difficulty) << 8));
+}
+
+// ============================================================================
+// COLUMNAR STORAGE
+// ============================================================================
+
+/**
+ * @brief Menambahkan satu baris ke kolom-kolom history
+ * 
+ * @param entry Nilai numerik entry (field string diabaikan)
+ * @param codes Kode mode/bahasa/difficulty hasil packCodes()
+ * @param updateIndices true untuk menyisipkan ID baru ke setiap index
+ * 
+ * @par Update Index Incremental
+ * ID baru selalu yang terbesar, sehingga posisi sisipnya di index
+ * (urut berdasarkan nilai, tie berdasarkan ID) cukup dicari dengan
+ * upper_bound terhadap nilai: O(log n) pencarian + satu memmove.
+ */
+void HistoryManager::appendRow(const HistoryEntry& entry, uint16_t codes, bool updateIndices) {
+    const uint32_t id = static_cast<uint32_t>(codeColumn.size());
+
+    wpmColumn.push_back(entry.wpm);
+    accuracyColumn.push_back(entry.accuracy);
+    timeElapsedColumn.push_back(entry.timeElapsed);
+    epochColumn.push_back(entry.epoch);
+    targetWpmColumn.push_back(entry.targetWPM);
+    errorsColumn.push_back(entry.errors);
+    codeColumn.push_back(codes);
+    replayColumn.push_back(entry.replayId);
+    if (entry.replayId != 0) {
+        nextReplayId = std::max(nextReplayId, entry.replayId + 1);
+    }
+
+    stats.add(codes, entry.wpm, entry.accuracy);
+
+    if (!updateIndices) {
+        return;
+    }
+
+    for (size_t k = 0; k < sortedIndex.size(); ++k) {
+        const HistorySortKey key = static_cast<HistorySortKey>(k);
+        auto& index = sortedIndex[k];
+        const double value = sortValue(key, id);
+        auto pos = std::upper_bound(index.begin(), index.end(), value,
+                                    [this, key](double v, uint32_t other) {
+                                        return v < sortValue(key, other);
+                                    });
+        index.insert(pos, id);
+    }
+}
+
+/**
+ * @brief Membangun ulang seluruh index sorting dari kolom
+ * 
+ * Dipakai setelah bulk load. stable_sort atas ID yang sudah urut
+ * menjamin urutan tie sama dengan hasil appendRow() incremental.
+ */
+void HistoryManager::rebuildIndices() {
+    const uint32_t count = static_cast<uint32_t>(codeColumn.size());
+    for (size_t k = 0; k < sortedIndex.size(); ++k) {
+        const HistorySortKey key = static_cast<HistorySortKey>(k);
+        auto& index = sortedIndex[k];
+        index.resize(count);
+        for (uint32_t id = 0; id < count; ++id) {
+            index[id] = id;
+        }
+        std::stable_sort(index.begin(), index.end(),
+                         [this, key](uint32_t a, uint32_t b) {
+                             return sortValue(key, a) < sortValue(key, b);
+                         });
+    }
+}
+
+void HistoryManager::clearColumns() {
+    wpmColumn.clear();
+    accuracyColumn.clear();
+    timeElapsedColumn.clear();
+    epochColumn.clear();
+    targetWpmColumn.clear();
+    errorsColumn.clear();
+    codeColumn.clear();
+    replayColumn.clear();
+    for (auto& index : sortedIndex) {
+        index.clear();
+    }
+    stats.clear();
+    for (auto& keyStats : keyStatsByLanguage) {
+        keyStats.clear();
+    }
+    keyStatsAllValid = false;
+}
+
+double HistoryManager::sortValue(HistorySortKey key, uint32_t id) const {
+    switch (key) {
+        case HistorySortKey::WPM:
+            return wpmColumn[id];
+        case HistorySortKey::ACCURACY:
+            return accuracyColumn[id];
+        case HistorySortKey::TIME:
+            return timeElapsedColumn[id];
+        case HistorySortKey::DATE:
+            break;
+    }
+    return static_cast<double>(epochColumn[id]);
+}
+
+// ============================================================================
+// INDEXED QUERIES
+// ============================================================================
+
+/**
+ * @brief Membuat filter bitmask dari nama mode/bahasa/difficulty
+ * 
+ * String "All" atau kosong berarti dimensi tersebut tidak difilter.
+ * Nama yang tidak dikenal tetap difilter (dan tidak akan cocok dengan
+ * entry yang kodenya dikenal), sama seperti perbandingan string lama.
+ */
+HistoryFilter HistoryManager::makeFilter(const std::string& mode,
+                                         const std::string& language,
+                                         const std::string& difficulty) {
+    HistoryFilter filter;
+    auto add = [&filter](const std::string& name, uint8_t code, int shift) {
+        if (name.empty() || toLowerAscii(name) == "all") {
+            return;
+        }
+        const uint16_t nibble = code < 0xF ? code : 0xF;
+        filter.mask |= static_cast<uint16_t>(0xF << shift);
+        filter.value |= static_cast<uint16_t>(nibble << shift);
+    };
+    add(mode, modeCode(mode), 0);
+    add(language, languageCode(language), 4);
+    add(difficulty, difficultyCode(difficulty), 8);
+    return filter;
+}
+
+/**
+ * @brief Mendapatkan statistik agregat untuk kombinasi filter
+ * 
+ * Aturan nama sama dengan makeFilter(): "All" atau kosong berarti semua,
+ * nama yang tidak dikenal menghasilkan bucket kosong.
+ */
+const StatsBucket& HistoryManager::getStats(const std::string& mode,
+                                            const std::string& language,
+                                            const std::string& difficulty) const {
+    auto code = [](const std::string& name, uint8_t (*toCode)(const std::string&)) {
+        if (name.empty() || toLowerAscii(name) == "all") {
+            return HistoryStats::ALL;
+        }
+        return toCode(name);
+    };
+    return stats.bucket(code(mode, &HistoryManager::modeCode),
+                        code(language, &HistoryManager::languageCode),
+                        code(difficulty, &HistoryManager::difficultyCode));
+}
+
+/**
+ * @brief Mengambil ID entry untuk satu halaman hasil filter + sorting
+ * 
+ * Berjalan di atas index sorting yang sudah ada (maju untuk ascending,
+ * mundur untuk descending), melewati entry yang tidak cocok dengan
+ * filter, lalu mengambil slice [offset, offset + limit). Tidak ada copy
+ * entry, sorting, maupun operasi string.
+ * 
+ * @return Jumlah ID yang ditulis ke ids
+ */
+size_t HistoryManager::queryPage(const HistoryFilter& filter, HistorySortKey key, bool ascending,
+                                 size_t offset, size_t limit, std::vector<uint32_t>& ids) const {
+    ids.clear();
+    const auto& index = sortedIndex[static_cast<size_t>(key)];
+    const size_t count = index.size();
+
+    size_t skipped = 0;
+    for (size_t i = 0; i < count && ids.size() < limit; ++i) {
+        const uint32_t id = ascending ? index[i] : index[count - 1 - i];
+        if (!filter.matches(codeColumn[id])) {
+            continue;
+        }
+        if (skipped < offset) {
+            ++skipped;
+            continue;
+        }
+        ids.push_back(id);
+    }
+    return ids.size();
+}
+
+size_t HistoryManager::countMatching(const HistoryFilter& filter) const {
+    if (filter.mask == 0) {
+        return codeColumn.size();
+    }
+    return static_cast<size_t>(std::count_if(codeColumn.begin(), codeColumn.end(),
+                                             [&filter](uint16_t codes) {
+                                                 return filter.matches(codes);
+                                             }));
+}
+
+/**
+ * @brief Membangun HistoryEntry lengkap (termasuk string) untuk satu ID
+ * 
+ * String nama dan timestamp hanya dibuat di sini, yaitu untuk baris yang
+ * benar-benar ditampilkan.
+ */
+HistoryEntry HistoryManager::getEntry(uint32_t id) const {
+    HistoryEntry entry;
+    if (id >= codeColumn.size()) {
+        return entry;
+    }
+
+    const uint16_t codes = codeColumn[id];
+    entry.wpm = wpmColumn[id];
+    entry.accuracy = accuracyColumn[id];
+    entry.timeElapsed = timeElapsedColumn[id];
+    entry.epoch = epochColumn[id];
+    entry.targetWPM = targetWpmColumn[id];
+    entry.errors = errorsColumn[id];
+    entry.replayId = replayColumn[id];
+    entry.mode = modeName(codes & 0xF);
+    entry.language = languageName((codes >> 4) & 0xF);
+    entry.difficulty = difficultyName((codes >> 8) & 0xF);
+    entry.timestamp = formatTimestamp(entry.epoch);
+    return entry;
+}
+
+// ============================================================================
+// REPLAY
+// ============================================================================
+
+std::string HistoryManager::siblingPath(const std::string& name) const {
+    const size_t separator = filename.find_last_of("/\\");
+    const std::string directory =
+        separator == std::string::npos ? std::string() : filename.substr(0, separator + 1);
+    return directory + name;
+}
+
+std::string HistoryManager::replayPath(uint32_t id) const {
+    return siblingPath("replay_" + std::to_string(replayColumn[id]) + ".rtr");
+}
+
+/**
+ * @brief Membaca file replay satu entry
+ *
+ * Dipanggil hanya saat replay benar-benar dipakai (ghost race); loading
+ * history dan query halaman tidak pernah membuka file replay.
+ */
+bool HistoryManager::loadReplay(uint32_t id, std::string& out) const {
+    if (id >= replayColumn.size() || replayColumn[id] == 0) {
+        return false;
+    }
+
+    std::ifstream file(replayPath(id), std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    out = buffer.str();
+    return true;
+}
+
+int64_t HistoryManager::bestReplayId(const HistoryFilter& filter) const {
+    const auto& index = sortedIndex[static_cast<size_t>(HistorySortKey::WPM)];
+    for (auto it = index.rbegin(); it != index.rend(); ++it) {
+        if (replayColumn[*it] != 0 && filter.matches(codeColumn[*it])) {
+            return *it;
+        }
+    }
+    return -1;
+}
+
+// ============================================================================
+// KEY STATS
+// ============================================================================
+
+size_t HistoryManager::keyStatsSlot(uint8_t language) {
+    return language < KEYSTATS_SLOTS - 1 ? language : KEYSTATS_SLOTS - 1;
+}
+
+/**
+ * @brief Menjumlahkan setiap record keystats.journal ke agregat bahasanya
+ * 
+ * Record yang terpotong di akhir file (crash saat append) atau yang
+ * checksum-nya salah dibuang. Karena record berukuran variabel, record
+ * yang valid disalin apa adanya lalu journal ditulis ulang sekali.
+ * Journal dengan header rusak disisihkan ke *.corrupt dan diganti
+ * journal kosong.
+ */
+void HistoryManager::loadKeyStats() {
+    std::ifstream file(keyStatsFilename, std::ios::binary);
+    if (!file.is_open()) {
+        return;
+    }
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    const std::string data = buffer.str();
+    file.close();
+
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data.data());
+    if (data.size() < KEYSTATS_HEADER_SIZE || std::memcmp(bytes, KEYSTATS_MAGIC, 4) != 0 ||
+        getU16(bytes + 4) != KEYSTATS_VERSION) {
+        std::cerr << "Invalid key stats journal, moved to " << keyStatsFilename << ".corrupt" << std::endl;
+        PersistenceService::instance().flush();
+        PersistenceService::replaceFile(keyStatsFilename, keyStatsFilename + ".corrupt");
+        PersistenceService::instance().scheduleWrite(keyStatsFilename, []() { return keyStatsHeader(); }, 0);
+        return;
+    }
+
+    bool damaged = false;
+    std::string valid = data.substr(0, KEYSTATS_HEADER_SIZE);
+    size_t offset = KEYSTATS_HEADER_SIZE;
+    while (offset < data.size()) {
+        if (data.size() - offset < KEYSTATS_RECORD_HEADER_SIZE) {
+            damaged = true;
+            break;
+        }
+        const uint32_t length = getU32(bytes + offset);
+        const uint32_t sum = getU32(bytes + offset + 4);
+        const size_t payload = offset + KEYSTATS_RECORD_HEADER_SIZE;
+        if (length == 0 || length > KEYSTATS_MAX_PAYLOAD || data.size() - payload < length) {
+            // Panjang tidak masuk akal: sisa file tidak bisa dipercaya
+            damaged = true;
+            break;
+        }
+
+        const size_t next = payload + length;
+        if (sum == checksum(bytes + payload, length) &&
+            keyStatsByLanguage[keyStatsSlot(bytes[payload])].accumulate(
+                data.substr(payload + 1, length - 1))) {
+            valid.append(data, offset, next - offset);
+        } else {
+            damaged = true;
+        }
+        offset = next;
+    }
+
+    if (damaged) {
+        PersistenceService::instance().scheduleWrite(
+            keyStatsFilename, [valid = std::move(valid)]() { return valid; }, 0);
+    }
+}
+
+const KeyStats& HistoryManager::getKeyStats(const std::string& language) const {
+    const uint8_t code = languageCode(language);
+    if (code != UNKNOWN_CODE) {
+        return keyStatsByLanguage[keyStatsSlot(code)];
+    }
+
+    if (!keyStatsAllValid) {
+        keyStatsAll = keyStatsByLanguage[0];
+        for (size_t slot = 1; slot < KEYSTATS_SLOTS; ++slot) {
+            keyStatsAll.merge(keyStatsByLanguage[slot]);
+        }
+        keyStatsAllValid = true;
+    }
+    return keyStatsAll;
 }
\ No newline at end of file
@@ -0,0 +1,177 @@
+/**
+ * @file HistoryModel.cpp
+ * @brief Implementation of HistoryModel list model
+ * @author Alea Farrel & Team
+ * @date 2025
+ */
+
+#include "HistoryModel.h"
+#include <algorithm>
+
+HistoryModel::HistoryModel(const HistoryManager *manager, QObject *parent)
+    : QAbstractListModel(parent), m_manager(manager),
+      m_sortKey(HistorySortKey::DATE), m_ascending(false), m_totalCount(0) {}
+
+// ============================================================================
+// QABSTRACTLISTMODEL INTERFACE
+// ============================================================================
+
+int HistoryModel::rowCount(const QModelIndex &parent) const {
+  if (parent.isValid())
+    return 0;
+  return int(m_rows.size());
+}
+
+QVariant HistoryModel::data(const QModelIndex &index, int role) const {
+  if (!index.isValid() || index.row() < 0 || index.row() >= int(m_rows.size()))
+    return QVariant();
+
+  const uint32_t id = m_rows[size_t(index.row())];
+  switch (role) {
+  case WpmRole:
+    return m_manager->wpmAt(id);
+  case AccuracyRole:
+    return m_manager->accuracyAt(id);
+  case ErrorsRole:
+    return m_manager->errorsAt(id);
+  case TargetWpmRole:
+    return m_manager->targetWpmAt(id);
+  case DifficultyRole:
+    return QString::fromStdString(HistoryManager::difficultyName(
+        uint8_t((m_manager->codesAt(id) >> 8) & 0xF)));
+  case LanguageRole:
+    return QString::fromStdString(HistoryManager::languageName(
+        uint8_t((m_manager->codesAt(id) >> 4) & 0xF)));
+  case ModeRole:
+    return QString::fromStdString(
+        HistoryManager::modeName(uint8_t(m_manager->codesAt(id) & 0xF)));
+  case TimestampRole:
+    return QString::fromStdString(
+        HistoryManager::formatTimestamp(m_manager->epochAt(id)));
+  case TimeElapsedRole:
+    return m_manager->timeElapsedAt(id);
+  default:
+    return QVariant();
+  }
+}
+
+QHash<int, QByteArray> HistoryModel::roleNames() const {
+  return {{WpmRole, "wpm"},
+          {AccuracyRole, "accuracy"},
+          {ErrorsRole, "errors"},
+          {TargetWpmRole, "targetWPM"},
+          {DifficultyRole, "difficulty"},
+          {LanguageRole, "language"},
+          {ModeRole, "mode"},
+          {TimestampRole, "timestamp"},
+          {TimeElapsedRole, "timeElapsed"}};
+}
+
+bool HistoryModel::canFetchMore(const QModelIndex &parent) const {
+  if (parent.isValid())
+    return false;
+  return int(m_rows.size()) < m_totalCount;
+}
+
+void HistoryModel::fetchMore(const QModelIndex &parent) {
+  if (!canFetchMore(parent))
+    return;
+
+  // Rows past the loaded prefix are still in query order, so the next batch
+  // is simply the slice starting at the current row count
+  std::vector<uint32_t> ids;
+  m_manager->queryPage(m_filter, m_sortKey, m_ascending, m_rows.size(),
+                       FETCH_BATCH_SIZE, ids);
+  if (ids.empty())
+    return;
+
+  const int first = int(m_rows.size());
+  beginInsertRows(QModelIndex(), first, first + int(ids.size()) - 1);
+  m_rows.insert(m_rows.end(), ids.begin(), ids.end());
+  endInsertRows();
+}
+
+// ============================================================================
+// QUERY INTERFACE
+// ============================================================================
+
+void HistoryModel::setQuery(const QString &sortBy, bool ascending,
+                            const QString &modeFilter,
+                            const QString &languageFilter,
+                            const QString &difficultyFilter) {
+  m_filter = HistoryManager::makeFilter(modeFilter.toStdString(),
+                                        languageFilter.toStdString(),
+                                        difficultyFilter.toStdString());
+
+  m_sortKey = HistorySortKey::DATE;
+  if (sortBy == "wpm")
+    m_sortKey = HistorySortKey::WPM;
+  else if (sortBy == "accuracy")
+    m_sortKey = HistorySortKey::ACCURACY;
+  else if (sortBy == "time")
+    m_sortKey = HistorySortKey::TIME;
+
+  m_ascending = ascending;
+  reload();
+}
+
+QVariantMap HistoryModel::get(int row) const {
+  QVariantMap item;
+  if (row < 0 || row >= int(m_rows.size()))
+    return item;
+
+  const QHash<int, QByteArray> roles = roleNames();
+  const QModelIndex idx = index(row);
+  for (auto it = roles.cbegin(); it != roles.cend(); ++it)
+    item[QString::fromLatin1(it.value())] = data(idx, it.key());
+  return item;
+}
+
+void HistoryModel::ensureLoaded(int count) {
+  while (int(m_rows.size()) < count && canFetchMore(QModelIndex()))
+    fetchMore(QModelIndex());
+}
+
+int HistoryModel::totalCount() const { return m_totalCount; }
+
+// ============================================================================
+// HISTORY CHANGES
+// ============================================================================
+
+bool HistoryModel::precedes(uint32_t a, uint32_t b) const {
+  const double va = m_manager->sortValue(m_sortKey, a);
+  const double vb = m_manager->sortValue(m_sortKey, b);
+  // Same (value, id) ordering as HistoryManager's sort indices
+  const bool less = va < vb || (va == vb && a < b);
+  return m_ascending ? less : !less && a != b;
+}
+
+void HistoryModel::entryAppended(uint32_t id) {
+  if (!m_filter.matches(m_manager->codesAt(id)))
+    return;
+
+  const bool fullyLoaded = int(m_rows.size()) == m_totalCount;
+  ++m_totalCount;
+
+  const auto pos = std::partition_point(
+      m_rows.begin(), m_rows.end(),
+      [this, id](uint32_t row) { return precedes(row, id); });
+
+  // An entry that sorts past the loaded prefix is picked up by fetchMore
+  if (pos != m_rows.end() || fullyLoaded) {
+    const int row = int(pos - m_rows.begin());
+    beginInsertRows(QModelIndex(), row, row);
+    m_rows.insert(m_rows.begin() + row, id);
+    endInsertRows();
+  }
+
+  emit totalCountChanged();
+}
+
+void HistoryModel::reload() {
+  beginResetModel();
+  m_rows.clear();
+  m_totalCount = int(m_manager->countMatching(m_filter));
+  endResetModel();
+  emit totalCountChanged();
+}
@@ -0,0 +1,215 @@
+/**
+ * @file HistoryStats.cpp
+ * @brief Implementasi statistik agregat history
+ * @author Alea Farrel & Team
+ * @date 2025
+ */
+
+#include "HistoryStats.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/// Bobot game terbaru pada exponential moving average (~ rata-rata 10 game terakhir)
+constexpr double EMA_ALPHA = 2.0 / 11.0;
+
+} // namespace
+
+// ============================================================================
+// RUNNING METRIC
+// ============================================================================
+
+void RunningMetric::add(double x, uint32_t countBefore) {
+    if (countBefore == 0) {
+        min = x;
+        max = x;
+        ema = x;
+    } else {
+        min = std::min(min, x);
+        max = std::max(max, x);
+        ema += EMA_ALPHA * (x - ema);
+    }
+    sum += x;
+    sumSq += x * x;
+}
+
+double RunningMetric::mean(uint32_t count) const {
+    return count > 0 ? sum / count : 0.0;
+}
+
+/**
+ * @brief Standar deviasi populasi dari sum dan sumSq
+ * 
+ * Hasil variance dibatasi >= 0 untuk menghindari nilai negatif kecil
+ * akibat pembulatan floating point.
+ */
+double RunningMetric::stdDev(uint32_t count) const {
+    if (count < 2) {
+        return 0.0;
+    }
+    const double m = sum / count;
+    const double variance = sumSq / count - m * m;
+    return variance > 0.0 ? std::sqrt(variance) : 0.0;
+}
+
+// ============================================================================
+// P² QUANTILE ESTIMATOR
+// ============================================================================
+
+P2Quantile::P2Quantile(double p)
+    : p(p), count(0), heights{}, positions{}, desired{}, increment{} {}
+
+/**
+ * @brief Menambahkan satu sampel
+ * 
+ * 5 sampel pertama disimpan apa adanya. Setelah itu, marker yang
+ * mengapit sampel digeser, lalu marker tengah disesuaikan dengan
+ * interpolasi parabolik (atau linear jika parabolik keluar batas).
+ */
+void P2Quantile::add(double x) {
+    if (count < 5) {
+        heights[count++] = x;
+        if (count == 5) {
+            std::sort(heights.begin(), heights.end());
+            positions = {1.0, 2.0, 3.0, 4.0, 5.0};
+            desired = {1.0, 1.0 + 2.0 * p, 1.0 + 4.0 * p, 3.0 + 2.0 * p, 5.0};
+            increment = {0.0, p / 2.0, p, (1.0 + p) / 2.0, 1.0};
+        }
+        return;
+    }
+    ++count;
+
+    // Cari sel k tempat x berada, perluas marker ujung jika perlu
+    int k;
+    if (x < heights[0]) {
+        heights[0] = x;
+        k = 0;
+    } else if (x >= heights[4]) {
+        heights[4] = x;
+        k = 3;
+    } else {
+        k = 0;
+        while (k < 3 && x >= heights[k + 1]) {
+            ++k;
+        }
+    }
+
+    for (int i = k + 1; i < 5; ++i) {
+        positions[i] += 1.0;
+    }
+    for (int i = 0; i < 5; ++i) {
+        desired[i] += increment[i];
+    }
+
+    // Sesuaikan marker tengah yang menyimpang >= 1 dari posisi idealnya
+    for (int i = 1; i <= 3; ++i) {
+        const double d = desired[i] - positions[i];
+        if ((d >= 1.0 && positions[i + 1] - positions[i] > 1.0) ||
+            (d <= -1.0 && positions[i - 1] - positions[i] < -1.0)) {
+            const int step = d > 0.0 ? 1 : -1;
+            const double candidate = parabolic(i, step);
+            if (heights[i - 1] < candidate && candidate < heights[i + 1]) {
+                heights[i] = candidate;
+            } else {
+                heights[i] = linear(i, step);
+            }
+            positions[i] += step;
+        }
+    }
+}
+
+/**
+ * @brief Nilai persentil saat ini
+ * 
+ * Dengan kurang dari 5 sampel, persentil dihitung eksak (nearest rank)
+ * dari sampel yang tersimpan.
+ */
+double P2Quantile::value() const {
+    if (count == 0) {
+        return 0.0;
+    }
+    if (count < 5) {
+        std::array<double, 5> sorted = heights;
+        std::sort(sorted.begin(), sorted.begin() + count);
+        const size_t rank = static_cast<size_t>(std::lround(p * (count - 1)));
+        return sorted[rank];
+    }
+    return heights[2];
+}
+
+double P2Quantile::parabolic(int i, double d) const {
+    const double nPrev = positions[i - 1];
+    const double n = positions[i];
+    const double nNext = positions[i + 1];
+    return heights[i] + d / (nNext - nPrev) *
+           ((n - nPrev + d) * (heights[i + 1] - heights[i]) / (nNext - n) +
+            (nNext - n - d) * (heights[i] - heights[i - 1]) / (n - nPrev));
+}
+
+double P2Quantile::linear(int i, int d) const {
+    return heights[i] + d * (heights[i + d] - heights[i]) / (positions[i + d] - positions[i]);
+}
+
+// ============================================================================
+// BUCKETS
+// ============================================================================
+
+void StatsBucket::add(double wpmValue, double accuracyValue) {
+    wpm.add(wpmValue, count);
+    accuracy.add(accuracyValue, count);
+    wpmP50.add(wpmValue);
+    wpmP90.add(wpmValue);
+    ++count;
+}
+
+/**
+ * @brief Menambahkan satu game ke 8 bucket yang relevan
+ * 
+ * Kombinasi {nilai spesifik, All} untuk mode x bahasa x difficulty.
+ * Dimensi dengan kode tidak dikenal hanya memakai slot All.
+ */
+void HistoryStats::add(uint16_t codes, double wpm, double accuracy) {
+    const size_t modeSlots[2] = {slot(codes & 0xF, MODE_SLOTS), MODE_SLOTS - 1};
+    const size_t languageSlots[2] = {slot((codes >> 4) & 0xF, LANGUAGE_SLOTS), LANGUAGE_SLOTS - 1};
+    const size_t difficultySlots[2] = {slot((codes >> 8) & 0xF, DIFFICULTY_SLOTS), DIFFICULTY_SLOTS - 1};
+
+    const int modeCount = modeSlots[0] == modeSlots[1] ? 1 : 2;
+    const int languageCount = languageSlots[0] == languageSlots[1] ? 1 : 2;
+    const int difficultyCount = difficultySlots[0] == difficultySlots[1] ? 1 : 2;
+
+    for (int m = 0; m < modeCount; ++m) {
+        for (int l = 0; l < languageCount; ++l) {
+            for (int d = 0; d < difficultyCount; ++d) {
+                buckets[bucketIndex(modeSlots[m], languageSlots[l], difficultySlots[d])]
+                    .add(wpm, accuracy);
+            }
+        }
+    }
+}
+
+const StatsBucket& HistoryStats::bucket(uint8_t mode, uint8_t language, uint8_t difficulty) const {
+    static const StatsBucket empty;
+    if ((mode != ALL && mode >= MODE_SLOTS - 1) ||
+        (language != ALL && language >= LANGUAGE_SLOTS - 1) ||
+        (difficulty != ALL && difficulty >= DIFFICULTY_SLOTS - 1)) {
+        return empty;
+    }
+    return buckets[bucketIndex(slot(mode, MODE_SLOTS), slot(language, LANGUAGE_SLOTS),
+                               slot(difficulty, DIFFICULTY_SLOTS))];
+}
+
+void HistoryStats::clear() {
+    buckets.fill(StatsBucket());
+}
+
+/**
+ * @brief Slot untuk satu kode; kode tidak dikenal jatuh ke slot All
+ */
+size_t HistoryStats::slot(uint8_t code, size_t slots) {
+    return code < slots - 1 ? code : slots - 1;
+}
+
+size_t HistoryStats::bucketIndex(size_t mode, size_t language, size_t difficulty) {
+    return (mode * LANGUAGE_SLOTS + language) * DIFFICULTY_SLOTS + difficulty;
+}
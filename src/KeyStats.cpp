@@ -0,0 +1,284 @@
+/**
+ * @file KeyStats.cpp
+ * @brief Implementasi KeyStats (tabel padat + serialize sparse varint)
+ * @author Alea Farrel & Team
+ * @date 2025
+ */
+
+#include "KeyStats.h"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+// ============================================================================
+// VARINT ENCODING
+// ============================================================================
+
+namespace {
+    constexpr char KEYSTATS_MAGIC[4] = {'R', 'T', 'K', 'S'};
+
+    void putVarint(std::string& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    bool getVarint(const std::string& data, size_t& offset, uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && offset < data.size(); shift += 7) {
+            const unsigned char byte = static_cast<unsigned char>(data[offset++]);
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Tulis sel terisi satu tabel: jumlah sel, lalu (delta index,
+     *        sampel, salah, latency) per sel
+     */
+    void putTable(std::string& out, const std::vector<uint32_t>& hits,
+                  const std::vector<uint32_t>& errors, const std::vector<uint64_t>& latency) {
+        uint64_t cells = 0;
+        for (size_t i = 0; i < hits.size(); ++i) {
+            cells += (hits[i] | errors[i]) != 0;
+        }
+        putVarint(out, cells);
+
+        size_t last = 0;
+        for (size_t i = 0; i < hits.size(); ++i) {
+            if ((hits[i] | errors[i]) == 0) continue;
+            putVarint(out, i - last);
+            putVarint(out, hits[i]);
+            putVarint(out, errors[i]);
+            putVarint(out, latency[i]);
+            last = i;
+        }
+    }
+
+    /**
+     * @brief Baca satu tabel; tambahkan ke array jika apply = true
+     * @return false jika data terpotong atau index di luar tabel
+     */
+    bool readTable(const std::string& data, size_t& offset, bool apply,
+                   std::vector<uint32_t>& hits, std::vector<uint32_t>& errors,
+                   std::vector<uint64_t>& latency) {
+        uint64_t cells;
+        if (!getVarint(data, offset, cells) || cells > hits.size()) {
+            return false;
+        }
+
+        uint64_t index = 0;
+        for (uint64_t c = 0; c < cells; ++c) {
+            uint64_t delta, hit, error, sum;
+            if (!getVarint(data, offset, delta) || !getVarint(data, offset, hit) ||
+                !getVarint(data, offset, error) || !getVarint(data, offset, sum)) {
+                return false;
+            }
+            // Dicek sebelum dijumlah: delta raksasa bisa membuat index wrap
+            if (delta >= hits.size() - index || hit > UINT32_MAX || error > UINT32_MAX) {
+                return false;
+            }
+            index += delta;
+            if (apply) {
+                hits[index] += static_cast<uint32_t>(hit);
+                errors[index] += static_cast<uint32_t>(error);
+                latency[index] += sum;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    void addArray(std::vector<T>& into, const std::vector<T>& from) {
+        T* dst = into.data();
+        const T* src = from.data();
+        const size_t n = into.size();
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] += src[i];
+        }
+    }
+}
+
+// ============================================================================
+// RECORDING
+// ============================================================================
+
+KeyStats::KeyStats()
+    : keyHits(KEYS), keyErrors(KEYS), keyLatency(KEYS),
+      bigramHits(BIGRAMS), bigramErrors(BIGRAMS), bigramLatency(BIGRAMS) {
+}
+
+void KeyStats::clear() {
+    std::fill(keyHits.begin(), keyHits.end(), 0);
+    std::fill(keyErrors.begin(), keyErrors.end(), 0);
+    std::fill(keyLatency.begin(), keyLatency.end(), 0);
+    std::fill(bigramHits.begin(), bigramHits.end(), 0);
+    std::fill(bigramErrors.begin(), bigramErrors.end(), 0);
+    std::fill(bigramLatency.begin(), bigramLatency.end(), 0);
+}
+
+void KeyStats::recordHit(uint32_t previous, uint32_t key, uint64_t intervalUs) {
+    if (key >= KEYS) return;
+
+    ++keyHits[key];
+    keyLatency[key] += intervalUs;
+    if (previous < KEYS) {
+        const uint32_t index = previous * KEYS + key;
+        ++bigramHits[index];
+        bigramLatency[index] += intervalUs;
+    }
+}
+
+void KeyStats::recordMiss(uint32_t previous, uint32_t key) {
+    if (key >= KEYS) return;
+
+    ++keyErrors[key];
+    if (previous < KEYS) {
+        ++bigramErrors[previous * KEYS + key];
+    }
+}
+
+void KeyStats::merge(const KeyStats& other) {
+    addArray(keyHits, other.keyHits);
+    addArray(keyErrors, other.keyErrors);
+    addArray(keyLatency, other.keyLatency);
+    addArray(bigramHits, other.bigramHits);
+    addArray(bigramErrors, other.bigramErrors);
+    addArray(bigramLatency, other.bigramLatency);
+}
+
+bool KeyStats::empty() const {
+    // Setiap keystroke tercatat di tabel tombol, jadi cukup cek 128 sel
+    for (uint32_t i = 0; i < KEYS; ++i) {
+        if ((keyHits[i] | keyErrors[i]) != 0) return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// QUERIES
+// ============================================================================
+
+double KeyStats::keyMeanUs(uint32_t key) const {
+    return keyHits[key] > 0 ? static_cast<double>(keyLatency[key]) / keyHits[key] : 0.0;
+}
+
+double KeyStats::bigramMeanUs(uint32_t index) const {
+    return bigramHits[index] > 0 ? static_cast<double>(bigramLatency[index]) / bigramHits[index] : 0.0;
+}
+
+double KeyStats::overallMeanUs() const {
+    // Setiap sampel bigram juga sampel tombol, jadi cukup 128 sel
+    const uint64_t samples = std::accumulate(keyHits.begin(), keyHits.end(), uint64_t{0});
+    const uint64_t total = std::accumulate(keyLatency.begin(), keyLatency.end(), uint64_t{0});
+    return samples > 0 ? static_cast<double>(total) / samples : 0.0;
+}
+
+namespace {
+    float weakness(uint32_t hits, uint32_t errors, uint64_t latency,
+                   double overallUs, uint32_t minSamples, float missWeight) {
+        const uint64_t attempts = static_cast<uint64_t>(hits) + errors;
+        if (attempts == 0 || attempts < minSamples) {
+            return 0.0f;
+        }
+        double score = missWeight * static_cast<double>(errors) / attempts;
+        if (hits > 0 && overallUs > 0.0) {
+            const double slowness = static_cast<double>(latency) / hits / overallUs - 1.0;
+            score += std::max(0.0, slowness);
+        }
+        return static_cast<float>(score);
+    }
+}
+
+float KeyStats::keyWeakness(uint32_t key, uint32_t minSamples) const {
+    return weakness(keyHits[key], keyErrors[key], keyLatency[key],
+                    overallMeanUs(), minSamples, MISS_WEIGHT);
+}
+
+float KeyStats::bigramWeakness(uint32_t index, uint32_t minSamples) const {
+    return weakness(bigramHits[index], bigramErrors[index], bigramLatency[index],
+                    overallMeanUs(), minSamples, MISS_WEIGHT);
+}
+
+std::vector<float> KeyStats::weaknessWeights(uint32_t minSamples) const {
+    const double overallUs = overallMeanUs();
+    if (overallUs <= 0.0) {
+        return {};
+    }
+
+    std::vector<float> weights(BIGRAMS);
+    for (uint32_t i = 0; i < BIGRAMS; ++i) {
+        weights[i] = weakness(bigramHits[i], bigramErrors[i], bigramLatency[i],
+                              overallUs, minSamples, MISS_WEIGHT);
+    }
+    return weights;
+}
+
+std::vector<uint32_t> KeyStats::weakestBigrams(size_t limit, uint32_t minSamples) const {
+    const std::vector<float> weights = weaknessWeights(minSamples);
+
+    std::vector<uint32_t> result;
+    for (uint32_t i = 0; i < weights.size(); ++i) {
+        if (weights[i] > 0.0f) result.push_back(i);
+    }
+
+    const size_t n = std::min(limit, result.size());
+    std::partial_sort(result.begin(), result.begin() + static_cast<std::ptrdiff_t>(n), result.end(),
+                      [&weights](uint32_t a, uint32_t b) {
+                          return weights[a] != weights[b] ? weights[a] > weights[b] : a < b;
+                      });
+    result.resize(n);
+    return result;
+}
+
+// ============================================================================
+// SERIALIZATION
+// ============================================================================
+
+std::string KeyStats::serialize() const {
+    std::string data;
+    data.append(KEYSTATS_MAGIC, 4);
+    data.push_back(static_cast<char>(FILE_VERSION & 0xFF));
+    data.push_back(static_cast<char>(FILE_VERSION >> 8));
+    data.append(2, '\0');
+    putTable(data, keyHits, keyErrors, keyLatency);
+    putTable(data, bigramHits, bigramErrors, bigramLatency);
+    return data;
+}
+
+/**
+ * @brief Validasi seluruh data dulu, baru tambahkan
+ *
+ * Dua kali jalan agar data yang rusak di tengah tidak meninggalkan agregat
+ * setengah terjumlah.
+ */
+bool KeyStats::accumulate(const std::string& data) {
+    if (data.size() < HEADER_SIZE || std::memcmp(data.data(), KEYSTATS_MAGIC, 4) != 0 ||
+        (static_cast<unsigned char>(data[4]) | (static_cast<unsigned char>(data[5]) << 8)) != FILE_VERSION) {
+        return false;
+    }
+
+    for (const bool apply : {false, true}) {
+        size_t offset = HEADER_SIZE;
+        if (!readTable(data, offset, apply, keyHits, keyErrors, keyLatency) ||
+            !readTable(data, offset, apply, bigramHits, bigramErrors, bigramLatency) ||
+            offset != data.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool KeyStats::deserialize(const std::string& data) {
+    KeyStats parsed;
+    if (!parsed.accumulate(data)) {
+        return false;
+    }
+    *this = std::move(parsed);
+    return true;
+}
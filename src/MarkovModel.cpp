@@ -0,0 +1,227 @@
+/**
+ * @file MarkovModel.cpp
+ * @brief Implementasi MarkovModel (CSR bigram/trigram + Walker alias table)
+ * @author Alea Farrel & Team
+ * @date 2025
+ *
+ * @section build Pembangunan Model
+ * 1. Intern kata: setiap kata unik mendapat ID, karakternya disalin sekali
+ *    ke arena
+ * 2. Hitung frekuensi bigram (termasuk BOS -> kata pertama dan
+ *    kata terakhir -> END), lalu susun CSR per kata
+ * 3. Hitung frekuensi trigram per edge bigram; entry-nya langsung berisi
+ *    index edge tujuan
+ * 4. Setiap baris diubah menjadi alias table (metode Vose)
+ *
+ * @section sampling Pengambilan Sampel
+ * Satu kata = satu lookup alias table: dua angka random, satu perbandingan,
+ * tanpa pencarian maupun alokasi (selain vector hasil).
+ */
+
+#include "MarkovModel.h"
+#include <algorithm>
+#include <unordered_map>
+
+// ============================================================================
+// ALIAS TABLE
+// ============================================================================
+
+/**
+ * @brief Menambahkan satu baris alias table dari bobot integer
+ *
+ * Menggunakan metode Vose dengan aritmetika integer: bobot setiap kolom
+ * diskalakan menjadi `w * n` dengan target `total`, sehingga kolom yang
+ * kekurangan diisi dari kolom yang kelebihan tanpa error pembulatan
+ * floating point. Threshold akhirnya dikonversi ke skala 2^32.
+ *
+ * @param weighted Pasangan (value, bobot); bobot harus > 0
+ */
+void MarkovModel::AliasRows::appendRow(const std::vector<std::pair<uint32_t, uint32_t>>& weighted) {
+    if (offsets.empty()) {
+        offsets.push_back(0);
+    }
+
+    const uint32_t base = static_cast<uint32_t>(values.size());
+    const uint32_t n = static_cast<uint32_t>(weighted.size());
+
+    uint64_t total = 0;
+    std::vector<uint64_t> scaled(n);
+    for (uint32_t i = 0; i < n; ++i) {
+        total += weighted[i].second;
+        scaled[i] = static_cast<uint64_t>(weighted[i].second) * n;
+    }
+
+    std::vector<uint32_t> small, large;
+    for (uint32_t i = 0; i < n; ++i) {
+        values.push_back(weighted[i].first);
+        threshold.push_back(UINT32_MAX);
+        alias.push_back(i);
+        (scaled[i] < total ? small : large).push_back(i);
+    }
+
+    while (!small.empty() && !large.empty()) {
+        const uint32_t s = small.back();
+        small.pop_back();
+        const uint32_t l = large.back();
+
+        // Kolom s: ambil s dengan peluang scaled[s] / total, sisanya l.
+        // Pembilang dan penyebut digeser sampai penyebut < 2^32 supaya
+        // (num << 32) tidak overflow saat jumlah count melewati 2^32
+        uint64_t num = scaled[s];
+        uint64_t den = total;
+        while (den >> 32) {
+            num >>= 1;
+            den >>= 1;
+        }
+        threshold[base + s] = static_cast<uint32_t>(std::min<uint64_t>((num << 32) / den, UINT32_MAX));
+        alias[base + s] = l;
+
+        scaled[l] -= total - scaled[s];
+        if (scaled[l] < total) {
+            large.pop_back();
+            small.push_back(l);
+        }
+    }
+    // Sisa kolom (kedua stack) bernilai tepat 1: selalu ambil kolom sendiri
+
+    offsets.push_back(static_cast<uint32_t>(values.size()));
+}
+
+uint32_t MarkovModel::AliasRows::sample(uint32_t row, std::mt19937& rng) const {
+    const uint32_t begin = offsets[row];
+    const uint32_t n = offsets[row + 1] - begin;
+    if (n == 1) {
+        return begin;
+    }
+
+    // Multiply-shift: kolom seragam tanpa operasi modulo
+    const uint32_t column = static_cast<uint32_t>((static_cast<uint64_t>(rng()) * n) >> 32);
+    const uint32_t coin = static_cast<uint32_t>(rng());
+    return begin + (coin < threshold[begin + column] ? column : alias[begin + column]);
+}
+
+// ============================================================================
+// BUILD
+// ============================================================================
+
+void MarkovModel::build(const std::vector<std::vector<std::string>>& sentences) {
+    *this = MarkovModel();
+
+    // Intern kata; ID 0 = BOS (kata kosong)
+    std::unordered_map<std::string, uint32_t> ids;
+    wordOffsets.push_back(0);
+    wordLengths.push_back(0);
+
+    std::vector<std::vector<uint32_t>> encoded;
+    encoded.reserve(sentences.size());
+    for (const auto& sentence : sentences) {
+        if (sentence.empty()) continue;
+
+        // Padding: BOS di awal, END di akhir
+        std::vector<uint32_t> tokens;
+        tokens.reserve(sentence.size() + 2);
+        tokens.push_back(BOS_WORD);
+        for (const auto& w : sentence) {
+            auto [it, inserted] = ids.emplace(w, static_cast<uint32_t>(wordOffsets.size()));
+            if (inserted) {
+                wordOffsets.push_back(static_cast<uint32_t>(arena.size()));
+                wordLengths.push_back(static_cast<uint16_t>(std::min<size_t>(w.size(), UINT16_MAX)));
+                arena.append(w, 0, wordLengths.back());
+            }
+            tokens.push_back(it->second);
+        }
+        tokens.push_back(END_WORD);
+        encoded.push_back(std::move(tokens));
+    }
+
+    if (encoded.empty()) {
+        *this = MarkovModel();
+        return;
+    }
+
+    const uint32_t vocabulary = static_cast<uint32_t>(wordOffsets.size());
+    auto pairKey = [](uint32_t a, uint32_t b) {
+        return (static_cast<uint64_t>(a) << 32) | b;
+    };
+
+    // Urutkan entry per baris agar layout deterministik
+    auto sortedRow = [](const std::unordered_map<uint32_t, uint32_t>& counts) {
+        std::vector<std::pair<uint32_t, uint32_t>> row(counts.begin(), counts.end());
+        std::sort(row.begin(), row.end());
+        return row;
+    };
+
+    // --- Bigram ---
+    std::vector<std::unordered_map<uint32_t, uint32_t>> bigramCounts(vocabulary);
+    for (const auto& tokens : encoded) {
+        for (size_t i = 0; i + 1 < tokens.size(); ++i) {
+            ++bigramCounts[tokens[i]][tokens[i + 1]];
+        }
+    }
+
+    std::unordered_map<uint64_t, uint32_t> edgeIndex;  // (a, b) -> index edge
+    for (uint32_t a = 0; a < vocabulary; ++a) {
+        const auto row = sortedRow(bigramCounts[a]);
+        const uint32_t base = static_cast<uint32_t>(bigrams.values.size());
+        for (uint32_t k = 0; k < row.size(); ++k) {
+            edgeIndex.emplace(pairKey(a, row[k].first), base + k);
+        }
+        bigrams.appendRow(row);
+    }
+    bigramCounts.clear();
+
+    // --- Trigram (per edge bigram) ---
+    const uint32_t edges = static_cast<uint32_t>(bigrams.values.size());
+    std::vector<std::unordered_map<uint32_t, uint32_t>> trigramCounts(edges);
+    for (const auto& tokens : encoded) {
+        for (size_t i = 0; i + 2 < tokens.size(); ++i) {
+            const uint32_t context = edgeIndex.at(pairKey(tokens[i], tokens[i + 1]));
+            const uint32_t next = edgeIndex.at(pairKey(tokens[i + 1], tokens[i + 2]));
+            ++trigramCounts[context][next];
+        }
+    }
+
+    for (uint32_t e = 0; e < edges; ++e) {
+        trigrams.appendRow(sortedRow(trigramCounts[e]));
+    }
+}
+
+// ============================================================================
+// GENERATION
+// ============================================================================
+
+/**
+ * @brief Menjalankan rantai sebanyak count kata
+ *
+ * State adalah index edge terakhir (a -> b, b = kata terakhir yang
+ * dikeluarkan). Langkah berikutnya diambil dari baris trigram edge tersebut,
+ * atau dari baris bigram b (backoff acak, atau jika konteks belum pernah
+ * diikuti kata lain). Edge menuju END memulai kalimat baru dari BOS.
+ */
+std::vector<std::string_view> MarkovModel::generate(int count, std::mt19937& rng,
+                                                    uint32_t& state) const {
+    std::vector<std::string_view> result;
+    if (empty() || count <= 0) {
+        return result;
+    }
+    result.reserve(static_cast<size_t>(count));
+
+    uint32_t edge = state < bigrams.values.size() ? state : NO_STATE;
+    while (result.size() < static_cast<size_t>(count)) {
+        if (edge == NO_STATE || bigrams.values[edge] == END_WORD) {
+            edge = bigrams.sample(BOS_WORD, rng);
+        } else if (!trigrams.rowEmpty(edge) && rng() >= BIGRAM_BACKOFF) {
+            edge = trigrams.values[trigrams.sample(edge, rng)];
+        } else {
+            edge = bigrams.sample(bigrams.values[edge], rng);
+        }
+
+        const uint32_t next = bigrams.values[edge];
+        if (next != END_WORD) {
+            result.push_back(word(next));
+        }
+    }
+
+    state = edge;
+    return result;
+}
@@ -1,7 +1,12 @@
 #include "NetworkManager.h"
 #include "GameBackend.h"
+#include "PerfMonitor.h"
 #include <QDateTime>
 #include <QHostAddress>
+#include <QNetworkDatagram>
+#include <QNetworkInformation>
+#include <QRandomGenerator>
+#include <QtEndian>
 #include <algorithm>
 
 NetworkManager* NetworkManager::s_instance = nullptr;
@@ -20,11 +25,39 @@ NetworkManager* NetworkManager::create(QQmlEngine* engine, QJSEngine* scriptEngi
 }
 
 NetworkManager::NetworkManager(QObject* parent)
+    : NetworkManager(TCP_PORT, true, parent)
+{
+}
+
+NetworkManager::NetworkManager(quint16 tcpPort, bool discovery, QObject* parent)
     : QObject(parent)
     , m_playerId(QUuid::createUuid().toString(QUuid::WithoutBraces))
+    , m_tcpPort(tcpPort)
+    , m_discoveryEnabled(discovery)
 {
+    // Monotonic clock for time sync, anchored to wall time once
+    m_clock.start();
+    m_clockEpochUs = QDateTime::currentMSecsSinceEpoch() * 1000;
+    
+    // Dispatch timings are keyed by PacketType; give the overlay its names
+    PerfMonitor::instance()->setPacketTypes(QMetaEnum::fromType<PacketType>());
+
     // Setup discovery socket
-    setupDiscoverySocket();
+    if (m_discoveryEnabled) {
+        setupDiscoverySocket();
+    }
+    
+    // Re-resolve the broadcast target when the network changes
+    if (QNetworkInformation::loadDefaultBackend()) {
+        connect(QNetworkInformation::instance(), &QNetworkInformation::reachabilityChanged,
+                this, &NetworkManager::resolveBroadcastAddress);
+    }
+    
+    // Players model: progress packets stage single rows, everything else
+    // that changes the roster or host re-syncs through playersChanged
+    m_playersModel = new PlayersModel(this);
+    connect(this, &NetworkManager::playersChanged, this, &NetworkManager::syncPlayersModel);
+    connect(this, &NetworkManager::authorityChanged, this, &NetworkManager::syncPlayersModel);
     
     // Cleanup timer for stale rooms
     m_cleanupTimer = new QTimer(this);
@@ -34,8 +67,9 @@ NetworkManager::NetworkManager(QObject* parent)
     m_announceTimer = new QTimer(this);
     connect(m_announceTimer, &QTimer::timeout, this, &NetworkManager::sendAnnounce);
     
-    // Progress update timer (50ms for real-time fairness)
+    // Progress send timer (rearmed per send; see scheduleProgressSend)
     m_progressTimer = new QTimer(this);
+    m_progressTimer->setSingleShot(true);
     connect(m_progressTimer, &QTimer::timeout, this, &NetworkManager::sendProgressUpdate);
     
     // Connection timeout timer (5 seconds)
@@ -59,6 +93,17 @@ NetworkManager::NetworkManager(QObject* parent)
     m_readyCheckTimer->setSingleShot(true);
     connect(m_readyCheckTimer, &QTimer::timeout, this, &NetworkManager::onReadyCheckTimeout);
     
+    // Clock sync timeout: answer the ready check with whatever samples we have
+    m_timeSyncTimer = new QTimer(this);
+    m_timeSyncTimer->setSingleShot(true);
+    connect(m_timeSyncTimer, &QTimer::timeout, this, &NetworkManager::finishTimeSync);
+    
+    // Synchronized race start (scheduled from COUNTDOWN)
+    m_raceStartTimer = new QTimer(this);
+    m_raceStartTimer->setSingleShot(true);
+    m_raceStartTimer->setTimerType(Qt::PreciseTimer);
+    connect(m_raceStartTimer, &QTimer::timeout, this, &NetworkManager::startLocalRace);
+    
     qDebug() << "[NetworkManager] Initialized with UUID:" << m_playerId;
 }
 
@@ -70,27 +115,281 @@ NetworkManager::~NetworkManager() {
 // PACKET SERIALIZATION
 // ============================================================================
 
+namespace {
+
+// Binary body layout (all multi-byte fields little-endian):
+//   [0]     0x80 | WIRE_VERSION
+//   [1]     PacketType
+//   [2]     sender room index
+//   [3..]   timestamp, unsigned LEB128 varint (ms since epoch)
+//   [...]   payload: fixed struct for PROGRESS_UPDATE / FINISH / STATE_SNAPSHOT,
+//           otherwise compact JSON (or nothing for an empty payload)
+// Fixed structs may be followed by optional trailing fields; decoders
+// ignore bytes they do not know.
+constexpr quint8 BINARY_MARKER = 0x80;
+
+// PROGRESS_UPDATE payload (7 bytes)
+struct ProgressWire {
+    static constexpr int SIZE = 7;
+    quint16 position;
+    quint16 total;
+    quint16 wpm;
+    quint8 flags;  // bit 0: finished
+};
+
+// STATE_SNAPSHOT entry (9 bytes), preceded by a 1-byte entry count
+struct SnapshotEntryWire {
+    static constexpr int SIZE = 9;
+    quint8 index;
+    quint16 position;
+    quint16 total;
+    quint16 wpm;
+    quint8 flags;  // bit 0: finished
+    quint8 rank;   // Finish position (0 = not finished)
+};
+
+// FINISH payload (9 bytes), optionally followed by finishAt as a zigzag
+// varint relative to the packet timestamp
+struct FinishWire {
+    static constexpr int SIZE = 9;
+    quint16 wpm;
+    quint16 accuracy;  // Hundredths of a percent (0 - 10000)
+    quint16 errors;
+    quint16 duration;
+    quint8 position;
+};
+
+quint16 clampU16(double value) {
+    return static_cast<quint16>(qBound(0.0, value, 65535.0));
+}
+
+void putU16(QByteArray& out, quint16 value) {
+    out.append(static_cast<char>(value & 0xFF));
+    out.append(static_cast<char>(value >> 8));
+}
+
+quint16 getU16(const char* p) {
+    return static_cast<quint16>(static_cast<quint8>(p[0]) |
+                                (static_cast<quint8>(p[1]) << 8));
+}
+
+void putU32(QByteArray& out, quint32 value) {
+    putU16(out, static_cast<quint16>(value & 0xFFFF));
+    putU16(out, static_cast<quint16>(value >> 16));
+}
+
+quint32 getU32(const char* p) {
+    return static_cast<quint32>(getU16(p)) | (static_cast<quint32>(getU16(p + 2)) << 16);
+}
+
+quint64 zigzag(qint64 value) {
+    return (static_cast<quint64>(value) << 1) ^ static_cast<quint64>(value >> 63);
+}
+
+qint64 unzigzag(quint64 value) {
+    return static_cast<qint64>(value >> 1) ^ -static_cast<qint64>(value & 1);
+}
+
+void putVarint(QByteArray& out, quint64 value) {
+    while (value >= 0x80) {
+        out.append(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.append(static_cast<char>(value));
+}
+
+bool getVarint(const char*& p, const char* end, quint64& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        const quint8 byte = static_cast<quint8>(*p++);
+        value |= static_cast<quint64>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+QByteArray frame(const QByteArray& body) {
+    // Prepend length for framing
+    QByteArray result;
+    result.reserve(4 + body.size());
+    QDataStream stream(&result, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << static_cast<quint32>(body.size());
+    result.append(body);
+    return result;
+}
+
+} // namespace
+
 QByteArray NetworkManager::Packet::serialize() const {
+    return frame(jsonBody());
+}
+
+QByteArray NetworkManager::Packet::serializeBinary(quint8 index) const {
+    return frame(binaryBody(index));
+}
+
+QByteArray NetworkManager::Packet::jsonBody() const {
     QJsonObject obj;
     obj["type"] = static_cast<int>(type);
     obj["sender"] = senderUuid;
     obj["ts"] = timestamp;
     obj["payload"] = payload;
     
-    QByteArray json = QJsonDocument(obj).toJson(QJsonDocument::Compact);
-    
-    // Prepend length for framing
-    QByteArray result;
-    QDataStream stream(&result, QIODevice::WriteOnly);
-    stream.setVersion(QDataStream::Qt_6_0);
-    stream << static_cast<quint32>(json.size());
-    result.append(json);
+    return QJsonDocument(obj).toJson(QJsonDocument::Compact);
+}
+
+QByteArray NetworkManager::Packet::binaryBody(quint8 index) const {
+    QByteArray body;
+    body.reserve(16);
+    body.append(static_cast<char>(BINARY_MARKER | WIRE_VERSION));
+    body.append(static_cast<char>(type));
+    body.append(static_cast<char>(index));
+    putVarint(body, static_cast<quint64>(qMax<qint64>(0, timestamp)));
+    
+    switch (type) {
+        case PacketType::PROGRESS_UPDATE: {
+            ProgressWire wire;
+            wire.position = clampU16(payload["position"].toInt());
+            wire.total = clampU16(payload["total"].toInt());  // 0 = unchanged
+            wire.wpm = clampU16(payload["wpm"].toInt());
+            wire.flags = payload["finished"].toBool() ? 1 : 0;
+            putU16(body, wire.position);
+            putU16(body, wire.total);
+            putU16(body, wire.wpm);
+            body.append(static_cast<char>(wire.flags));
+            break;
+        }
+        case PacketType::FINISH: {
+            FinishWire wire;
+            wire.wpm = clampU16(payload["wpm"].toInt());
+            wire.accuracy = clampU16(qRound(payload["accuracy"].toDouble(100.0) * 100.0));
+            wire.errors = clampU16(payload["errors"].toInt());
+            wire.duration = clampU16(payload["duration"].toInt());
+            wire.position = static_cast<quint8>(qBound(0, payload["position"].toInt(), 255));
+            putU16(body, wire.wpm);
+            putU16(body, wire.accuracy);
+            putU16(body, wire.errors);
+            putU16(body, wire.duration);
+            body.append(static_cast<char>(wire.position));
+            if (payload.contains("finishAt")) {
+                const qint64 finishAt = payload["finishAt"].toVariant().toLongLong();
+                putVarint(body, zigzag(finishAt - timestamp));
+            }
+            break;
+        }
+        case PacketType::STATE_SNAPSHOT: {
+            const QJsonArray players = payload["players"].toArray();
+            QByteArray entries;
+            int count = 0;
+            for (const auto& value : players) {
+                const QJsonObject obj = value.toObject();
+                SnapshotEntryWire wire;
+                wire.index = static_cast<quint8>(obj["index"].toInt(NO_INDEX));
+                if (wire.index == NO_INDEX || count == 255) continue;
+                wire.position = clampU16(obj["position"].toInt());
+                wire.total = clampU16(obj["total"].toInt());
+                wire.wpm = clampU16(obj["wpm"].toInt());
+                wire.flags = obj["finished"].toBool() ? 1 : 0;
+                wire.rank = static_cast<quint8>(qBound(0, obj["rank"].toInt(), 255));
+                entries.append(static_cast<char>(wire.index));
+                putU16(entries, wire.position);
+                putU16(entries, wire.total);
+                putU16(entries, wire.wpm);
+                entries.append(static_cast<char>(wire.flags));
+                entries.append(static_cast<char>(wire.rank));
+                ++count;
+            }
+            body.append(static_cast<char>(count));
+            body.append(entries);
+            break;
+        }
+        default:
+            if (!payload.isEmpty()) {
+                body.append(QJsonDocument(payload).toJson(QJsonDocument::Compact));
+            }
+            break;
+    }
     
-    return result;
+    return body;
 }
 
 NetworkManager::Packet NetworkManager::Packet::deserialize(const QByteArray& data) {
     Packet packet;
+    if (data.isEmpty()) return packet;
+    
+    const quint8 marker = static_cast<quint8>(data.at(0));
+    if (marker & BINARY_MARKER) {
+        // Binary body
+        if ((marker & 0x7F) > WIRE_VERSION || data.size() < 4) return packet;
+        
+        const char* p = data.constData();
+        const char* end = p + data.size();
+        packet.type = static_cast<PacketType>(static_cast<quint8>(p[1]));
+        packet.senderIndex = static_cast<quint8>(p[2]);
+        p += 3;
+        
+        quint64 ts = 0;
+        if (!getVarint(p, end, ts)) return packet;
+        packet.timestamp = static_cast<qint64>(ts);
+        
+        switch (packet.type) {
+            case PacketType::PROGRESS_UPDATE: {
+                if (end - p < ProgressWire::SIZE) return packet;
+                packet.payload["position"] = getU16(p);
+                if (const quint16 total = getU16(p + 2)) {
+                    packet.payload["total"] = total;
+                }
+                packet.payload["wpm"] = getU16(p + 4);
+                packet.payload["finished"] = (static_cast<quint8>(p[6]) & 1) != 0;
+                break;
+            }
+            case PacketType::FINISH: {
+                if (end - p < FinishWire::SIZE) return packet;
+                packet.payload["wpm"] = getU16(p);
+                packet.payload["accuracy"] = getU16(p + 2) / 100.0;
+                packet.payload["errors"] = getU16(p + 4);
+                packet.payload["duration"] = getU16(p + 6);
+                packet.payload["position"] = static_cast<quint8>(p[8]);
+                p += FinishWire::SIZE;
+                quint64 delta = 0;
+                if (p < end && getVarint(p, end, delta)) {
+                    packet.payload["finishAt"] = packet.timestamp + unzigzag(delta);
+                }
+                break;
+            }
+            case PacketType::STATE_SNAPSHOT: {
+                if (p >= end) return packet;
+                const int count = static_cast<quint8>(*p++);
+                if (end - p < count * SnapshotEntryWire::SIZE) return packet;
+                QJsonArray players;
+                for (int i = 0; i < count; ++i, p += SnapshotEntryWire::SIZE) {
+                    QJsonObject obj;
+                    obj["index"] = static_cast<quint8>(p[0]);
+                    obj["position"] = getU16(p + 1);
+                    obj["total"] = getU16(p + 3);
+                    obj["wpm"] = getU16(p + 5);
+                    obj["finished"] = (static_cast<quint8>(p[7]) & 1) != 0;
+                    obj["rank"] = static_cast<quint8>(p[8]);
+                    players.append(obj);
+                }
+                packet.payload["players"] = players;
+                break;
+            }
+            default:
+                if (p < end) {
+                    QJsonDocument doc = QJsonDocument::fromJson(QByteArray(p, end - p));
+                    if (!doc.isObject()) return packet;
+                    packet.payload = doc.object();
+                }
+                break;
+        }
+        
+        packet.valid = true;
+        return packet;
+    }
+    
+    // JSON body
     QJsonDocument doc = QJsonDocument::fromJson(data);
     if (!doc.isObject()) return packet;
     
@@ -99,6 +398,7 @@ NetworkManager::Packet NetworkManager::Packet::deserialize(const QByteArray& dat
     packet.senderUuid = obj["sender"].toString();
     packet.timestamp = obj["ts"].toVariant().toLongLong();
     packet.payload = obj["payload"].toObject();
+    packet.valid = true;
     
     return packet;
 }
@@ -109,6 +409,7 @@ NetworkManager::Packet NetworkManager::createPacket(PacketType type, const QJson
     packet.senderUuid = m_playerId;
     packet.timestamp = QDateTime::currentMSecsSinceEpoch();
     packet.payload = payload;
+    packet.valid = true;
     return packet;
 }
 
@@ -281,6 +582,7 @@ void NetworkManager::refreshRooms() {
 }
 
 void NetworkManager::startAnnouncing() {
+    if (!m_discoverySocket) return;
     sendAnnounce();
     m_announceTimer->start(ANNOUNCE_INTERVAL_MS);
 }
@@ -290,40 +592,63 @@ void NetworkManager::stopAnnouncing() {
 }
 
 void NetworkManager::sendAnnounce() {
-    if (!m_isInLobby) return;
-    
-    QJsonObject msg;
-    msg["app"] = APP_IDENTIFIER;
-    msg["type"] = "DISCOVERY";
-    msg["uuid"] = m_playerId;
-    msg["name"] = m_playerName;
-    msg["port"] = m_tcpServer ? m_tcpServer->serverPort() : TCP_PORT;
-    msg["playerCount"] = m_players.size();
-    msg["status"] = m_isInGame ? "racing" : "waiting";
-    
-    QByteArray data = QJsonDocument(msg).toJson(QJsonDocument::Compact);
-    
-    // If a specific interface is selected, broadcast only on that interface
-    if (!m_selectedInterface.isEmpty()) {
-        // Find the broadcast address for the selected interface
-        const auto interfaces = QNetworkInterface::allInterfaces();
-        for (const auto& iface : interfaces) {
-            const auto entries = iface.addressEntries();
-            for (const auto& entry : entries) {
-                if (entry.ip().toString() == m_selectedInterface) {
-                    QHostAddress broadcast = entry.broadcast();
-                    if (!broadcast.isNull()) {
-                        m_discoverySocket->writeDatagram(data, broadcast, DISCOVERY_PORT);
-                        qDebug() << "[NetworkManager] Broadcasting on" << m_selectedInterface << "to" << broadcast.toString();
-                        return;
-                    }
-                }
-            }
+    if (!m_isInLobby || !m_discoverySocket) return;
+    
+    // Rebuild the datagram only when an advertised field changed
+    AnnounceCache& cache = m_announceCache;
+    const quint16 port = m_tcpServer ? m_tcpServer->serverPort() : TCP_PORT;
+    if (cache.datagram.isEmpty() || cache.name != m_playerName ||
+        cache.playerCount != m_players.size() || cache.maxPlayers != maxPlayers() ||
+        cache.racing != m_isInGame || cache.port != port) {
+        cache.name = m_playerName;
+        cache.playerCount = m_players.size();
+        cache.maxPlayers = maxPlayers();
+        cache.racing = m_isInGame;
+        cache.port = port;
+        
+        QJsonObject msg;
+        msg["app"] = APP_IDENTIFIER;
+        msg["type"] = "DISCOVERY";
+        msg["uuid"] = m_playerId;
+        msg["name"] = cache.name;
+        msg["port"] = cache.port;
+        msg["playerCount"] = cache.playerCount;
+        msg["maxPlayers"] = cache.maxPlayers;
+        msg["status"] = cache.racing ? "racing" : "waiting";
+        cache.datagram = QJsonDocument(msg).toJson(QJsonDocument::Compact);
+    }
+    
+    // Broadcast only on the selected interface, resolved in setSelectedInterface
+    if (!m_broadcastAddress.isNull()) {
+        if (m_discoverySocket->writeDatagram(cache.datagram, m_broadcastAddress, DISCOVERY_PORT) >= 0) {
+            return;
         }
+        resolveBroadcastAddress();  // Interface went away; try again next time
     }
     
     // Fallback: broadcast on all interfaces
-    m_discoverySocket->writeDatagram(data, QHostAddress::Broadcast, DISCOVERY_PORT);
+    m_discoverySocket->writeDatagram(cache.datagram, QHostAddress::Broadcast, DISCOVERY_PORT);
+}
+
+void NetworkManager::resolveBroadcastAddress() {
+    m_broadcastAddress.clear();
+    if (m_selectedInterface.isEmpty()) return;
+    
+    // Find the broadcast address for the selected interface
+    const auto interfaces = QNetworkInterface::allInterfaces();
+    for (const auto& iface : interfaces) {
+        const auto entries = iface.addressEntries();
+        for (const auto& entry : entries) {
+            if (entry.ip().toString() == m_selectedInterface && !entry.broadcast().isNull()) {
+                m_broadcastAddress = entry.broadcast();
+                qDebug() << "[NetworkManager] Broadcasting on" << m_selectedInterface
+                         << "to" << m_broadcastAddress.toString();
+                return;
+            }
+        }
+    }
+    qDebug() << "[NetworkManager] No broadcast address for" << m_selectedInterface
+             << "- using all interfaces";
 }
 
 void NetworkManager::processDiscoveryDatagram() {
@@ -334,6 +659,12 @@ void NetworkManager::processDiscoveryDatagram() {
         quint16 senderPort;
         m_discoverySocket->readDatagram(data.data(), data.size(), &sender, &senderPort);
         
+        // Compact JSON sorts keys, so ours always start with the app identifier:
+        // reject foreign traffic (and our own echo) without parsing it
+        static const QByteArray prefix =
+            QByteArray("{\"app\":\"") + APP_IDENTIFIER + '"';
+        if (!data.startsWith(prefix) || data == m_announceCache.datagram) continue;
+        
         QJsonDocument doc = QJsonDocument::fromJson(data);
         if (!doc.isObject()) continue;
         
@@ -358,6 +689,7 @@ void NetworkManager::processDiscoveryDatagram() {
         room.hostUuid = uuid;
         room.port = msg["port"].toInt();
         room.playerCount = msg["playerCount"].toInt();
+        room.maxPlayers = msg["maxPlayers"].toInt(MAX_MESH_PLAYERS);
         room.status = msg["status"].toString();
         room.lastSeen = QDateTime::currentMSecsSinceEpoch();
         
@@ -403,13 +735,110 @@ QVariantList NetworkManager::discoveredRooms() const {
         map["hostUuid"] = room.hostUuid;
         map["port"] = room.port;
         map["playerCount"] = room.playerCount;
-        map["maxPlayers"] = MAX_PLAYERS;
+        map["maxPlayers"] = room.maxPlayers;
         map["status"] = room.status;
         list.append(map);
     }
     return list;
 }
 
+// ============================================================================
+// UDP DATA CHANNEL
+// ============================================================================
+
+void NetworkManager::openDataChannel() {
+    if (m_dataSocket) return;
+    
+    m_dataSocket = new QUdpSocket(this);
+    if (!m_dataSocket->bind(QHostAddress::AnyIPv4, 0)) {
+        qWarning() << "[NetworkManager] Failed to bind data channel, progress stays on TCP:"
+                   << m_dataSocket->errorString();
+        delete m_dataSocket;
+        m_dataSocket = nullptr;
+        return;
+    }
+    connect(m_dataSocket, &QUdpSocket::readyRead, this, &NetworkManager::processDataDatagrams);
+    m_udpSendSeq = 0;
+    
+    qDebug() << "[NetworkManager] Data channel open on UDP port" << m_dataSocket->localPort();
+}
+
+void NetworkManager::closeDataChannel() {
+    if (!m_dataSocket) return;
+    
+    m_dataSocket->close();
+    m_dataSocket->deleteLater();
+    m_dataSocket = nullptr;
+}
+
+void NetworkManager::processDataDatagrams() {
+    while (m_dataSocket && m_dataSocket->hasPendingDatagrams()) {
+        const QNetworkDatagram datagram = m_dataSocket->receiveDatagram();
+        const QByteArray data = datagram.data();
+        if (data.size() < 6 || static_cast<quint8>(data.at(0)) != DATAGRAM_MAGIC) continue;
+        
+        const quint32 seq = getU32(data.constData() + 1);
+        Packet packet = Packet::deserialize(QByteArray::fromRawData(data.constData() + 5, data.size() - 5));
+        if (!packet.valid) continue;
+        
+        // Only superseded state travels over UDP; control packets must use TCP
+        if (packet.type != PacketType::PROGRESS_UPDATE &&
+            packet.type != PacketType::STATE_SNAPSHOT) {
+            continue;
+        }
+        
+        if (packet.senderUuid.isEmpty()) {
+            packet.senderUuid = m_indexToUuid.value(packet.senderIndex);
+        }
+        PeerConnection* peer = m_peers.value(packet.senderUuid, nullptr);
+        if (!peer || !peer->handshakeComplete) continue;
+        
+        // Accept datagrams only from the address of the handshaken peer
+        QString senderIp = datagram.senderAddress().toString();
+        if (senderIp.startsWith("::ffff:")) {
+            senderIp = senderIp.mid(7);
+        }
+        if (senderIp != peer->ip) continue;
+        
+        // Drop reordered or duplicated datagrams (wrap-around safe)
+        if (peer->hasUdpSeq && static_cast<qint32>(seq - peer->lastUdpSeq) <= 0) continue;
+        peer->lastUdpSeq = seq;
+        peer->hasUdpSeq = true;
+        
+        processPacket(peer, packet);
+    }
+}
+
+void NetworkManager::broadcastUnreliable(const Packet& packet, const Packet* binaryPacket) {
+    const quint32 seq = ++m_udpSendSeq;
+    const Packet& forBinary = binaryPacket ? *binaryPacket : packet;
+    
+    // Encode at most once per wire format
+    QByteArray jsonDatagram;
+    QByteArray binaryDatagram;
+    for (auto it = m_peers.begin(); it != m_peers.end(); ++it) {
+        PeerConnection* peer = it.value();
+        if (!peer->handshakeComplete) continue;
+        
+        const bool binary = usesBinaryWire(peer, packet);
+        if (!m_dataSocket || peer->udpPort == 0) {
+            sendToPeer(peer, binary ? forBinary : packet);  // Peer has no data channel
+            continue;
+        }
+        
+        QByteArray& datagram = binary ? binaryDatagram : jsonDatagram;
+        if (datagram.isEmpty()) {
+            datagram.append(static_cast<char>(DATAGRAM_MAGIC));
+            putU32(datagram, seq);
+            datagram.append(binary ? forBinary.binaryBody(m_localIndex) : packet.jsonBody());
+        }
+        if (m_dataSocket->writeDatagram(datagram, peer->udpAddress, peer->udpPort) >= 0) {
+            peer->datagramBytesSent += datagram.size();
+            ++peer->datagramsSent;
+        }
+    }
+}
+
 // ============================================================================
 // TCP SERVER (MESH)
 // ============================================================================
@@ -420,7 +849,7 @@ void NetworkManager::startTcpServer() {
     m_tcpServer = new QTcpServer(this);
     connect(m_tcpServer, &QTcpServer::newConnection, this, &NetworkManager::onNewTcpConnection);
     
-    if (!m_tcpServer->listen(QHostAddress::Any, TCP_PORT)) {
+    if (!m_tcpServer->listen(QHostAddress::Any, m_tcpPort)) {
         qWarning() << "[NetworkManager] Failed to start TCP server:" << m_tcpServer->errorString();
         setConnectionError("Failed to start server: " + m_tcpServer->errorString());
         delete m_tcpServer;
@@ -431,6 +860,10 @@ void NetworkManager::startTcpServer() {
     qDebug() << "[NetworkManager] TCP Server started on port" << m_tcpServer->serverPort();
 }
 
+quint16 NetworkManager::serverPort() const {
+    return m_tcpServer ? m_tcpServer->serverPort() : 0;
+}
+
 void NetworkManager::stopTcpServer() {
     if (!m_tcpServer) return;
     
@@ -444,8 +877,9 @@ void NetworkManager::onNewTcpConnection() {
     while (m_tcpServer && m_tcpServer->hasPendingConnections()) {
         QTcpSocket* socket = m_tcpServer->nextPendingConnection();
         if (!socket) continue;
+        configureSocket(socket);
         
-        if (m_peers.size() >= MAX_PLAYERS - 1) {
+        if (m_peers.size() >= maxPlayers() - 1) {
             qDebug() << "[NetworkManager] Max players reached, rejecting connection";
             socket->close();
             socket->deleteLater();
@@ -464,6 +898,11 @@ void NetworkManager::onNewTcpConnection() {
         peer->port = socket->peerPort();
         peer->handshakeComplete = false;
         
+        // Host hands out room indices to new peers in its HELLO
+        if (m_isRoomCreator && m_nextPeerIndex < NO_INDEX) {
+            peer->assignedIndex = m_nextPeerIndex++;
+        }
+        
         // Connect signals
         connect(socket, &QTcpSocket::readyRead, this, &NetworkManager::onPeerReadyRead);
         connect(socket, &QTcpSocket::disconnected, this, &NetworkManager::onPeerDisconnected);
@@ -473,10 +912,10 @@ void NetworkManager::onNewTcpConnection() {
         QString tempKey = QString("pending_%1:%2").arg(peerIp).arg(socket->peerPort());
         
         // Store properties for lookup
-        socket->setProperty("peerPtr", QVariant::fromValue(static_cast<void*>(peer)));
         socket->setProperty("pendingKey", tempKey);
         
         m_peers[tempKey] = peer;
+        m_peerBySocket.insert(socket, peer);
         
         qDebug() << "[NetworkManager] Incoming connection from" << peerIp << "Socket:" << socket;
         qDebug() << "[NetworkManager] Added to m_peers with key:" << tempKey;
@@ -527,14 +966,14 @@ bool NetworkManager::connectToPeer(const QString& ip, int port, const QString& u
     connect(socket, &QTcpSocket::disconnected, this, &NetworkManager::onPeerDisconnected);
     connect(socket, &QTcpSocket::errorOccurred, this, &NetworkManager::onPeerError);
     
-    // Store socket in property for lookup in slots
-    socket->setProperty("peerPtr", QVariant::fromValue(static_cast<void*>(peer)));
+    // Store pending key in property for cleanup in slots
     socket->setProperty("pendingKey", key);
     
     // CRITICAL FIX: Add to m_peers immediately with pending key
     // This matches the behavior of onNewTcpConnection() for incoming connections
     // Without this, onPeerReadyRead() may fail to find the peer for outgoing connections
     m_peers[key] = peer;
+    m_peerBySocket.insert(socket, peer);
     
     qDebug() << "[NetworkManager] Connecting to peer at" << ip << ":" << port;
     qDebug() << "[NetworkManager] Added to m_peers with key:" << key;
@@ -547,11 +986,12 @@ void NetworkManager::onPeerConnected() {
     QTcpSocket* socket = qobject_cast<QTcpSocket*>(sender());
     if (!socket) return;
     
-    PeerConnection* peer = static_cast<PeerConnection*>(socket->property("peerPtr").value<void*>());
+    PeerConnection* peer = m_peerBySocket.value(socket, nullptr);
     if (!peer) return;
     
     QString key = socket->property("pendingKey").toString();
     m_pendingConnections.remove(key);
+    configureSocket(socket);
     
     qDebug() << "[NetworkManager] Connected to peer at" << peer->ip;
     
@@ -564,15 +1004,13 @@ void NetworkManager::onPeerDisconnected() {
     if (!socket) return;
     
     // Find the peer
+    PeerConnection* peer = m_peerBySocket.value(socket, nullptr);
     QString disconnectedUuid;
     QString disconnectedName;
     
-    for (auto it = m_peers.begin(); it != m_peers.end(); ++it) {
-        if (it.value()->socket == socket) {
-            disconnectedUuid = it.value()->uuid;
-            disconnectedName = it.value()->name;
-            break;
-        }
+    if (peer && peer->handshakeComplete && m_peers.value(peer->uuid) == peer) {
+        disconnectedUuid = peer->uuid;
+        disconnectedName = peer->name;
     }
     
     if (!disconnectedUuid.isEmpty()) {
@@ -583,6 +1021,14 @@ void NetworkManager::onPeerDisconnected() {
         m_players.remove(disconnectedUuid);
         emit playersChanged();
         
+        // Star mode: guests are not connected to each other, so relay the departure
+        if (m_starTopology && m_isRoomCreator) {
+            QJsonObject payload;
+            payload["uuid"] = disconnectedUuid;
+            payload["name"] = disconnectedName;
+            broadcastToAllPeers(createPacket(PacketType::PLAYER_LEFT, payload));
+        }
+        
         // Notify about player leaving
         if (!disconnectedName.isEmpty()) {
             emit playerLeft(disconnectedName);
@@ -599,8 +1045,9 @@ void NetworkManager::onPeerDisconnected() {
         m_pendingConnections.remove(pendingKey);
         
         // Remove from pending peers
+        m_peerBySocket.remove(socket);
         for (auto it = m_peers.begin(); it != m_peers.end(); ++it) {
-            if (it.value()->socket == socket) {
+            if (it.value() == peer) {
                 delete it.value();
                 m_peers.erase(it);
                 break;
@@ -626,53 +1073,70 @@ void NetworkManager::onPeerReadyRead() {
     if (!socket) return;
     
     // Find the peer
-    PeerConnection* peer = nullptr;
-    for (auto it = m_peers.begin(); it != m_peers.end(); ++it) {
-        if (it.value()->socket == socket) {
-            peer = it.value();
-            break;
-        }
-    }
-    
-    if (!peer) {
-        // Fallback for outgoing connections
-        peer = static_cast<PeerConnection*>(socket->property("peerPtr").value<void*>());
-    }
-    
+    PeerConnection* peer = m_peerBySocket.value(socket, nullptr);
     if (!peer) {
         qDebug() << "[NetworkManager] ERROR: onPeerReadyRead called for unknown socket:" << socket;
-        // Print all known sockets
-        for (auto it = m_peers.begin(); it != m_peers.end(); ++it) {
-            qDebug() << "  Known socket:" << it.value()->socket;
-        }
+        socket->readAll();  // Discard, nobody owns this data
         return;
     }
     
-    // Append to buffer
-    QByteArray newData = socket->readAll();
-    peer->readBuffer.append(newData);
-    // qDebug() << "[NetworkManager] Read" << newData.size() << "bytes from" << peer->name;
+    // Read straight into the tail of the buffer
+    QByteArray& buffer = peer->readBuffer;
+    const qint64 available = socket->bytesAvailable();
+    if (available > 0) {
+        const qsizetype oldSize = buffer.size();
+        buffer.resize(oldSize + available);
+        const qint64 got = socket->read(buffer.data() + oldSize, available);
+        buffer.resize(oldSize + qMax<qint64>(0, got));
+    }
     
-    // Process complete packets
-    while (peer->readBuffer.size() >= 4) {
-        // Read length prefix
-        QDataStream stream(peer->readBuffer.left(4));
-        stream.setVersion(QDataStream::Qt_6_0);
-        quint32 packetSize;
-        stream >> packetSize;
+    // Process complete packets from the read cursor; bodies are handed to
+    // deserialize() as views into the buffer, without copying
+    while (buffer.size() - peer->readOffset >= 4) {
+        const char* head = buffer.constData() + peer->readOffset;
+        const quint32 packetSize = qFromBigEndian<quint32>(head);
+        
+        if (packetSize > m_maxFrameBytes) {
+            // Corrupt or hostile length prefix: the stream cannot be resynchronized
+            qWarning() << "[NetworkManager] Frame of" << packetSize << "bytes from" << peer->ip
+                       << "exceeds limit of" << m_maxFrameBytes << "- dropping connection";
+            buffer.clear();
+            peer->readOffset = 0;
+            socket->abort();  // May delete the peer via onPeerDisconnected
+            return;
+        }
         
-        if (peer->readBuffer.size() < static_cast<int>(4 + packetSize)) {
+        if (buffer.size() - peer->readOffset < static_cast<qsizetype>(4 + packetSize)) {
             // Wait for more data
             break;
         }
         
-        // Extract packet data
-        QByteArray packetData = peer->readBuffer.mid(4, packetSize);
-        peer->readBuffer.remove(0, 4 + packetSize);
+        const QByteArray packetData = QByteArray::fromRawData(head + 4, packetSize);
+        peer->readOffset += 4 + packetSize;
         
         // Deserialize and process
         Packet packet = Packet::deserialize(packetData);
+        if (!packet.valid) {
+            qWarning() << "[NetworkManager] Dropping undecodable packet from" << peer->ip;
+            continue;
+        }
+        if (packet.senderUuid.isEmpty()) {
+            // Binary packet: resolve the room index back to a UUID
+            packet.senderUuid = m_indexToUuid.value(packet.senderIndex, peer->uuid);
+        }
         processPacket(peer, packet);
+        
+        // Handlers may remove or replace this peer (KICK, duplicate HELLO, leave)
+        if (m_peerBySocket.value(socket, nullptr) != peer) return;
+    }
+    
+    // Compact: free when fully consumed, shift only once the dead prefix dominates
+    if (peer->readOffset == buffer.size()) {
+        buffer.resize(0);
+        peer->readOffset = 0;
+    } else if (peer->readOffset >= READ_COMPACT_BYTES && peer->readOffset * 2 >= buffer.size()) {
+        buffer.remove(0, peer->readOffset);
+        peer->readOffset = 0;
     }
 }
 
@@ -680,6 +1144,11 @@ void NetworkManager::removePeer(const QString& uuid) {
     if (!m_peers.contains(uuid)) return;
     
     PeerConnection* peer = m_peers.take(uuid);
+    if (peer->index != NO_INDEX && m_indexToUuid.value(peer->index) == uuid) {
+        m_indexToUuid.remove(peer->index);
+    }
+    flushPeer(peer);  // e.g. a queued KICK must reach the peer before we close
+    m_peerBySocket.remove(peer->socket);
     if (peer->socket) {
         peer->socket->disconnect();
         peer->socket->close();
@@ -708,6 +1177,28 @@ void NetworkManager::sendHello(PeerConnection* peer) {
     payload["isRoomCreator"] = m_isRoomCreator;
     payload["hostUuid"] = m_hostUuid.isEmpty() ? m_playerId : m_hostUuid;
     
+    // Data channel for progress datagrams
+    if (m_dataSocket) {
+        payload["udpPort"] = m_dataSocket->localPort();
+    }
+    
+    // Only meaningful from the room creator; guests adopt it
+    payload["topology"] = m_starTopology ? "star" : "mesh";
+    
+    // Word banks we can regenerate seeded race text from
+    if (GameBackend* backend = GameBackend::existingInstance()) {
+        payload["banks"] = QJsonObject::fromVariantMap(backend->wordBankHashes());
+    }
+    
+    // Wire negotiation: advertise binary support and our room index
+    payload["wire"] = WIRE_VERSION;
+    if (m_localIndex != NO_INDEX) {
+        payload["index"] = m_localIndex;
+    }
+    if (peer->assignedIndex != NO_INDEX) {
+        payload["assignIndex"] = peer->assignedIndex;
+    }
+    
     Packet packet = createPacket(PacketType::HELLO, payload);
     sendToPeer(peer, packet);
 }
@@ -722,6 +1213,38 @@ void NetworkManager::handleHello(PeerConnection* peer, const Packet& packet) {
     bool peerIsRoomCreator = packet.payload["isRoomCreator"].toBool();
     QString peerHostUuid = packet.payload["hostUuid"].toString();
     
+    // Data channel (absent on clients that send progress over TCP)
+    peer->udpPort = static_cast<quint16>(packet.payload["udpPort"].toInt(0));
+    peer->udpAddress = QHostAddress(peer->ip);
+    
+    // Absent on clients without seeded text: they always get the full text
+    peer->bankHashes = packet.payload["banks"].toObject();
+    
+    // Wire negotiation (absent on clients that only speak JSON)
+    peer->wireVersion = qMin(packet.payload["wire"].toInt(0), static_cast<int>(WIRE_VERSION));
+    if (packet.payload.contains("index")) {
+        peer->index = static_cast<quint8>(packet.payload["index"].toInt(NO_INDEX));
+    } else if (peer->assignedIndex != NO_INDEX) {
+        peer->index = peer->assignedIndex;
+    }
+    if (peer->index != NO_INDEX) {
+        m_indexToUuid[peer->index] = peer->uuid;
+    }
+    // An index we already advertise (e.g. reconnecting to a migrated star
+    // host) wins over a fresh assignment: the host maps the one in our HELLO
+    if (peerIsRoomCreator && !m_isRoomCreator && m_localIndex == NO_INDEX &&
+        packet.payload.contains("assignIndex")) {
+        setLocalIndex(static_cast<quint8>(packet.payload["assignIndex"].toInt(NO_INDEX)));
+        qDebug() << "[NetworkManager] Assigned room index:" << m_localIndex;
+    }
+    if (peerIsRoomCreator && !m_isRoomCreator) {
+        bool star = packet.payload["topology"].toString() == "star";
+        if (m_starTopology != star) {
+            m_starTopology = star;
+            emit topologyChanged();
+        }
+    }
+    
     qDebug() << "[NetworkManager] Received HELLO from" << peer->name << "(" << peer->uuid << ")"
              << "isRoomCreator:" << peerIsRoomCreator << "hostUuid:" << peerHostUuid;
     
@@ -750,12 +1273,14 @@ void NetworkManager::handleHello(PeerConnection* peer, const Packet& packet) {
                 // We initiated, keep our connection, close theirs
                 qDebug() << "[NetworkManager] Duplicate connection detected, keeping ours";
                 PeerConnection* existing = m_peers[peer->uuid];
+                m_peerBySocket.remove(peer->socket);
                 delete peer;
                 peer = existing;
             } else {
                 // They initiated, close our connection, keep theirs
                 qDebug() << "[NetworkManager] Duplicate connection detected, keeping theirs";
                 PeerConnection* existing = m_peers[peer->uuid];
+                m_peerBySocket.remove(existing->socket);
                 existing->socket->disconnect();
                 existing->socket->close();
                 existing->socket->deleteLater();
@@ -787,22 +1312,28 @@ void NetworkManager::handleHello(PeerConnection* peer, const Packet& packet) {
     PlayerInfo playerInfo;
     playerInfo.uuid = peer->uuid;
     playerInfo.name = peer->name;
+    playerInfo.ip = peer->ip;
+    playerInfo.port = peer->port;
+    playerInfo.index = peer->index;
     m_players[peer->uuid] = playerInfo;
     
     emit playerJoined(peer->name);
     emit playersChanged();
     emit peersChanged();
     
-    // Send peer list to complete mesh
-    sendPeerList(peer);
+    if (m_starTopology) {
+        // Star: the host tells every guest about the new roster
+        if (m_isRoomCreator) {
+            broadcastRoster();
+        }
+    } else {
+        // Send peer list to complete mesh
+        sendPeerList(peer);
+    }
     
     // If we are authority (host), send the current game text to the new player
     if (m_isAuthority && !m_gameText.isEmpty()) {
-        QJsonObject textPayload;
-        textPayload["text"] = m_gameText;
-        textPayload["language"] = m_gameLanguage;
-        Packet textPacket = createPacket(PacketType::GAME_TEXT, textPayload);
-        sendToPeer(peer, textPacket);
+        sendToPeer(peer, createPacket(PacketType::GAME_TEXT, gameTextPayload(peer)));
         qDebug() << "[NetworkManager] Sent game text to new player" << peer->name;
     }
     
@@ -845,7 +1376,141 @@ void NetworkManager::handlePeerList(const Packet& packet) {
     QJsonArray peerArray = packet.payload["peers"].toArray();
     qDebug() << "[NetworkManager] Received PEER_LIST with" << peerArray.size() << "peers";
     
-    connectToMissingPeers(peerArray);
+    if (m_starTopology) {
+        applyRoster(peerArray);
+    } else {
+        connectToMissingPeers(peerArray);
+    }
+}
+
+// ============================================================================
+// STAR TOPOLOGY
+// ============================================================================
+
+void NetworkManager::broadcastRoster() {
+    QJsonArray peerArray;
+    for (auto it = m_peers.begin(); it != m_peers.end(); ++it) {
+        if (!it.value()->handshakeComplete) continue;
+        
+        QJsonObject peerObj;
+        peerObj["uuid"] = it.value()->uuid;
+        peerObj["name"] = it.value()->name;
+        peerObj["ip"] = it.value()->ip;
+        peerObj["port"] = it.value()->port;
+        peerObj["index"] = it.value()->index;
+        peerArray.append(peerObj);
+    }
+    
+    QJsonObject payload;
+    payload["peers"] = peerArray;
+    broadcastToAllPeers(createPacket(PacketType::PEER_LIST, payload));
+}
+
+void NetworkManager::applyRoster(const QJsonArray& peerList) {
+    bool changed = false;
+    for (const auto& peerVal : peerList) {
+        QJsonObject peerObj = peerVal.toObject();
+        QString uuid = peerObj["uuid"].toString();
+        if (uuid.isEmpty() || uuid == m_playerId) continue;
+        
+        quint8 index = static_cast<quint8>(peerObj["index"].toInt(NO_INDEX));
+        if (index != NO_INDEX) {
+            m_indexToUuid[index] = uuid;
+        }
+        
+        bool isNew = !m_players.contains(uuid);
+        PlayerInfo& player = m_players[uuid];
+        player.uuid = uuid;
+        player.name = peerObj["name"].toString();
+        player.ip = peerObj["ip"].toString();
+        player.port = peerObj["port"].toInt();
+        player.index = index;
+        
+        if (isNew) {
+            emit playerJoined(player.name);
+            changed = true;
+        }
+    }
+    
+    if (changed) {
+        emit playersChanged();
+    }
+}
+
+void NetworkManager::broadcastStateSnapshot() {
+    QJsonArray players;
+    for (const auto& player : m_players) {
+        QJsonObject obj;
+        obj["uuid"] = player.uuid;  // JSON peers only; binary peers resolve the index
+        obj["index"] = player.index;
+        obj["position"] = player.position;
+        obj["total"] = player.totalChars;
+        obj["wpm"] = player.wpm;
+        obj["finished"] = player.finished;
+        obj["rank"] = player.racePosition;
+        players.append(obj);
+    }
+    
+    QJsonObject payload;
+    payload["players"] = players;
+    broadcastUnreliable(createPacket(PacketType::STATE_SNAPSHOT, payload));
+}
+
+void NetworkManager::handleStateSnapshot(const Packet& packet) {
+    const QJsonArray players = packet.payload["players"].toArray();
+    for (const auto& value : players) {
+        const QJsonObject obj = value.toObject();
+        QString uuid = obj["uuid"].toString();
+        if (uuid.isEmpty()) {
+            uuid = m_indexToUuid.value(static_cast<quint8>(obj["index"].toInt(NO_INDEX)));
+        }
+        
+        // Our own state is local; unknown players arrive with the next roster
+        if (uuid.isEmpty() || uuid == m_playerId) continue;
+        auto it = m_players.find(uuid);
+        if (it == m_players.end()) continue;
+        
+        PlayerInfo& player = it.value();
+        player.position = obj["position"].toInt();
+        player.totalChars = obj["total"].toInt();
+        player.wpm = obj["wpm"].toInt();
+        player.finished = obj["finished"].toBool();
+        player.racePosition = obj["rank"].toInt();
+        
+        double progress = player.totalChars > 0 ?
+                         static_cast<double>(player.position) / player.totalChars : 0.0;
+        emit playerProgressUpdated(uuid, player.name, progress, player.wpm,
+                                   player.finished, player.racePosition);
+        m_playersModel->addSample(uuid, packet.timestamp, progress);
+        stagePlayer(uuid);
+    }
+}
+
+void NetworkManager::pruneUnconnectedPlayers() {
+    // After a star-mode host migration, drop guests that never reconnected
+    if (!m_starTopology || !m_isRoomCreator) return;
+    
+    QStringList stale;
+    for (auto it = m_players.constBegin(); it != m_players.constEnd(); ++it) {
+        if (it.key() != m_playerId && !m_peers.contains(it.key())) {
+            stale.append(it.key());
+        }
+    }
+    if (stale.isEmpty()) return;
+    
+    for (const QString& uuid : stale) {
+        QString name = m_players.take(uuid).name;
+        qDebug() << "[NetworkManager] Player did not reconnect after migration:" << name;
+        
+        QJsonObject payload;
+        payload["uuid"] = uuid;
+        payload["name"] = name;
+        broadcastToAllPeers(createPacket(PacketType::PLAYER_LEFT, payload));
+        emit playerLeft(name);
+    }
+    
+    emit playersChanged();
+    checkRaceCompletion();
 }
 
 void NetworkManager::connectToMissingPeers(const QJsonArray& peerList) {
@@ -879,11 +1544,12 @@ void NetworkManager::processPacket(PeerConnection* peer, const Packet& packet) {
         if (procLogCounter++ % 20 == 0) {
             qDebug() << "[NetworkManager] Processing PROGRESS_UPDATE from" << packet.senderUuid;
         }
-    } else if (packet.type != PacketType::PROGRESS_UPDATE) {
-         // Log others normally (except maybe repeated ones)
-         // qDebug() << "[NetworkManager] Processing packet type" << (int)packet.type << "from" << packet.senderUuid;
     }
 
+    // Dispatch time per PacketType for the performance overlay
+    PerfMonitor* perf = PerfMonitor::active() ? PerfMonitor::instance() : nullptr;
+    const qint64 perfStartUs = perf ? perf->nowUs() : 0;
+
     switch (packet.type) {
         case PacketType::HELLO:
             handleHello(peer, packet);
@@ -901,7 +1567,7 @@ void NetworkManager::processPacket(PeerConnection* peer, const Packet& packet) {
             handleFinish(peer, packet);
             break;
         case PacketType::GAME_TEXT:
-            handleGameText(packet);
+            handleGameText(peer, packet);
             break;
         case PacketType::COUNTDOWN:
             handleCountdown(packet);
@@ -913,7 +1579,7 @@ void NetworkManager::processPacket(PeerConnection* peer, const Packet& packet) {
             handleRaceResults(packet);
             break;
         case PacketType::READY_CHECK:
-            handleReadyCheck(packet);
+            handleReadyCheck(peer, packet);
             break;
         case PacketType::READY_RESPONSE:
             handleReadyResponse(packet);
@@ -927,15 +1593,47 @@ void NetworkManager::processPacket(PeerConnection* peer, const Packet& packet) {
         case PacketType::KICK:
             handleKick(packet);
             break;
+        case PacketType::STATE_SNAPSHOT:
+            handleStateSnapshot(packet);
+            break;
+        case PacketType::TIME_PING:
+            handleTimePing(peer, packet);
+            break;
+        case PacketType::TIME_PONG:
+            handleTimePong(peer, packet);
+            break;
+        case PacketType::TEXT_REQUEST:
+            handleTextRequest(peer);
+            break;
+    }
+
+    if (perf) {
+        perf->recordPacketDispatch(static_cast<quint8>(packet.type), perf->nowUs() - perfStartUs);
     }
 }
 
-void NetworkManager::broadcastToAllPeers(const Packet& packet) {
-    QByteArray data = packet.serialize();
+bool NetworkManager::usesBinaryWire(const PeerConnection* peer, const Packet& packet) const {
+    // HELLO always goes out as JSON: it is what negotiates the wire format
+    return packet.type != PacketType::HELLO
+        && peer->wireVersion >= WIRE_VERSION
+        && m_localIndex != NO_INDEX;
+}
+
+void NetworkManager::broadcastToAllPeers(const Packet& packet, const Packet* binaryPacket) {
+    const Packet& forBinary = binaryPacket ? *binaryPacket : packet;
+    
+    // Encode at most once per wire format
+    QByteArray jsonData;
+    QByteArray binaryData;
     for (auto it = m_peers.begin(); it != m_peers.end(); ++it) {
-        if (it.value()->socket && it.value()->socket->state() == QAbstractSocket::ConnectedState) {
-            it.value()->socket->write(data);
-            it.value()->socket->flush();
+        PeerConnection* peer = it.value();
+        if (peer->socket && peer->socket->state() == QAbstractSocket::ConnectedState) {
+            const bool binary = usesBinaryWire(peer, packet);
+            QByteArray& data = binary ? binaryData : jsonData;
+            if (data.isEmpty()) {
+                data = binary ? forBinary.serializeBinary(m_localIndex) : packet.serialize();
+            }
+            enqueue(peer, data);
         }
     }
 }
@@ -955,9 +1653,80 @@ void NetworkManager::sendToPeer(PeerConnection* peer, const Packet& packet) {
     if (!peer || !peer->socket) return;
     if (peer->socket->state() != QAbstractSocket::ConnectedState) return;
     
-    QByteArray data = packet.serialize();
-    peer->socket->write(data);
-    peer->socket->flush();
+    QByteArray data = usesBinaryWire(peer, packet)
+        ? packet.serializeBinary(m_localIndex)
+        : packet.serialize();
+    enqueue(peer, data);
+}
+
+void NetworkManager::enqueue(PeerConnection* peer, const QByteArray& data) {
+    peer->outQueue.append(data);
+    peer->queuedPackets++;
+    
+    // Everything queued during this event-loop iteration goes out in one write
+    if (!m_flushScheduled) {
+        m_flushScheduled = true;
+        QMetaObject::invokeMethod(this, &NetworkManager::flushOutgoing, Qt::QueuedConnection);
+    }
+}
+
+void NetworkManager::flushOutgoing() {
+    m_flushScheduled = false;
+    for (auto it = m_peers.begin(); it != m_peers.end(); ++it) {
+        flushPeer(it.value());
+    }
+}
+
+void NetworkManager::flushPeer(PeerConnection* peer) {
+    if (!peer || peer->outQueue.isEmpty()) return;
+    
+    if (peer->socket && peer->socket->state() == QAbstractSocket::ConnectedState) {
+        peer->socket->write(peer->outQueue);
+        peer->socket->flush();
+        
+        peer->bytesSent += peer->outQueue.size();
+        peer->packetsSent += peer->queuedPackets;
+        peer->maxQueuedPackets = qMax(peer->maxQueuedPackets, peer->queuedPackets);
+        
+        // Unsent bytes piling up in the socket mean the peer's link is too slow
+        const qint64 unsent = peer->socket->bytesToWrite();
+        if (unsent > BACKPRESSURE_WARN_BYTES && !peer->backpressureWarned) {
+            qWarning() << "[NetworkManager] Backpressure to" << peer->name << ":" << unsent << "bytes unsent";
+            peer->backpressureWarned = true;
+        } else if (unsent <= BACKPRESSURE_WARN_BYTES / 2) {
+            peer->backpressureWarned = false;
+        }
+    }
+    
+    peer->outQueue.clear();
+    peer->queuedPackets = 0;
+}
+
+void NetworkManager::configureSocket(QTcpSocket* socket) {
+    // Packets are small and latency-sensitive: disable Nagle
+    socket->setSocketOption(QAbstractSocket::LowDelayOption, 1);
+    socket->setSocketOption(QAbstractSocket::KeepAliveOption, 1);
+}
+
+QVariantList NetworkManager::peerStats() const {
+    QVariantList list;
+    for (auto it = m_peers.constBegin(); it != m_peers.constEnd(); ++it) {
+        const PeerConnection* peer = it.value();
+        QVariantMap map;
+        map["name"] = peer->name;
+        map["uuid"] = peer->uuid;
+        map["queuedBytes"] = peer->outQueue.size();
+        map["unsentBytes"] = peer->socket ? peer->socket->bytesToWrite() : 0;
+        map["bytesSent"] = peer->bytesSent;
+        map["packetsSent"] = peer->packetsSent;
+        map["datagramBytesSent"] = peer->datagramBytesSent;
+        map["datagramsSent"] = peer->datagramsSent;
+        map["maxBatch"] = peer->maxQueuedPackets;
+        map["rttMs"] = peer->rttUs >= 0 ? peer->rttUs / 1000.0 : -1.0;
+        map["clockOffsetMs"] = peer->clockOffsetUs / 1000.0;
+        list.append(map);
+    }
+    return list;
 }
 
 // ============================================================================
@@ -988,10 +1757,38 @@ void NetworkManager::updateAuthority() {
                 m_isAuthority = true;
                 m_isRoomCreator = true;  // Promote to full room creator status
                 m_hostUuid = m_playerId;  // Update host UUID to self
+                // m_hostClockOffsetUs stays: host time must not jump under a
+                // running race, and TIME_PONG answers in the same clock
+                
+                // Keep our index (guests already map it) and continue handing
+                // out room indices after the highest one in use
+                int highestIndex = m_localIndex == NO_INDEX ? 0 : m_localIndex;
+                for (auto idx = m_indexToUuid.keyBegin(); idx != m_indexToUuid.keyEnd(); ++idx) {
+                    highestIndex = qMax(highestIndex, static_cast<int>(*idx));
+                }
+                if (m_localIndex == NO_INDEX && highestIndex + 1 < NO_INDEX) {
+                    setLocalIndex(static_cast<quint8>(++highestIndex));
+                }
+                m_nextPeerIndex = static_cast<quint8>(qMin(highestIndex + 1, static_cast<int>(NO_INDEX)));
                 startAnnouncing();  // Start broadcasting so new players can discover this room
                 qDebug() << "[NetworkManager] Authority transferred to us! We are now the host.";
+                
+                if (m_starTopology) {
+                    // Give the other guests time to reconnect to us
+                    QTimer::singleShot(RECONNECT_GRACE_MS, this, &NetworkManager::pruneUnconnectedPlayers);
+                }
             } else {
                 m_isAuthority = false;
+                
+                if (m_starTopology) {
+                    // Star: guests only talk to the host, so reconnect to the elected one
+                    const PlayerInfo& newHost = m_players[uuids.first()];
+                    m_hostUuid = newHost.uuid;
+                    qDebug() << "[NetworkManager] Host left, reconnecting to new host" << newHost.name;
+                    if (!newHost.ip.isEmpty()) {
+                        connectToPeer(newHost.ip, newHost.port, newHost.uuid);
+                    }
+                }
             }
         } else {
             m_isAuthority = false;
@@ -1007,6 +1804,15 @@ void NetworkManager::updateAuthority() {
     }
 }
 
+void NetworkManager::setLocalIndex(quint8 index) {
+    m_localIndex = index;
+    
+    // The star host lists itself in STATE_SNAPSHOT by this index
+    if (m_players.contains(m_playerId)) {
+        m_players[m_playerId].index = index;
+    }
+}
+
 // ============================================================================
 // ROOM FUNCTIONS
 // ============================================================================
@@ -1016,18 +1822,22 @@ bool NetworkManager::createRoom() {
     
     startTcpServer();
     if (!m_tcpServer) return false;
+    openDataChannel();
     
     m_isInLobby = true;
     m_isConnected = true;
     m_isRoomCreator = true;   // We created the room, we are the HOST
     m_isAuthority = true;      // Room creator is always authority
     m_hostUuid = m_playerId;   // We are the host
+    m_nextPeerIndex = 1;
+    m_indexToUuid.clear();
     
     // Add self to players
     PlayerInfo self;
     self.uuid = m_playerId;
     self.name = m_playerName;
     m_players[m_playerId] = self;
+    setLocalIndex(0);          // Host is always room index 0
     
     startAnnouncing();
     
@@ -1063,6 +1873,7 @@ void NetworkManager::closeRoom() {
     
     // Disconnect all peers
     for (auto it = m_peers.begin(); it != m_peers.end(); ++it) {
+        flushPeer(it.value());  // Deliver anything queued (e.g. a decline) before closing
         if (it.value()->socket) {
             it.value()->socket->disconnect();  // Disconnect signals first
             it.value()->socket->close();
@@ -1071,6 +1882,7 @@ void NetworkManager::closeRoom() {
         delete it.value();
     }
     m_peers.clear();
+    m_peerBySocket.clear();
     
     stopTcpServer();
     resetState();
@@ -1101,6 +1913,7 @@ bool NetworkManager::joinRoom(const QString& hostIp, int port) {
     
     stopScanning();
     startTcpServer();  // We also need to accept connections for mesh
+    openDataChannel();
     
     // Add self to players (temporarily, will be cleaned up on failure)
     PlayerInfo self;
@@ -1138,15 +1951,12 @@ void NetworkManager::leaveRoom() {
 void NetworkManager::setGameText(const QString& text) {
     if (!m_isRoomCreator) return;  // Only host can set game text
     
+    // Custom text cannot be regenerated from a seed
+    m_textSeed = TextSeed();
     m_gameText = text;
     emit gameTextChanged();
     
-    QJsonObject payload;
-    payload["text"] = text;
-    payload["language"] = m_gameLanguage;
-    
-    Packet packet = createPacket(PacketType::GAME_TEXT, payload);
-    broadcastToAllPeers(packet);
+    sendGameText(PacketType::GAME_TEXT);
 }
 
 void NetworkManager::setGameLanguage(const QString& language) {
@@ -1161,15 +1971,108 @@ void NetworkManager::setGameLanguage(const QString& language) {
 }
 
 void NetworkManager::refreshGameText() {
-    if (!m_isAuthority) return;  // Only authority (host) can refresh text
+    if (!m_isAuthority || !m_isRoomCreator) return;  // Only the host can refresh text
     
     // Use GameBackend to generate text based on language
-    GameBackend* backend = GameBackend::instance();
+    GameBackend* backend = GameBackend::existingInstance();
     if (backend) {
-        // Use medium difficulty with 20 words for multiplayer
-        QString text = backend->getRandomText(m_gameLanguage, "medium", 20);
-        setGameText(text);
+        // Use medium difficulty with 20 words for multiplayer. The text is
+        // seeded so peers with the same word bank can rebuild it locally.
+        TextSeed textSeed;
+        textSeed.seeded = true;
+        textSeed.seed = QRandomGenerator::global()->generate64();
+        textSeed.difficulty = "medium";
+        textSeed.wordCount = 20;
+        
+        m_gameText = backend->getSeededText(m_gameLanguage, textSeed.difficulty,
+                                            textSeed.wordCount, textSeed.seed);
+        m_textSeed = textSeed;
+        emit gameTextChanged();
+        
+        sendGameText(PacketType::GAME_TEXT);
+    }
+}
+
+QJsonObject NetworkManager::gameTextPayload(const PeerConnection* peer) const {
+    QJsonObject payload;
+    payload["language"] = m_gameLanguage;
+    
+    // Seed only if this peer advertised the very same word bank
+    const GameBackend* backend = GameBackend::existingInstance();
+    const quint64 bankHash = backend ? backend->wordBankHash(m_gameLanguage) : 0;
+    const QString bankHex = QString::number(bankHash, 16);
+    if (m_textSeed.seeded && bankHash != 0 && !peer->needsFullText
+        && peer->bankHashes.value(m_gameLanguage).toString() == bankHex) {
+        payload["seed"] = QString::number(m_textSeed.seed, 16);
+        payload["difficulty"] = m_textSeed.difficulty;
+        payload["wordCount"] = m_textSeed.wordCount;
+        payload["bankHash"] = bankHex;
+    } else {
+        payload["text"] = m_gameText;
+    }
+    return payload;
+}
+
+void NetworkManager::sendGameText(PacketType type) {
+    // Per peer: the payload depends on which word banks the peer has
+    for (auto it = m_peers.begin(); it != m_peers.end(); ++it) {
+        PeerConnection* peer = it.value();
+        if (peer->socket && peer->socket->state() == QAbstractSocket::ConnectedState) {
+            sendToPeer(peer, createPacket(type, gameTextPayload(peer)));
+        }
+    }
+}
+
+bool NetworkManager::applyGameText(PeerConnection* from, const QJsonObject& payload) {
+    if (payload.contains("language")) {
+        QString lang = payload["language"].toString();
+        if (m_gameLanguage != lang) {
+            m_gameLanguage = lang;
+            emit gameLanguageChanged();
+        }
     }
+    
+    QString text;
+    TextSeed textSeed;
+    if (payload.contains("seed")) {
+        bool seedOk = false;
+        textSeed.seeded = true;
+        textSeed.seed = payload["seed"].toString().toULongLong(&seedOk, 16);
+        textSeed.difficulty = payload["difficulty"].toString();
+        textSeed.wordCount = payload["wordCount"].toInt();
+        const quint64 bankHash = payload["bankHash"].toString().toULongLong(nullptr, 16);
+        
+        GameBackend* backend = GameBackend::existingInstance();
+        if (seedOk && backend && bankHash != 0 && backend->wordBankHash(m_gameLanguage) == bankHash) {
+            text = backend->getSeededText(m_gameLanguage, textSeed.difficulty,
+                                          textSeed.wordCount, textSeed.seed);
+        }
+        if (text.isEmpty()) {
+            // Different (or not yet loaded) word bank: fall back to the full text
+            qDebug() << "[NetworkManager] Cannot rebuild seeded text, requesting it in full";
+            if (from) {
+                sendToPeer(from, createPacket(PacketType::TEXT_REQUEST));
+            }
+            return false;
+        }
+    } else {
+        text = payload["text"].toString();
+    }
+    
+    m_textSeed = textSeed;
+    if (m_gameText != text) {
+        m_gameText = text;
+        emit gameTextChanged();
+    }
+    return true;
+}
+
+void NetworkManager::handleTextRequest(PeerConnection* peer) {
+    if (!m_isAuthority || m_gameText.isEmpty()) return;
+    
+    peer->needsFullText = true;
+    sendToPeer(peer, createPacket(PacketType::GAME_TEXT, gameTextPayload(peer)));
+    qDebug() << "[NetworkManager] Sent full game text to" << peer->name;
 }
 
 void NetworkManager::startCountdown() {
@@ -1210,13 +2113,9 @@ void NetworkManager::startCountdown() {
     m_isWaitingForReady = true;
     emit waitingForReadyChanged();
     
-    // Send READY_CHECK to all peers with the game text to ensure sync
-    QJsonObject payload;
-    payload["text"] = m_gameText;
-    payload["language"] = m_gameLanguage;
-    
-    Packet packet = createPacket(PacketType::READY_CHECK, payload);
-    broadcastToAllPeers(packet);
+    // Send READY_CHECK to all peers with the game text (or its seed) to
+    // ensure sync
+    sendGameText(PacketType::READY_CHECK);
     
     qDebug() << "[NetworkManager] Sent READY_CHECK to" << m_peers.size() << "peers, waiting for responses...";
     
@@ -1224,25 +2123,25 @@ void NetworkManager::startCountdown() {
     m_readyCheckTimer->start(5000);
 }
 
-void NetworkManager::handleReadyCheck(const Packet& packet) {
+void NetworkManager::handleReadyCheck(PeerConnection* peer, const Packet& packet) {
     // Guest received ready check from host
-    // Sync the game text and language
-    QString text = packet.payload["text"].toString();
-    QString lang = packet.payload["language"].toString();
+    // Sync the game text and language. On a seed mismatch the full text is
+    // requested now and arrives before the host's COUNTDOWN (same socket).
+    applyGameText(peer, packet.payload);
     
-    if (m_gameText != text) {
-        m_gameText = text;
-        emit gameTextChanged();
-    }
-    if (m_gameLanguage != lang) {
-        m_gameLanguage = lang;
-        emit gameLanguageChanged();
-    }
+    qDebug() << "[NetworkManager] Received READY_CHECK, synced text (" << m_gameText.length() << "chars), syncing clock";
     
-    qDebug() << "[NetworkManager] Received READY_CHECK, synced text (" << text.length() << "chars), sending READY_RESPONSE";
+    // Measure the host clock first; READY_RESPONSE follows when done
+    startTimeSync();
+}
+
+void NetworkManager::sendReadyResponse() {
+    // Report our clock sync so the host can show per-peer diagnostics
+    QJsonObject payload;
+    payload["rttUs"] = m_hostRttUs;
+    payload["offsetUs"] = m_hostClockOffsetUs;
     
-    // Send ready response back
-    Packet response = createPacket(PacketType::READY_RESPONSE);
+    Packet response = createPacket(PacketType::READY_RESPONSE, payload);
     broadcastToAllPeers(response);
 }
 
@@ -1254,6 +2153,14 @@ void NetworkManager::handleReadyResponse(const Packet& packet) {
     QString senderId = packet.senderUuid;
     m_playersReady[senderId] = true;
     
+    if (PeerConnection* peer = m_peers.value(senderId, nullptr)) {
+        peer->rttUs = packet.payload["rttUs"].toVariant().toLongLong();
+        peer->clockOffsetUs = packet.payload["offsetUs"].toVariant().toLongLong();
+        if (peer->rttUs > 0) {
+            PerfMonitor::instance()->recordRtt(peer->rttUs);  // Measured by the guest
+        }
+    }
+    
     qDebug() << "[NetworkManager] Received READY_RESPONSE from" << senderId 
              << "(" << m_playersReady.size() << "/" << m_players.size() << "ready)";
     
@@ -1290,29 +2197,134 @@ void NetworkManager::onReadyCheckTimeout() {
 }
 
 void NetworkManager::beginCountdown() {
+    // The race starts at one absolute instant on the host clock; guests
+    // schedule against it using their measured offset
+    m_raceStartTime = hostClockMs() + COUNTDOWN_MS;
+    
     // Broadcast countdown start to all peers
     QJsonObject payload;
-    payload["seconds"] = 3;
+    payload["seconds"] = COUNTDOWN_MS / 1000;
+    payload["startAt"] = m_raceStartTime;
     
     Packet packet = createPacket(PacketType::COUNTDOWN, payload);
     broadcastToAllPeers(packet);
-    emit countdownStarted(3);
+    emit countdownStarted(COUNTDOWN_MS / 1000);
     
-    // After 3 seconds, start game
-    QTimer::singleShot(3000, this, [this]() {
-        // Record race start time for synchronized duration calculation
-        m_raceStartTime = QDateTime::currentMSecsSinceEpoch();
-        
-        m_isInGame = true;
-        emit gameStateChanged();
-        
+    m_raceStartTimer->start(COUNTDOWN_MS);
+}
+
+void NetworkManager::startLocalRace() {
+    if (m_isInGame) return;
+    
+    m_isInGame = true;
+    emit gameStateChanged();
+    
+    // GAME_START is kept for clients that do not schedule from COUNTDOWN
+    if (m_isAuthority) {
         Packet startPacket = createPacket(PacketType::GAME_START);
         broadcastToAllPeers(startPacket);
-        emit gameStarted();
-        
-        // Start sending progress updates
-        m_progressTimer->start(PROGRESS_UPDATE_MS);
-    });
+    }
+    emit gameStarted();
+    
+    // Start sending progress updates
+    m_sentTotal = 0;
+    m_lastProgressSendMs = 0;
+    m_progressDirty = true;
+    scheduleProgressSend();
+}
+
+int NetworkManager::msUntilRaceStart() const {
+    if (m_raceStartTime <= 0) return COUNTDOWN_MS;
+    return static_cast<int>(qBound<qint64>(0, m_raceStartTime - hostClockMs(), COUNTDOWN_MS * 2));
+}
+
+// ============================================================================
+// CLOCK SYNC
+// ============================================================================
+
+qint64 NetworkManager::localClockUs() const {
+    return m_clockEpochUs + m_clock.nsecsElapsed() / 1000;
+}
+
+qint64 NetworkManager::hostClockMs() const {
+    return (localClockUs() + m_hostClockOffsetUs) / 1000;
+}
+
+void NetworkManager::startTimeSync() {
+    PeerConnection* host = m_peers.value(m_hostUuid, nullptr);
+    if (m_isRoomCreator || !host) {
+        sendReadyResponse();
+        return;
+    }
+    
+    host->rttUs = -1;
+    m_timeSyncRemaining = TIME_SYNC_SAMPLES;
+    m_timeSyncTimer->start(TIME_SYNC_TIMEOUT_MS);
+    sendTimePing();
+}
+
+void NetworkManager::sendTimePing() {
+    PeerConnection* host = m_peers.value(m_hostUuid, nullptr);
+    if (!host || m_timeSyncRemaining <= 0) return;
+    
+    QJsonObject payload;
+    payload["t0"] = localClockUs();
+    sendToPeer(host, createPacket(PacketType::TIME_PING, payload));
+    flushPeer(host);  // Timestamps must not wait for the coalesced flush
+}
+
+void NetworkManager::handleTimePing(PeerConnection* peer, const Packet& packet) {
+    // Answer in host time as this node uses it (hostClockMs()). For a host
+    // promoted after migration that still includes the old host's offset,
+    // so guests and this node keep scheduling on the same clock.
+    const qint64 t1 = localClockUs() + m_hostClockOffsetUs;
+    
+    QJsonObject payload;
+    payload["t0"] = packet.payload["t0"];
+    payload["t1"] = t1;
+    payload["t2"] = localClockUs() + m_hostClockOffsetUs;
+    sendToPeer(peer, createPacket(PacketType::TIME_PONG, payload));
+    flushPeer(peer);
+}
+
+void NetworkManager::handleTimePong(PeerConnection* peer, const Packet& packet) {
+    if (m_timeSyncRemaining <= 0 || peer->uuid != m_hostUuid) return;
+    
+    const qint64 t3 = localClockUs();
+    const qint64 t0 = packet.payload["t0"].toVariant().toLongLong();
+    const qint64 t1 = packet.payload["t1"].toVariant().toLongLong();
+    const qint64 t2 = packet.payload["t2"].toVariant().toLongLong();
+    
+    // NTP: round trip minus host processing, offset assuming symmetric paths.
+    // The lowest-RTT sample has the least queuing error, so keep that one.
+    const qint64 rtt = (t3 - t0) - (t2 - t1);
+    const qint64 offset = ((t1 - t0) + (t2 - t3)) / 2;
+    PerfMonitor::instance()->recordRtt(rtt);
+    if (rtt >= 0 && (peer->rttUs < 0 || rtt < peer->rttUs)) {
+        peer->rttUs = rtt;
+        peer->clockOffsetUs = offset;
+    }
+    
+    if (--m_timeSyncRemaining > 0) {
+        QTimer::singleShot(TIME_SYNC_SPACING_MS, this, &NetworkManager::sendTimePing);
+    } else {
+        finishTimeSync();
+    }
+}
+
+void NetworkManager::finishTimeSync() {
+    m_timeSyncTimer->stop();
+    m_timeSyncRemaining = 0;
+    
+    if (PeerConnection* host = m_peers.value(m_hostUuid, nullptr); host && host->rttUs >= 0) {
+        m_hostRttUs = host->rttUs;
+        m_hostClockOffsetUs = host->clockOffsetUs;
+        qDebug() << "[NetworkManager] Clock sync: rtt" << m_hostRttUs / 1000.0 << "ms, offset"
+                 << m_hostClockOffsetUs / 1000.0 << "ms";
+        emit timeSyncChanged();
+    }
+    
+    sendReadyResponse();
 }
 
 void NetworkManager::kickPlayer(const QString& uuid) {
@@ -1346,29 +2358,24 @@ void NetworkManager::kickPlayer(const QString& uuid) {
 
 void NetworkManager::handleGameStart(const Packet& packet) {
     Q_UNUSED(packet)
-    m_isInGame = true;
-    emit gameStateChanged();
-    emit gameStarted();
-    
-    m_progressTimer->start(PROGRESS_UPDATE_MS);
+    // Normally already started from the COUNTDOWN schedule; this covers
+    // hosts that do not send startAt
+    m_raceStartTimer->stop();
+    startLocalRace();
 }
 
-void NetworkManager::handleGameText(const Packet& packet) {
-    m_gameText = packet.payload["text"].toString();
-    emit gameTextChanged();
-    
-    // Sync language if provided
-    if (packet.payload.contains("language")) {
-        QString lang = packet.payload["language"].toString();
-        if (m_gameLanguage != lang) {
-            m_gameLanguage = lang;
-            emit gameLanguageChanged();
-        }
-    }
+void NetworkManager::handleGameText(PeerConnection* peer, const Packet& packet) {
+    applyGameText(peer, packet.payload);
 }
 
 void NetworkManager::handleCountdown(const Packet& packet) {
     int seconds = packet.payload["seconds"].toInt();
+    
+    if (packet.payload.contains("startAt")) {
+        m_raceStartTime = packet.payload["startAt"].toVariant().toLongLong();
+        m_raceStartTimer->start(msUntilRaceStart());
+    }
+    
     emit countdownStarted(seconds);
 }
 
@@ -1426,24 +2433,34 @@ void NetworkManager::updateProgress(int position, int totalChars, int wpm) {
         m_players[m_playerId].wpm = wpm;
     }
     
-    // Notify UI of local changes immediately
-    emit playersChanged();
+    // Notify UI of local changes (coalesced per frame by the players model)
+    stagePlayer(m_playerId);
+    
+    m_progressDirty = true;
+    scheduleProgressSend();
 }
 
 void NetworkManager::finishRace(int wpm, double accuracy, int errors, int duration) {
     m_localFinished = true;
     m_finishedCount++;
     
+    const qint64 finishAt = hostClockMs();
     if (m_players.contains(m_playerId)) {
         m_players[m_playerId].finished = true;
-        m_players[m_playerId].finishTime = QDateTime::currentMSecsSinceEpoch();
-        m_players[m_playerId].racePosition = m_finishedCount;
+        m_players[m_playerId].finishTime = finishAt;
         m_players[m_playerId].wpm = wpm;
         m_players[m_playerId].accuracy = accuracy;
         m_players[m_playerId].errors = errors;
         m_players[m_playerId].duration = duration;
     }
     
+    // Final position goes out reliably ahead of FINISH; after that only a
+    // star host keeps sending (snapshots for the remaining racers)
+    if (m_isInGame && !(m_starTopology && m_isRoomCreator)) {
+        m_progressTimer->stop();
+        sendProgressNow(true);
+    }
+    
     // Broadcast finish with accuracy, errors and duration
     QJsonObject payload;
     payload["wpm"] = wpm;
@@ -1451,49 +2468,135 @@ void NetworkManager::finishRace(int wpm, double accuracy, int errors, int durati
     payload["errors"] = errors;
     payload["duration"] = duration;
     payload["position"] = m_finishedCount;
+    payload["finishAt"] = finishAt;  // Host clock
     
     Packet packet = createPacket(PacketType::FINISH, payload);
     broadcastToAllPeers(packet);
     
+    rankFinishers();
     checkRaceCompletion();
 }
 
+void NetworkManager::scheduleProgressSend() {
+    if (!m_isInGame) return;
+    if (m_localFinished && !(m_starTopology && m_isRoomCreator)) return;
+    
+    // Send now if the rate limit allows, otherwise at the next allowed instant
+    const qint64 wait = m_lastProgressSendMs + progressIntervalMs() - m_clock.elapsed();
+    if (m_lastProgressSendMs == 0 || wait <= 0) {
+        sendProgressUpdate();
+    } else if (!m_progressTimer->isActive() || m_progressTimer->remainingTime() > wait) {
+        m_progressTimer->start(static_cast<int>(wait));
+    }
+}
+
 void NetworkManager::sendProgressUpdate() {
     if (!m_isInGame) return;
+    if (m_localFinished && !(m_starTopology && m_isRoomCreator)) return;
+    
+    // Nothing new: only a heartbeat once the idle interval has passed
+    const qint64 idle = m_clock.elapsed() - m_lastProgressSendMs;
+    if (!m_progressDirty && m_lastProgressSendMs != 0 && idle < PROGRESS_HEARTBEAT_MS) {
+        m_progressTimer->start(static_cast<int>(PROGRESS_HEARTBEAT_MS - idle));
+        return;
+    }
+    
+    sendProgressNow(false);
+    m_progressTimer->start(PROGRESS_HEARTBEAT_MS);
+}
+
+void NetworkManager::sendProgressNow(bool reliable) {
+    m_lastProgressSendMs = qMax<qint64>(1, m_clock.elapsed());
+    m_progressDirty = false;
+    
+    // Star host: one aggregated snapshot replaces per-player progress fan-out
+    if (m_starTopology && m_isRoomCreator) {
+        broadcastStateSnapshot();
+        return;
+    }
     
     QJsonObject payload;
     payload["position"] = m_currentPosition;
-    payload["total"] = m_currentTotal;
     payload["wpm"] = m_currentWpm;
     payload["finished"] = m_localFinished;
     
+    // The text length is fixed for the race: binary peers get it once,
+    // reliably (0 = unchanged afterwards). JSON-only clients reset their
+    // total from every PROGRESS_UPDATE, so their packets always carry it.
+    QJsonObject binaryPayload = payload;
+    if (m_currentTotal > 0) {
+        payload["total"] = m_currentTotal;
+        if (m_currentTotal != m_sentTotal) {
+            binaryPayload["total"] = m_currentTotal;
+            m_sentTotal = m_currentTotal;
+            reliable = true;
+        }
+    }
+    
     Packet packet = createPacket(PacketType::PROGRESS_UPDATE, payload);
+    Packet binaryPacket = packet;
+    binaryPacket.payload = binaryPayload;
     
     // Debug log to verify sending (throttled to avoid spam)
     static int sendLogCounter = 0;
     if (sendLogCounter++ % 20 == 0) {
         qDebug() << "[NetworkManager] Sending PROGRESS_UPDATE: pos=" << m_currentPosition 
-                 << " total=" << m_currentTotal << " wpm=" << m_currentWpm;
+                 << " total=" << m_currentTotal << " wpm=" << m_currentWpm
+                 << " interval=" << progressIntervalMs() << "ms";
     }
     
-    broadcastToAllPeers(packet);
+    if (reliable) {
+        broadcastToAllPeers(packet, &binaryPacket);
+    } else {
+        broadcastUnreliable(packet, &binaryPacket);
+    }
+}
+
+int NetworkManager::progressIntervalMs() const {
+    // Every send is one datagram per peer: keep the total within budget
+    qint64 interval = qMax<qint64>(PROGRESS_UPDATE_MS,
+                                   m_peers.size() * 1000 / PROGRESS_DATAGRAM_BUDGET);
+    
+    // Slow links: no more than about one update per round trip
+    qint64 rttUs = m_hostRttUs;
+    for (const PeerConnection* peer : m_peers) {
+        rttUs = qMax(rttUs, peer->rttUs);
+    }
+    interval = qMax(interval, rttUs / 1000);
+    
+    return static_cast<int>(qMin<qint64>(interval, PROGRESS_MAX_INTERVAL_MS));
 }
 
 void NetworkManager::handleProgressUpdate(PeerConnection* peer, const Packet& packet) {
     QString playerId = packet.senderUuid;
     
     if (!m_players.contains(playerId)) {
-        qDebug() << "[NetworkManager] WARN: Ignoring PROGRESS_UPDATE from unknown player:" << playerId;
-         // Print known keys for debugging
-         qDebug() << "[NetworkManager] Known players:" << m_players.keys();
+        // Datagrams from a player that just left keep arriving for a while;
+        // warn once instead of on every packet
+        if (!m_warnedUnknownSender) {
+            m_warnedUnknownSender = true;
+            qWarning() << "[NetworkManager] Ignoring PROGRESS_UPDATE from unknown player:" << playerId;
+        }
         return;
     }
     
     auto& player = m_players[playerId];
+    
+    // FINISH (on TCP) is the only authority for finishing; a progress
+    // datagram can overtake it and must neither finish nor un-finish a player
+    if (player.finished) return;
+    
     player.position = packet.payload["position"].toInt();
-    player.totalChars = packet.payload["total"].toInt();
+    if (packet.payload.contains("total")) {
+        player.totalChars = packet.payload["total"].toInt();  // Binary peers send it once
+    }
     player.wpm = packet.payload["wpm"].toInt();
-    player.finished = packet.payload["finished"].toBool();
+    
+    // Star host: relay the change in the next snapshot
+    if (m_starTopology && m_isRoomCreator) {
+        m_progressDirty = true;
+        scheduleProgressSend();
+    }
     
     // Debug log
     static int recvLogCounter = 0;
@@ -1508,8 +2611,10 @@ void NetworkManager::handleProgressUpdate(PeerConnection* peer, const Packet& pa
     emit playerProgressUpdated(playerId, player.name, progress, player.wpm, 
                                player.finished, player.racePosition);
                                
-    // Notify UI to update track positions
-    emit playersChanged();
+    // Notify UI to update track positions (only this row, coalesced per frame);
+    // the lane itself is interpolated between samples
+    m_playersModel->addSample(playerId, packet.timestamp, progress);
+    stagePlayer(playerId);
 }
 
 void NetworkManager::handleFinish(PeerConnection* peer, const Packet& packet) {
@@ -1524,23 +2629,45 @@ void NetworkManager::handleFinish(PeerConnection* peer, const Packet& packet) {
     if (!wasFinished) {
         m_finishedCount++;
         player.finished = true;
-        player.finishTime = QDateTime::currentMSecsSinceEpoch();
-        player.racePosition = m_finishedCount;
+        // Sender's finish instant on the host clock; arrival time otherwise
+        player.finishTime = packet.payload.contains("finishAt")
+            ? packet.payload["finishAt"].toVariant().toLongLong()
+            : hostClockMs();
         player.wpm = packet.payload["wpm"].toInt();
         player.accuracy = packet.payload["accuracy"].toDouble(100.0);
         player.errors = packet.payload["errors"].toInt(0);
         player.duration = packet.payload["duration"].toInt(0);
+        rankFinishers();
         
         emit playerProgressUpdated(playerId, player.name, 1.0, player.wpm, 
                                    true, player.racePosition);
                                    
         // Notify UI of finish state
         emit playersChanged();
+        
+        if (m_starTopology && m_isRoomCreator) {
+            m_progressDirty = true;
+            scheduleProgressSend();
+        }
     }
     
     checkRaceCompletion();
 }
 
+void NetworkManager::rankFinishers() {
+    // Finish order follows host-clock finish instants, not packet arrival
+    QList<PlayerInfo*> finished;
+    for (auto& player : m_players) {
+        if (player.finished) finished.append(&player);
+    }
+    std::stable_sort(finished.begin(), finished.end(), [](const PlayerInfo* a, const PlayerInfo* b) {
+        return a->finishTime < b->finishTime;
+    });
+    for (int i = 0; i < finished.size(); ++i) {
+        finished[i]->racePosition = i + 1;
+    }
+}
+
 void NetworkManager::checkRaceCompletion() {
     // Check if all players have finished
     bool allFinished = true;
@@ -1553,8 +2680,15 @@ void NetworkManager::checkRaceCompletion() {
     
     if (allFinished && m_isAuthority) {
         // Build rankings sorted by: WPM (desc) > Accuracy (desc) > Errors (asc) > Duration (asc)
+        // Race time on the host clock (falls back to the self-reported duration)
+        auto raceTime = [this](const PlayerInfo& p) {
+            return (m_raceStartTime > 0 && p.finishTime > 0)
+                ? static_cast<double>(p.finishTime - m_raceStartTime)
+                : p.duration * 1000.0;
+        };
+        
         QList<PlayerInfo> sorted = m_players.values();
-        std::sort(sorted.begin(), sorted.end(), [](const PlayerInfo& a, const PlayerInfo& b) {
+        std::sort(sorted.begin(), sorted.end(), [&raceTime](const PlayerInfo& a, const PlayerInfo& b) {
             // Primary: WPM (higher is better)
             if (a.wpm != b.wpm) return a.wpm > b.wpm;
             // Secondary: Accuracy (higher is better)
@@ -1562,7 +2696,7 @@ void NetworkManager::checkRaceCompletion() {
             // Tertiary: Errors (lower is better)
             if (a.errors != b.errors) return a.errors < b.errors;
             // Quaternary: Duration (lower is better)
-            return a.duration < b.duration;
+            return raceTime(a) < raceTime(b);
         });
         
         QVariantList rankings;
@@ -1577,8 +2711,7 @@ void NetworkManager::checkRaceCompletion() {
             
             // Calculate synchronized duration from host's clock
             // This ensures all clients see consistent timing
-            double syncDuration = m_raceStartTime > 0 ? 
-                (player.finishTime - m_raceStartTime) / 1000.0 : player.duration;
+            double syncDuration = raceTime(player) / 1000.0;
             map["duration"] = syncDuration;
             
             // Position follows WPM-based ranking order (1, 2, 3...)
@@ -1621,12 +2754,7 @@ QVariantList NetworkManager::players() const {
         QVariantMap map;
         map["id"] = player.uuid;
         map["name"] = player.name;
-        // A player is the host if they are the room creator (m_hostUuid)
-        // If we know the hostUuid, compare against it; otherwise for self-check use m_isRoomCreator
-        bool isPlayerHost = (m_hostUuid.isEmpty()) 
-            ? (player.uuid == m_playerId && m_isRoomCreator)
-            : (player.uuid == m_hostUuid);
-        map["isHost"] = isPlayerHost;
+        map["isHost"] = isHostPlayer(player.uuid);
         map["isLocal"] = (player.uuid == m_playerId);
         map["progress"] = player.totalChars > 0 ? 
                          static_cast<double>(player.position) / player.totalChars : 0.0;
@@ -1638,12 +2766,69 @@ QVariantList NetworkManager::players() const {
     return list;
 }
 
+bool NetworkManager::isHostPlayer(const QString& uuid) const {
+    // A player is the host if they are the room creator (m_hostUuid)
+    // If we know the hostUuid, compare against it; otherwise for self-check use m_isRoomCreator
+    return m_hostUuid.isEmpty()
+        ? (uuid == m_playerId && m_isRoomCreator)
+        : (uuid == m_hostUuid);
+}
+
+void NetworkManager::stagePlayer(const QString& uuid) {
+    auto it = m_players.constFind(uuid);
+    if (it == m_players.constEnd()) {
+        m_playersModel->removePlayer(uuid);
+        return;
+    }
+    
+    const PlayerInfo& info = it.value();
+    PlayersModel::Player player;
+    player.uuid = info.uuid;
+    player.name = info.name;
+    player.isHost = isHostPlayer(info.uuid);
+    player.isLocal = (info.uuid == m_playerId);
+    player.progress = info.totalChars > 0 ?
+                      static_cast<double>(info.position) / info.totalChars : 0.0;
+    player.wpm = info.wpm;
+    player.finished = info.finished;
+    player.position = info.racePosition;
+    m_playersModel->setPlayer(player);
+}
+
+void NetworkManager::syncPlayersModel() {
+    const QStringList modelIds = m_playersModel->playerIds();
+    for (const QString& uuid : modelIds) {
+        if (!m_players.contains(uuid)) {
+            m_playersModel->removePlayer(uuid);
+        }
+    }
+    for (auto it = m_players.constBegin(); it != m_players.constEnd(); ++it) {
+        stagePlayer(it.key());
+    }
+}
+
 void NetworkManager::setPlayerName(const QString& name) {
     if (m_playerName == name) return;
     m_playerName = name;
     emit playerNameChanged();
 }
 
+void NetworkManager::setStarTopology(bool star) {
+    if (m_starTopology == star) return;
+    if (!m_peers.isEmpty()) {
+        qDebug() << "[NetworkManager] Topology can only change while no peers are connected";
+        return;
+    }
+    
+    m_starTopology = star;
+    emit topologyChanged();
+    qDebug() << "[NetworkManager] Topology:" << (star ? "star" : "mesh");
+    
+    if (m_isInLobby && m_isRoomCreator) {
+        sendAnnounce();  // Advertise the new player limit right away
+    }
+}
+
 void NetworkManager::setConnectionError(const QString& error) {
     m_connectionError = error;
     emit connectionErrorChanged();
@@ -1659,6 +2844,7 @@ void NetworkManager::resetState() {
     m_hostUuid.clear();
     m_players.clear();
     m_gameText.clear();
+    m_textSeed = TextSeed();
     m_currentPosition = 0;
     m_currentTotal = 0;
     m_currentWpm = 0;
@@ -1666,6 +2852,15 @@ void NetworkManager::resetState() {
     m_finishedCount = 0;
     m_pendingConnections.clear();
     m_rankings.clear();
+    m_localIndex = NO_INDEX;
+    m_nextPeerIndex = 1;
+    m_indexToUuid.clear();
+    m_warnedUnknownSender = false;
+    if (m_starTopology) {
+        m_starTopology = false;
+        emit topologyChanged();
+    }
+    closeDataChannel();
     
     // Ready check state
     m_isWaitingForReady = false;
@@ -1675,6 +2870,12 @@ void NetworkManager::resetState() {
     }
     
     m_progressTimer->stop();
+    m_raceStartTimer->stop();
+    m_timeSyncTimer->stop();
+    m_timeSyncRemaining = 0;
+    m_raceStartTime = 0;
+    m_hostClockOffsetUs = 0;
+    m_hostRttUs = 0;
     
     emit authorityChanged();
     emit connectionChanged();
@@ -1687,6 +2888,10 @@ void NetworkManager::resetState() {
     emit rankingsChanged();
 }
 
+void NetworkManager::setMaxFrameSize(quint32 bytes) {
+    m_maxFrameBytes = qMax<quint32>(bytes, 64);
+}
+
 void NetworkManager::setSelectedInterface(const QString& ip) {
     if (m_selectedInterface == ip) return;
     
@@ -1694,6 +2899,7 @@ void NetworkManager::setSelectedInterface(const QString& ip) {
     emit selectedInterfaceChanged();
     
     qDebug() << "[NetworkManager] Selected interface:" << (ip.isEmpty() ? "All interfaces" : ip);
+    resolveBroadcastAddress();
     
     // If already hosting, restart announcing on new interface
     if (m_isInLobby && m_isAuthority) {
@@ -1729,6 +2935,8 @@ void NetworkManager::returnToLobby() {
     
     // Stop progress timer
     m_progressTimer->stop();
+    m_raceStartTimer->stop();
+    m_raceStartTime = 0;
     
     // Clear rankings
     m_rankings.clear();
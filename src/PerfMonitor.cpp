@@ -0,0 +1,267 @@
+#include "PerfMonitor.h"
+#include <QQuickWindow>
+#include <QtAlgorithms>
+#include <algorithm>
+#include <cmath>
+
+std::atomic<bool> PerfMonitor::s_active{false};
+
+// ============================================================================
+// LATENCY HISTOGRAM
+// ============================================================================
+
+int LatencyHistogram::bucketOf(uint64_t valueUs) {
+    if (valueUs < SUB_BUCKETS) return static_cast<int>(valueUs);
+
+    // Bucket = (power of two, top SUB_BITS bits below the leading one)
+    const int msb = qMin(63 - qCountLeadingZeroBits(valueUs), MAX_BIT);
+    const uint64_t mantissa = (qMin(valueUs, (uint64_t(1) << (MAX_BIT + 1)) - 1)
+                               >> (msb - SUB_BITS)) & (SUB_BUCKETS - 1);
+    return (msb - SUB_BITS + 1) * SUB_BUCKETS + static_cast<int>(mantissa);
+}
+
+uint64_t LatencyHistogram::bucketMidpoint(int bucket) {
+    if (bucket < SUB_BUCKETS) return static_cast<uint64_t>(bucket);
+
+    const int shift = bucket / SUB_BUCKETS - 1;
+    const uint64_t lower = uint64_t(SUB_BUCKETS + bucket % SUB_BUCKETS) << shift;
+    return lower + ((uint64_t(1) << shift) >> 1);
+}
+
+void LatencyHistogram::record(uint64_t valueUs) {
+    ++m_buckets[bucketOf(valueUs)];
+    ++m_count;
+    m_sum += valueUs;
+    m_max = qMax(m_max, valueUs);
+}
+
+void LatencyHistogram::reset() {
+    m_buckets.fill(0);
+    m_count = 0;
+    m_sum = 0;
+    m_max = 0;
+}
+
+uint64_t LatencyHistogram::percentileUs(double quantile) const {
+    if (m_count == 0) return 0;
+
+    const uint64_t rank = qMax<uint64_t>(1, static_cast<uint64_t>(std::ceil(quantile * m_count)));
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < BUCKETS; ++bucket) {
+        seen += m_buckets[bucket];
+        if (seen >= rank) return qMin(bucketMidpoint(bucket), m_max);
+    }
+    return m_max;
+}
+
+QVariantMap LatencyHistogram::summary() const {
+    QVariantMap map;
+    map["count"] = static_cast<qulonglong>(m_count);
+    map["mean"] = meanUs() / 1000.0;
+    map["p50"] = percentileUs(0.50) / 1000.0;
+    map["p90"] = percentileUs(0.90) / 1000.0;
+    map["p99"] = percentileUs(0.99) / 1000.0;
+    map["max"] = m_max / 1000.0;
+    return map;
+}
+
+// ============================================================================
+// PERF MONITOR
+// ============================================================================
+
+PerfMonitor* PerfMonitor::instance() {
+    static PerfMonitor* monitor = new PerfMonitor();
+    return monitor;
+}
+
+PerfMonitor::PerfMonitor(QObject* parent)
+    : QObject(parent)
+{
+    m_clock.start();
+    m_drainTimer.setInterval(DRAIN_INTERVAL_MS);
+    connect(&m_drainTimer, &QTimer::timeout, this, &PerfMonitor::flush);
+}
+
+PerfMonitor::~PerfMonitor() {
+    flush();
+}
+
+void PerfMonitor::setEnabled(bool enabled) {
+    if (active() == enabled) return;
+
+    s_active.store(enabled, std::memory_order_relaxed);
+    m_pendingKeyUs.store(0);
+    m_lastSwapUs.store(0);
+
+    if (enabled) {
+        m_drainTimer.start();
+        if (m_window) {
+            // Emitted on the render thread; recording there is lock-free
+            m_swapConnection = connect(m_window, &QQuickWindow::frameSwapped,
+                                       this, &PerfMonitor::onFrameSwapped, Qt::DirectConnection);
+        }
+    } else {
+        disconnect(m_swapConnection);
+        m_drainTimer.stop();
+        flush();
+        updateStats();  // Final numbers include the last drain
+    }
+
+    qDebug() << "[PerfMonitor]" << (enabled ? "Enabled" : "Disabled");
+    emit enabledChanged();
+}
+
+void PerfMonitor::attachWindow(QQuickWindow* window) {
+    disconnect(m_swapConnection);
+    m_window = window;
+    if (m_window && active()) {
+        m_swapConnection = connect(m_window, &QQuickWindow::frameSwapped,
+                                   this, &PerfMonitor::onFrameSwapped, Qt::DirectConnection);
+    }
+}
+
+bool PerfMonitor::setLogFile(const QString& path) {
+    m_log.close();
+    m_log.setFileName(path);
+    if (!m_log.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        qWarning() << "[PerfMonitor] Cannot open perf log" << path << ":" << m_log.errorString();
+        return false;
+    }
+
+    m_log.write("time_us,metric,key,value_us\n");
+    qDebug() << "[PerfMonitor] Logging samples to" << path;
+    setEnabled(true);
+    return true;
+}
+
+// ============================================================================
+// RECORDING
+// ============================================================================
+
+template <uint32_t N>
+void PerfMonitor::push(SpscRing<Sample, N>& ring, Metric metric, qint64 valueUs, quint8 key) {
+    Sample sample;
+    sample.timeUs = nowUs();
+    sample.valueUs = static_cast<quint32>(qBound<qint64>(0, valueUs, 0xFFFFFFFF));
+    sample.metric = metric;
+    sample.key = key;
+    ring.push(sample);
+}
+
+void PerfMonitor::markKeystroke() {
+    if (!active()) return;
+
+    // Keep the oldest keystroke that has not reached the screen yet
+    qint64 none = 0;
+    m_pendingKeyUs.compare_exchange_strong(none, qMax<qint64>(1, nowUs()));
+}
+
+void PerfMonitor::onFrameSwapped() {
+    const qint64 now = nowUs();
+
+    if (const qint64 key = m_pendingKeyUs.exchange(0)) {
+        push(m_renderRing, KeyToFrame, now - key);
+    }
+    if (const qint64 last = m_lastSwapUs.exchange(now)) {
+        push(m_renderRing, FrameInterval, now - last);
+    }
+}
+
+void PerfMonitor::recordPacketDispatch(quint8 packetType, qint64 elapsedUs) {
+    if (!active()) return;
+    push(m_guiRing, PacketDispatch, elapsedUs, packetType);
+}
+
+void PerfMonitor::recordRtt(qint64 rttUs) {
+    if (!active() || rttUs < 0) return;
+    push(m_guiRing, PeerRtt, rttUs);
+}
+
+void PerfMonitor::reset() {
+    flush();
+    for (auto& histogram : m_histograms) histogram.reset();
+    for (auto& histogram : m_packetHistograms) histogram.reset();
+    m_dropped = 0;
+    updateStats();
+}
+
+// ============================================================================
+// DRAIN & STATS
+// ============================================================================
+
+const char* PerfMonitor::metricName(quint8 metric) {
+    switch (metric) {
+        case KeyToFrame:     return "key_to_frame";
+        case FrameInterval:  return "frame_interval";
+        case PacketDispatch: return "packet_dispatch";
+        case PeerRtt:        return "peer_rtt";
+        default:             return "unknown";
+    }
+}
+
+void PerfMonitor::setPacketTypes(const QMetaEnum& packetTypes) {
+    m_packetTypes = packetTypes;
+}
+
+QByteArray PerfMonitor::packetTypeName(quint8 packetType) const {
+    const char* name = m_packetTypes.isValid() ? m_packetTypes.valueToKey(packetType) : nullptr;
+    return name ? QByteArray(name) : QByteArray::number(packetType);
+}
+
+void PerfMonitor::flush() {
+    QByteArray csv;
+
+    auto consume = [&](const Sample& sample) {
+        if (sample.metric >= MetricCount) return;
+        m_histograms[sample.metric].record(sample.valueUs);
+        if (sample.metric == PacketDispatch && sample.key < MAX_PACKET_TYPES) {
+            m_packetHistograms[sample.key].record(sample.valueUs);
+        }
+
+        if (m_log.isOpen()) {
+            csv += QByteArray::number(sample.timeUs) + ',' + metricName(sample.metric) + ',';
+            if (sample.metric == PacketDispatch) {
+                csv += packetTypeName(sample.key);
+            }
+            csv += ',' + QByteArray::number(sample.valueUs) + '\n';
+        }
+    };
+    m_guiRing.drain(consume);
+    m_renderRing.drain(consume);
+    m_dropped += m_guiRing.takeDropped() + m_renderRing.takeDropped();
+
+    if (!csv.isEmpty()) {
+        m_log.write(csv);
+        m_log.flush();
+    }
+
+    if (++m_drainCount % STATS_EVERY_DRAINS == 0) {
+        updateStats();
+    }
+}
+
+void PerfMonitor::updateStats() {
+    QVariantMap stats;
+    stats["keyToFrame"] = m_histograms[KeyToFrame].summary();
+    stats["frameInterval"] = m_histograms[FrameInterval].summary();
+    stats["packetDispatch"] = m_histograms[PacketDispatch].summary();
+    stats["peerRtt"] = m_histograms[PeerRtt].summary();
+    stats["dropped"] = static_cast<qulonglong>(m_dropped);
+
+    // Per-type dispatch, busiest first
+    QVariantList packets;
+    for (int type = 0; type < MAX_PACKET_TYPES; ++type) {
+        const LatencyHistogram& histogram = m_packetHistograms[type];
+        if (histogram.count() == 0) continue;
+        QVariantMap entry = histogram.summary();
+        entry["type"] = QString::fromLatin1(packetTypeName(type));
+        packets.append(entry);
+    }
+    std::sort(packets.begin(), packets.end(), [](const QVariant& a, const QVariant& b) {
+        return a.toMap()["count"].toULongLong() > b.toMap()["count"].toULongLong();
+    });
+    stats["packets"] = packets;
+
+    m_stats = stats;
+    emit statsChanged();
+}
@@ -0,0 +1,319 @@
+/**
+ * @file PersistenceService.cpp
+ * @brief Implementasi PersistenceService (debounce + worker thread + atomic write)
+ * @author Alea Farrel & Team
+ * @date 2025
+ *
+ * @section flow Alur Penulisan
+ * 1. Manager (SettingsManager, ProgressManager, HistoryManager) memanggil
+ *    scheduleWrite() dengan serializer yang menangkap snapshot datanya
+ * 2. Worker menunggu sampai jendela debounce lewat (atau flush() dipanggil)
+ * 3. Serializer dipanggil di worker, hasilnya ditulis ke path.tmp,
+ *    di-sync ke disk, lalu di-rename menimpa file lama
+ *
+ * Crash di tengah penulisan paling buruk meninggalkan file .tmp; file
+ * lama tetap utuh.
+ */
+
+#include "PersistenceService.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sys/stat.h>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <shlobj.h>
+#include <direct.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// ============================================================================
+// HELPER FUNCTIONS (Static)
+// ============================================================================
+
+/**
+ * @brief Membuat direktori jika belum ada
+ * @return true jika direktori sudah ada atau berhasil dibuat
+ */
+static bool ensureDirectoryExists(const std::string& path) {
+#ifdef _WIN32
+    struct _stat st;
+    if (_stat(path.c_str(), &st) != 0) {
+        return _mkdir(path.c_str()) == 0;
+    }
+    return (st.st_mode & _S_IFDIR) != 0;
+#else
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+        return mkdir(path.c_str(), 0755) == 0;
+    }
+    return S_ISDIR(st.st_mode);
+#endif
+}
+
+/**
+ * @brief Flush buffer stdio dan paksa data sampai ke disk
+ */
+static bool syncFile(std::FILE* file) {
+    if (std::fflush(file) != 0) return false;
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+std::string PersistenceService::dataDirectory() {
+    // Dihitung sekali; inisialisasi static lokal thread-safe
+    static const std::string directory = []() -> std::string {
+#ifdef _WIN32
+        char appDataPath[MAX_PATH];
+        if (SUCCEEDED(SHGetFolderPathA(NULL, CSIDL_APPDATA, NULL, 0, appDataPath))) {
+            std::string dataDir = std::string(appDataPath) + "\\RapidTexter";
+            ensureDirectoryExists(dataDir);
+            return dataDir + "\\";
+        }
+        // Fallback ke current directory
+        return "";
+#else
+        const char* xdgDataHome = std::getenv("XDG_DATA_HOME");
+        std::string baseDir;
+
+        if (xdgDataHome && xdgDataHome[0] != '\0') {
+            baseDir = std::string(xdgDataHome);
+        } else {
+            const char* home = std::getenv("HOME");
+            if (home) {
+                baseDir = std::string(home) + "/.local/share";
+            } else {
+                // Fallback ke current directory
+                return "";
+            }
+        }
+
+        ensureDirectoryExists(baseDir);
+        std::string dataDir = baseDir + "/RapidTexter";
+        ensureDirectoryExists(dataDir);
+        return dataDir + "/";
+#endif
+    }();
+    return directory;
+}
+
+bool PersistenceService::replaceFile(const std::string& from, const std::string& to) {
+#ifdef _WIN32
+    return MoveFileExA(from.c_str(), to.c_str(),
+                       MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+// ============================================================================
+// LIFECYCLE
+// ============================================================================
+
+PersistenceService& PersistenceService::instance() {
+    static PersistenceService service;
+    return service;
+}
+
+PersistenceService::PersistenceService() : worker(&PersistenceService::run, this) {}
+
+/**
+ * @brief Menulis sisa antrian lalu menghentikan worker
+ *
+ * Cadangan jika flush() tidak sempat dipanggil (misalnya exit tanpa
+ * aboutToQuit): destructor static tetap menulis semua data tertunda.
+ */
+PersistenceService::~PersistenceService() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    worker.join();
+}
+
+// ============================================================================
+// SCHEDULING
+// ============================================================================
+
+void PersistenceService::scheduleWrite(const std::string& path, Serializer serializer,
+                                       int debounceMs) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        PendingFile& file = pending[path];
+        const Clock::time_point due = Clock::now() + std::chrono::milliseconds(debounceMs);
+
+        // Jendela dihitung dari perubahan pertama, jadi perubahan beruntun
+        // tidak menunda penulisan tanpa batas
+        file.due = file.serializer ? std::min(file.due, due) : due;
+        file.serializer = std::move(serializer);
+
+        // Snapshot baru sudah mencakup append sebelumnya (dan menggantikan
+        // file yang akan dihapus)
+        file.appendBytes.clear();
+        file.remove = false;
+    }
+    wake.notify_one();
+}
+
+void PersistenceService::scheduleAppend(const std::string& path, std::string bytes,
+                                        std::string headerIfEmpty) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        PendingFile& file = pending[path];
+        file.appendBytes += bytes;
+        file.appendHeader = std::move(headerIfEmpty);
+    }
+    wake.notify_one();
+}
+
+void PersistenceService::scheduleRemove(const std::string& path) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        PendingFile& file = pending[path];
+        file.serializer = nullptr;
+        file.appendBytes.clear();
+        file.remove = true;
+    }
+    wake.notify_one();
+}
+
+bool PersistenceService::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    const unsigned failuresBefore = failures;
+
+    ++flushRequests;
+    wake.notify_one();
+    idle.wait(lock, [this] { return pending.empty() && inFlight == 0; });
+    --flushRequests;
+
+    return failures == failuresBefore;
+}
+
+// ============================================================================
+// WORKER
+// ============================================================================
+
+/**
+ * @brief Loop worker: ambil file yang sudah jatuh tempo, tulis tanpa lock
+ *
+ * Append dan remove tanpa write tertunda langsung jatuh tempo. Saat flush() atau
+ * shutdown, debounce diabaikan.
+ */
+void PersistenceService::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        const Clock::time_point now = Clock::now();
+        const bool urgent = flushRequests > 0 || stopping;
+        Clock::time_point nextDue = Clock::time_point::max();
+        std::vector<std::pair<std::string, PendingFile>> batch;
+
+        for (auto it = pending.begin(); it != pending.end();) {
+            const PendingFile& file = it->second;
+            if (urgent || !file.serializer || file.due <= now) {
+                batch.emplace_back(it->first, std::move(it->second));
+                it = pending.erase(it);
+            } else {
+                nextDue = std::min(nextDue, file.due);
+                ++it;
+            }
+        }
+
+        if (!batch.empty()) {
+            ++inFlight;
+            lock.unlock();
+
+            unsigned failed = 0;
+            for (const auto& [path, file] : batch) {
+                if (file.remove && !removeFile(path)) ++failed;
+                if (file.serializer && !writeFile(path, file.serializer())) ++failed;
+                if (!file.appendBytes.empty() &&
+                    !appendFile(path, file.appendBytes, file.appendHeader)) ++failed;
+            }
+
+            lock.lock();
+            --inFlight;
+            failures += failed;
+            if (pending.empty() && inFlight == 0) idle.notify_all();
+            continue;
+        }
+
+        if (pending.empty()) {
+            idle.notify_all();
+            if (stopping) break;
+            wake.wait(lock);
+        } else {
+            wake.wait_until(lock, nextDue);
+        }
+    }
+}
+
+/**
+ * @brief Tulis file secara atomik: path.tmp -> sync -> rename
+ */
+bool PersistenceService::writeFile(const std::string& path, const std::string& data) {
+    const std::string tempPath = path + ".tmp";
+    std::FILE* file = std::fopen(tempPath.c_str(), "wb");
+    if (!file) {
+        std::cerr << "Failed to save " << path << std::endl;
+        return false;
+    }
+
+    bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok = syncFile(file) && ok;
+    ok = std::fclose(file) == 0 && ok;
+
+    if (!ok || !replaceFile(tempPath, path)) {
+        std::cerr << "Failed to save " << path << std::endl;
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Append byte ke file, menulis header lebih dulu jika file kosong
+ */
+bool PersistenceService::appendFile(const std::string& path, const std::string& bytes,
+                                    const std::string& header) {
+    std::FILE* file = std::fopen(path.c_str(), "ab");
+    if (!file) {
+        std::cerr << "Failed to append to " << path << std::endl;
+        return false;
+    }
+
+    bool ok = true;
+    std::fseek(file, 0, SEEK_END);
+    if (!header.empty() && std::ftell(file) == 0) {
+        ok = std::fwrite(header.data(), 1, header.size(), file) == header.size();
+    }
+    ok = ok && std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    ok = syncFile(file) && ok;
+    ok = std::fclose(file) == 0 && ok;
+
+    if (!ok) {
+        std::cerr << "Failed to append to " << path << std::endl;
+    }
+    return ok;
+}
+
+/**
+ * @brief Hapus file; file yang sudah tidak ada dianggap berhasil
+ */
+bool PersistenceService::removeFile(const std::string& path) {
+    if (std::remove(path.c_str()) != 0 && errno != ENOENT) {
+        std::cerr << "Failed to remove " << path << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,280 @@
+#include "PlayersModel.h"
+#include <QDateTime>
+
+PlayersModel::PlayersModel(QObject* parent)
+    : QAbstractListModel(parent)
+{
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(FLUSH_INTERVAL_MS);
+    connect(&m_flushTimer, &QTimer::timeout, this, &PlayersModel::flush);
+}
+
+// ============================================================================
+// QABSTRACTLISTMODEL INTERFACE
+// ============================================================================
+
+int PlayersModel::rowCount(const QModelIndex& parent) const {
+    if (parent.isValid()) return 0;
+    return m_rows.size();
+}
+
+QVariant PlayersModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() < 0 || index.row() >= m_rows.size()) {
+        return QVariant();
+    }
+
+    const Row& row = m_rows.at(index.row());
+    const Player& player = row.player;
+    switch (role) {
+        case PlayerIdRole: return player.uuid;
+        case NameRole:     return player.name;
+        case IsHostRole:   return player.isHost;
+        case IsLocalRole:  return player.isLocal;
+        case ProgressRole: return player.progress;
+        case WpmRole:      return player.wpm;
+        case FinishedRole: return player.finished;
+        case PositionRole: return player.position;
+        case SmoothProgressRole: return row.smoothProgress;
+        default:           return QVariant();
+    }
+}
+
+QHash<int, QByteArray> PlayersModel::roleNames() const {
+    return {
+        { PlayerIdRole, "playerId" },
+        { NameRole, "name" },
+        { IsHostRole, "isHost" },
+        { IsLocalRole, "isLocal" },
+        { ProgressRole, "progress" },
+        { WpmRole, "wpm" },
+        { FinishedRole, "finished" },
+        { PositionRole, "position" },
+        { SmoothProgressRole, "smoothProgress" }
+    };
+}
+
+// ============================================================================
+// STAGED UPDATES
+// ============================================================================
+
+void PlayersModel::setPlayer(const Player& player) {
+    m_pendingRemovals.remove(player.uuid);
+    if (!m_pending.contains(player.uuid)) {
+        m_pendingOrder.append(player.uuid);
+    }
+    m_pending[player.uuid] = player;
+    scheduleFlush();
+}
+
+void PlayersModel::removePlayer(const QString& uuid) {
+    if (m_pending.remove(uuid)) {
+        m_pendingOrder.removeOne(uuid);
+    }
+    if (m_rowByUuid.contains(uuid)) {
+        m_pendingRemovals.insert(uuid);
+        scheduleFlush();
+    }
+}
+
+bool PlayersModel::contains(const QString& uuid) const {
+    if (m_pendingRemovals.contains(uuid)) return false;
+    return m_rowByUuid.contains(uuid) || m_pending.contains(uuid);
+}
+
+QStringList PlayersModel::playerIds() const {
+    QStringList ids;
+    for (const Row& row : m_rows) {
+        if (!m_pendingRemovals.contains(row.player.uuid)) {
+            ids.append(row.player.uuid);
+        }
+    }
+    for (const QString& uuid : m_pendingOrder) {
+        if (!m_rowByUuid.contains(uuid)) {
+            ids.append(uuid);
+        }
+    }
+    return ids;
+}
+
+void PlayersModel::scheduleFlush() {
+    // Coalesce everything staged within one frame into a single flush
+    if (!m_flushTimer.isActive()) {
+        m_flushTimer.start();
+    }
+}
+
+void PlayersModel::flush() {
+    m_flushTimer.stop();
+    const int countBefore = m_rows.size();
+
+    // Removals, back to front so earlier row numbers stay valid
+    if (!m_pendingRemovals.isEmpty()) {
+        for (int row = m_rows.size() - 1; row >= 0; --row) {
+            if (m_pendingRemovals.contains(m_rows.at(row).player.uuid)) {
+                beginRemoveRows(QModelIndex(), row, row);
+                m_rows.removeAt(row);
+                endRemoveRows();
+            }
+        }
+        m_pendingRemovals.clear();
+        rebuildIndex();
+    }
+
+    // Updates and inserts
+    for (const QString& uuid : std::as_const(m_pendingOrder)) {
+        const Player& next = m_pending[uuid];
+        auto existing = m_rowByUuid.constFind(uuid);
+
+        if (existing == m_rowByUuid.constEnd()) {
+            const int row = m_rows.size();
+            beginInsertRows(QModelIndex(), row, row);
+            Row inserted;
+            inserted.player = next;
+            inserted.smoothProgress = next.progress;
+            m_rows.append(inserted);
+            m_rowByUuid.insert(uuid, row);
+            endInsertRows();
+            continue;
+        }
+
+        const int row = existing.value();
+        Row& target = m_rows[row];
+        Player& current = target.player;
+        QList<int> changed;
+        if (current.name != next.name) changed.append(NameRole);
+        if (current.isHost != next.isHost) changed.append(IsHostRole);
+        if (current.isLocal != next.isLocal) changed.append(IsLocalRole);
+        if (current.progress != next.progress) changed.append(ProgressRole);
+        if (current.wpm != next.wpm) changed.append(WpmRole);
+        if (current.finished != next.finished) changed.append(FinishedRole);
+        if (current.position != next.position) changed.append(PositionRole);
+
+        // A new race (returnToLobby/startCountdown reset progress and the
+        // finished flag) invalidates the interpolation buffer. The progress-0
+        // sample addSample() would reset on travels over the unreliable data
+        // channel and can be lost, so the staged state decides here
+        const bool restarted = (current.finished && !next.finished) ||
+                               (next.progress <= 0.0 && current.progress > 0.0);
+        if (restarted) {
+            target.samples.clear();
+        }
+
+        // Without samples (local player, lobby, finished) there is nothing to
+        // interpolate: the smoothed value follows the real one directly
+        const bool direct = target.samples.isEmpty() || next.finished;
+        if (direct && target.smoothProgress != next.progress) {
+            target.smoothProgress = next.progress;
+            changed.append(SmoothProgressRole);
+        }
+
+        if (!changed.isEmpty()) {
+            current = next;
+            const QModelIndex idx = index(row);
+            emit dataChanged(idx, idx, changed);
+        }
+    }
+    m_pending.clear();
+    m_pendingOrder.clear();
+
+    if (m_rows.size() != countBefore) {
+        emit countChanged();
+    }
+}
+
+void PlayersModel::clear() {
+    m_flushTimer.stop();
+    m_pending.clear();
+    m_pendingOrder.clear();
+    m_pendingRemovals.clear();
+
+    if (m_rows.isEmpty()) return;
+
+    beginResetModel();
+    m_rows.clear();
+    m_rowByUuid.clear();
+    endResetModel();
+    emit countChanged();
+}
+
+void PlayersModel::rebuildIndex() {
+    m_rowByUuid.clear();
+    for (int row = 0; row < m_rows.size(); ++row) {
+        m_rowByUuid.insert(m_rows.at(row).player.uuid, row);
+    }
+}
+
+// ============================================================================
+// INTERPOLATION
+// ============================================================================
+
+void PlayersModel::addSample(const QString& uuid, qint64 senderTimeMs, double progress) {
+    auto it = m_rowByUuid.constFind(uuid);
+    if (it == m_rowByUuid.constEnd()) return;
+
+    Row& row = m_rows[it.value()];
+
+    // A new race (or a reset) starts over from zero
+    if (!row.samples.isEmpty() && progress < row.samples.last().progress && progress <= 0.0) {
+        row.samples.clear();
+    }
+    if (!row.samples.isEmpty() && senderTimeMs <= row.samples.last().time) {
+        return;  // Reordered or duplicate
+    }
+
+    // Track the lowest observed (receive - send) difference: it absorbs the
+    // sender's clock skew plus the minimum network delay
+    const qint64 offset = QDateTime::currentMSecsSinceEpoch() - senderTimeMs;
+    if (!row.hasClockOffset || offset < row.clockOffsetMs) {
+        row.clockOffsetMs = offset;
+        row.hasClockOffset = true;
+    } else {
+        row.clockOffsetMs += 1;  // Slow upward drift so clock changes are followed
+    }
+
+    row.samples.append({ senderTimeMs, progress });
+    if (row.samples.size() > MAX_SAMPLES) {
+        row.samples.removeFirst();
+    }
+}
+
+void PlayersModel::advance() {
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+
+    for (int i = 0; i < m_rows.size(); ++i) {
+        Row& row = m_rows[i];
+        if (row.samples.isEmpty() || row.player.finished) continue;
+
+        // Render slightly in the past so there is usually a sample on each side
+        const qint64 renderTime = now - row.clockOffsetMs - INTERPOLATION_DELAY_MS;
+        const QList<Sample>& samples = row.samples;
+        double value;
+
+        if (renderTime <= samples.first().time) {
+            value = samples.first().progress;
+        } else if (renderTime >= samples.last().time) {
+            // Late sample: extrapolate from the last velocity for a short while
+            value = samples.last().progress;
+            if (samples.size() >= 2) {
+                const Sample& a = samples.at(samples.size() - 2);
+                const Sample& b = samples.last();
+                const double velocity = (b.progress - a.progress) / double(b.time - a.time);
+                const qint64 ahead = qMin<qint64>(renderTime - b.time, MAX_EXTRAPOLATION_MS);
+                value += qMax(0.0, velocity) * ahead;
+            }
+        } else {
+            int j = samples.size() - 1;
+            while (j > 0 && samples.at(j - 1).time > renderTime) --j;
+            const Sample& a = samples.at(j - 1);
+            const Sample& b = samples.at(j);
+            const double t = double(renderTime - a.time) / double(b.time - a.time);
+            value = a.progress + (b.progress - a.progress) * t;
+        }
+
+        value = qBound(0.0, value, 1.0);
+        if (qAbs(value - row.smoothProgress) > 1e-4) {
+            row.smoothProgress = value;
+            const QModelIndex idx = index(i);
+            emit dataChanged(idx, idx, { SmoothProgressRole });
+        }
+    }
+}
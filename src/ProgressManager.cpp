@@ -47,107 +47,9 @@
  */
 
 #include "ProgressManager.h"
+#include "PersistenceService.h"
 #include <fstream>
 #include <sstream>
-#include <iostream>
-#include <cstdlib>  // untuk getenv
-#include <sys/stat.h>  // untuk stat
-
-#ifdef _WIN32
-#include <windows.h>
-#include <shlobj.h>  // untuk SHGetFolderPath
-#include <direct.h>  // untuk _mkdir
-#endif
-
-// ============================================================================
-// HELPER FUNCTIONS (Static)
-// ============================================================================
-
-/**
- * @brief Membuat direktori jika belum ada
- * 
- * Helper function cross-platform untuk memastikan direktori
- * penyimpanan data sudah ada sebelum menulis file.
- * 
- * @param path Path ke direktori yang akan dibuat
- * @return true jika direktori sudah ada atau berhasil dibuat
- * @return false jika gagal membuat direktori
- * 
- * @par Windows Implementation
- * Menggunakan _stat() untuk cek dan _mkdir() untuk buat.
- * 
- * @par Linux Implementation
- * Menggunakan stat() untuk cek dan mkdir() dengan permission 0755.
- */
-static bool ensureDirectoryExists(const std::string& path) {
-#ifdef _WIN32
-    // Windows: gunakan _mkdir
-    struct _stat st;
-    if (_stat(path.c_str(), &st) != 0) {
-        return _mkdir(path.c_str()) == 0;
-    }
-    return (st.st_mode & _S_IFDIR) != 0;
-#else
-    // Linux/macOS: gunakan mkdir
-    struct stat st;
-    if (stat(path.c_str(), &st) != 0) {
-        return mkdir(path.c_str(), 0755) == 0;
-    }
-    return S_ISDIR(st.st_mode);
-#endif
-}
-
-/**
- * @brief Mendapatkan path direktori data aplikasi sesuai platform
- * 
- * @return std::string Path ke direktori data dengan trailing separator
- * 
- * @par Windows
- * Menggunakan CSIDL_APPDATA yang mengarah ke:
- * C:\\Users\\{username}\\AppData\\Roaming\\RapidTexter\\
- * 
- * @par Linux/macOS
- * Mengikuti XDG Base Directory Specification:
- * - Jika XDG_DATA_HOME di-set: $XDG_DATA_HOME/RapidTexter/
- * - Jika tidak: ~/.local/share/RapidTexter/
- * 
- * @note Direktori akan otomatis dibuat jika belum ada
- */
-static std::string getDataDirectory() {
-#ifdef _WIN32
-    // Windows: gunakan %APPDATA%
-    char appDataPath[MAX_PATH];
-    if (SUCCEEDED(SHGetFolderPathA(NULL, CSIDL_APPDATA, NULL, 0, appDataPath))) {
-        std::string dataDir = std::string(appDataPath) + "\\RapidTexter";
-        ensureDirectoryExists(dataDir);
-        return dataDir + "\\";
-    }
-    // Fallback ke current directory
-    return "";
-#else
-    // Linux: gunakan XDG_DATA_HOME atau ~/.local/share
-    const char* xdgDataHome = std::getenv("XDG_DATA_HOME");
-    std::string baseDir;
-    
-    if (xdgDataHome && xdgDataHome[0] != '\0') {
-        baseDir = std::string(xdgDataHome);
-    } else {
-        const char* home = std::getenv("HOME");
-        if (home) {
-            baseDir = std::string(home) + "/.local/share";
-        } else {
-            // Fallback ke current directory
-            return "";
-        }
-    }
-    
-    // Buat directory jika belum ada
-    ensureDirectoryExists(baseDir);
-    std::string dataDir = baseDir + "/RapidTexter";
-    ensureDirectoryExists(dataDir);
-    return dataDir + "/";
-#endif
-}
 
 // ============================================================================
 // CONSTRUCTOR
@@ -159,20 +61,22 @@ static std::string getDataDirectory() {
  * Proses inisialisasi:
  * 1. Menentukan path file progress.json
  * 2. Inisialisasi default progress untuk bahasa ID dan EN
- * 3. Load progress yang sudah ada dari file (jika ada)
+ * 3. Load progress yang sudah ada dari file (jika autoLoad = true)
  * 
  * @note Progress hanya di-track untuk bahasa ID dan EN.
  *       "prog" adalah mode, bukan bahasa terpisah, jadi certification
  *       nya disimpan di bahasa yang dipilih user (ID/EN).
  */
-ProgressManager::ProgressManager() : filename(getDataDirectory() + "progress.json") {
+ProgressManager::ProgressManager(bool autoLoad) : filename(PersistenceService::dataDirectory() + "progress.json") {
     // Initialize default progress HANYA untuk bahasa sebenarnya (id, en)
     // "prog" bukan bahasa melainkan mode (Programmer Mode)
     progressData["id"] = LanguageProgress();
     progressData["en"] = LanguageProgress();
     
     // Load existing progress jika ada
-    loadProgress();
+    if (autoLoad) {
+        loadProgress();
+    }
 }
 
 // ============================================================================
@@ -284,26 +188,16 @@ bool ProgressManager::loadProgress() {
 // ============================================================================
 
 /**
- * @brief Menyimpan seluruh progress ke file JSON
- * 
- * Menulis progress untuk semua bahasa ke file dalam format
- * JSON yang pretty-printed dengan indentasi.
+ * @brief Serialize progress semua bahasa ke JSON yang pretty-printed
  * 
- * @return true jika berhasil menyimpan ke file
- * @return false jika gagal membuka file untuk penulisan
+ * @param progressData Snapshot progress (harus berisi "id" dan "en")
+ * @return std::string Isi file progress.json
  * 
  * @note Hanya menyimpan progress untuk bahasa ID dan EN.
  *       Programmer certification disimpan di bahasa masing-masing.
- * 
- * @warning File yang sudah ada akan ditimpa
  */
-bool ProgressManager::saveProgress() {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Failed to save progress to " << filename << std::endl;
-        return false;
-    }
-    
+static std::string serializeProgress(const std::map<std::string, LanguageProgress>& progressData) {
+    std::ostringstream file;
     file << "{\n";
     file << "  \"languages\": {\n";
     
@@ -312,7 +206,7 @@ bool ProgressManager::saveProgress() {
     
     for (int i = 0; i < 2; ++i) {  // Loop hanya 2 kali
         const std::string& lang = languages[i];
-        const auto& progress = progressData[lang];
+        const auto& progress = progressData.at(lang);
         
         file << "    \"" << lang << "\": {\n";
         
@@ -336,8 +230,22 @@ bool ProgressManager::saveProgress() {
     
     file << "  }\n";
     file << "}\n";
-    
-    file.close();
+    return file.str();
+}
+
+/**
+ * @brief Menjadwalkan penyimpanan seluruh progress ke file JSON
+ * 
+ * Snapshot progressData di-copy ke serializer; serialisasi dan penulisan
+ * (atomic, di-debounce) dilakukan oleh worker PersistenceService.
+ * 
+ * @return true jika penyimpanan berhasil dijadwalkan
+ * 
+ * @warning File yang sudah ada akan ditimpa
+ */
+bool ProgressManager::saveProgress() {
+    PersistenceService::instance().scheduleWrite(
+        filename, [snapshot = progressData]() { return serializeProgress(snapshot); });
     return true;
 }
 
@@ -355,8 +263,7 @@ bool ProgressManager::saveProgress() {
  * 
  * @par Proses Reset
  * 1. Re-initialize progressData untuk semua bahasa
- * 2. Hapus file progress.json
- * 3. Simpan file baru dengan default values
+ * 2. Simpan default values (file lama ditimpa secara atomik)
  * 
  * @warning Operasi ini tidak dapat di-undo!
  */
@@ -365,8 +272,7 @@ bool ProgressManager::resetProgress() {
     progressData["id"] = LanguageProgress();
     progressData["en"] = LanguageProgress();
     
-    // Hapus file lama dan buat baru dengan default values
-    std::remove(filename.c_str());
+    // Timpa file lama dengan default values
     return saveProgress();
 }
 
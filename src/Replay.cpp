@@ -0,0 +1,193 @@
+/**
+ * @file Replay.cpp
+ * @brief Implementasi Replay (encoding varint) dan ReplayCursor
+ * @author Alea Farrel & Team
+ * @date 2025
+ */
+
+#include "Replay.h"
+#include <algorithm>
+#include <cstring>
+
+// ============================================================================
+// VARINT ENCODING
+// ============================================================================
+
+namespace {
+    constexpr char REPLAY_MAGIC[4] = {'R', 'T', 'R', 'P'};
+
+    void putVarint(std::string& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    /**
+     * @brief Baca satu varint dari data[offset]
+     * @return false jika data habis sebelum varint selesai
+     */
+    bool getVarint(const std::string& data, size_t& offset, uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && offset < data.size(); shift += 7) {
+            const unsigned char byte = static_cast<unsigned char>(data[offset++]);
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void putLE(std::string& out, uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            out.push_back(static_cast<char>(value >> (8 * i)));
+        }
+    }
+
+    uint64_t getLE(const std::string& data, size_t offset, int bytes) {
+        uint64_t value = 0;
+        for (int i = bytes - 1; i >= 0; --i) {
+            value = (value << 8) | static_cast<unsigned char>(data[offset + i]);
+        }
+        return value;
+    }
+}
+
+// ============================================================================
+// REPLAY
+// ============================================================================
+
+void Replay::clear(uint32_t textLength) {
+    events.clear();
+    length = textLength;
+    count = 0;
+    lastUs = 0;
+}
+
+void Replay::record(ReplayEvent event, uint64_t elapsedUs) {
+    // Timer monoton, tapi jaga-jaga agar delta tidak pernah negatif
+    const uint64_t delta = elapsedUs > lastUs ? elapsedUs - lastUs : 0;
+    putVarint(events, (delta << 2) | static_cast<uint8_t>(event));
+    lastUs += delta;
+    ++count;
+}
+
+std::string Replay::serialize() const {
+    std::string data;
+    data.reserve(HEADER_SIZE + events.size());
+    data.append(REPLAY_MAGIC, 4);
+    putLE(data, FILE_VERSION, 2);
+    putLE(data, 0, 2);
+    putLE(data, length, 4);
+    putLE(data, count, 4);
+    putLE(data, lastUs, 8);
+    data += events;
+    return data;
+}
+
+/**
+ * @brief Validasi header lalu decode seluruh stream sekali
+ *
+ * Stream harus berisi tepat `jumlah event` varint dan total delta-nya
+ * harus sama dengan durasi di header, sehingga file yang terpotong atau
+ * rusak ditolak di sini, bukan di tengah ghost race. Panjang text dibatasi
+ * MAX_TEXT_LENGTH karena ReplayCursor mengalokasikan tabel per karakter.
+ */
+bool Replay::deserialize(const std::string& data) {
+    if (data.size() < HEADER_SIZE || std::memcmp(data.data(), REPLAY_MAGIC, 4) != 0 ||
+        getLE(data, 4, 2) != FILE_VERSION) {
+        return false;
+    }
+
+    const uint32_t textLength = static_cast<uint32_t>(getLE(data, 8, 4));
+    const uint32_t eventCount = static_cast<uint32_t>(getLE(data, 12, 4));
+    const uint64_t duration = getLE(data, 16, 8);
+    if (textLength > MAX_TEXT_LENGTH) {
+        return false;
+    }
+
+    std::string stream = data.substr(HEADER_SIZE);
+    size_t offset = 0;
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < eventCount; ++i) {
+        uint64_t value;
+        if (!getVarint(stream, offset, value) || (value & 3) > 2) {
+            return false;
+        }
+        total += value >> 2;
+    }
+    if (offset != stream.size() || total != duration) {
+        return false;
+    }
+
+    events = std::move(stream);
+    length = textLength;
+    count = eventCount;
+    lastUs = duration;
+    return true;
+}
+
+// ============================================================================
+// REPLAY CURSOR
+// ============================================================================
+
+void ReplayCursor::reset(const Replay* source) {
+    replay = source;
+    offset = 0;
+    consumed = 0;
+    timeUs = 0;
+    typed.clear();
+    // Cursor tidak pernah melewati jumlah event, walaupun text lebih panjang
+    // (tes berwaktu yang tidak selesai)
+    correctCounted.assign(source ? std::min(source->length, source->count) : 0, false);
+    correct = 0;
+}
+
+void ReplayCursor::advanceTo(uint64_t elapsedUs) {
+    if (!replay) return;
+
+    while (consumed < replay->count) {
+        // Intip event berikutnya; offset baru dipakai jika waktunya sudah lewat
+        size_t next = offset;
+        uint64_t value;
+        if (!getVarint(replay->events, next, value)) {
+            consumed = replay->count;
+            break;
+        }
+        const uint64_t eventUs = timeUs + (value >> 2);
+        if (eventUs > elapsedUs) {
+            break;
+        }
+
+        offset = next;
+        timeUs = eventUs;
+        ++consumed;
+
+        const ReplayEvent event = static_cast<ReplayEvent>(value & 3);
+        if (event == ReplayEvent::BACKSPACE) {
+            if (!typed.empty()) typed.pop_back();
+            continue;
+        }
+
+        const size_t pos = typed.size();
+        if (pos >= correctCounted.size()) {
+            continue;  // Replay rusak: lebih panjang dari target text
+        }
+        typed.push_back(event == ReplayEvent::CORRECT);
+        if (event == ReplayEvent::CORRECT && !correctCounted[pos]) {
+            correctCounted[pos] = true;
+            ++correct;
+        }
+    }
+}
+
+double ReplayCursor::progress() const {
+    if (!replay || replay->length == 0) return 0.0;
+    return static_cast<double>(typed.size()) / replay->length;
+}
+
+bool ReplayCursor::finished() const {
+    return replay && consumed >= replay->count;
+}
@@ -22,19 +22,9 @@
  */
 
 #include "SettingsManager.h"
-#include <cstdlib>
+#include "PersistenceService.h"
 #include <fstream>
-#include <iostream>
 #include <sstream>
-#include <sys/stat.h>
-
-#ifdef _WIN32
-#include <direct.h>
-#include <shlobj.h>
-#include <windows.h>
-#else
-#include <unistd.h>
-#endif
 
 // ============================================================================
 // STATIC MEMBER INITIALIZATION
@@ -47,64 +37,6 @@ bool SettingsManager::historySortAscending = false;  // Default: descending (new
 bool SettingsManager::isLoaded = false;
 std::string SettingsManager::filename = "";
 
-// ============================================================================
-// HELPER FUNCTIONS
-// ============================================================================
-
-/**
- * @brief Mendapatkan path direktori data aplikasi sesuai platform
- *
- * @par Windows
- * Menggunakan CSIDL_APPDATA (%APPDATA%) yang biasanya mengarah ke:
- * C:\Users\{username}\AppData\Roaming\RapidTexter\
- *
- * @par Linux/macOS
- * Mengikuti XDG Base Directory Specification:
- * - Jika XDG_DATA_HOME di-set: $XDG_DATA_HOME/RapidTexter/
- * - Jika tidak: ~/.local/share/RapidTexter/
- *
- * @return std::string Path ke direktori data dengan trailing separator
- */
-std::string SettingsManager::getDataDirectory() {
-#ifdef _WIN32
-  char appDataPath[MAX_PATH];
-  if (SUCCEEDED(SHGetFolderPathA(NULL, CSIDL_APPDATA, NULL, 0, appDataPath))) {
-    std::string dataDir = std::string(appDataPath) + "\\RapidTexter";
-    struct _stat st;
-    if (_stat(dataDir.c_str(), &st) != 0) {
-      _mkdir(dataDir.c_str());
-    }
-    return dataDir + "\\";
-  }
-  return "";
-#else
-  const char *xdgDataHome = std::getenv("XDG_DATA_HOME");
-  std::string baseDir;
-
-  if (xdgDataHome && xdgDataHome[0] != '\0') {
-    baseDir = std::string(xdgDataHome);
-  } else {
-    const char *home = std::getenv("HOME");
-    if (home) {
-      baseDir = std::string(home) + "/.local/share";
-    } else {
-      return "";
-    }
-  }
-
-  struct stat st;
-  if (stat(baseDir.c_str(), &st) != 0) {
-    mkdir(baseDir.c_str(), 0755);
-  }
-
-  std::string dataDir = baseDir + "/RapidTexter";
-  if (stat(dataDir.c_str(), &st) != 0) {
-    mkdir(dataDir.c_str(), 0755);
-  }
-  return dataDir + "/";
-#endif
-}
-
 // ============================================================================
 // LOAD SETTINGS
 // ============================================================================
@@ -121,7 +53,7 @@ std::string SettingsManager::getDataDirectory() {
 bool SettingsManager::load() {
   // Set filename jika belum
   if (filename.empty()) {
-    filename = getDataDirectory() + "settings.json";
+    filename = PersistenceService::dataDirectory() + "settings.json";
   }
 
   std::ifstream file(filename);
@@ -190,33 +122,31 @@ bool SettingsManager::load() {
 // ============================================================================
 
 /**
- * @brief Menyimpan settings ke file JSON
+ * @brief Menjadwalkan penyimpanan settings ke file JSON
  *
- * Menulis settings dalam format JSON yang pretty-printed.
+ * Nilai settings di-copy ke serializer, lalu JSON yang pretty-printed
+ * ditulis oleh worker PersistenceService (atomic, di-debounce).
  *
- * @return true jika berhasil menyimpan
- * @return false jika gagal membuka file
+ * @return true jika penyimpanan berhasil dijadwalkan
  */
 bool SettingsManager::save() {
   // Set filename jika belum
   if (filename.empty()) {
-    filename = getDataDirectory() + "settings.json";
+    filename = PersistenceService::dataDirectory() + "settings.json";
   }
 
-  std::ofstream file(filename);
-  if (!file.is_open()) {
-    std::cerr << "Failed to save settings to " << filename << std::endl;
-    return false;
-  }
-
-  file << "{\n";
-  file << "  \"sfx_enabled\": " << (sfxEnabled ? "true" : "false") << ",\n";
-  file << "  \"default_duration\": " << defaultDuration << ",\n";
-  file << "  \"history_sort_by\": \"" << historySortBy << "\",\n";
-  file << "  \"history_sort_ascending\": " << (historySortAscending ? "true" : "false") << "\n";
-  file << "}\n";
-
-  file.close();
+  PersistenceService::instance().scheduleWrite(
+      filename, [sfx = sfxEnabled, duration = defaultDuration,
+                 sortBy = historySortBy, ascending = historySortAscending]() {
+        std::ostringstream file;
+        file << "{\n";
+        file << "  \"sfx_enabled\": " << (sfx ? "true" : "false") << ",\n";
+        file << "  \"default_duration\": " << duration << ",\n";
+        file << "  \"history_sort_by\": \"" << sortBy << "\",\n";
+        file << "  \"history_sort_ascending\": " << (ascending ? "true" : "false") << "\n";
+        file << "}\n";
+        return file.str();
+      });
   return true;
 }
 
@@ -239,7 +169,7 @@ bool SettingsManager::getSfxEnabled() {
 }
 
 /**
- * @brief Mengatur status SFX dan menyimpan ke file
+ * @brief Mengatur status SFX dan menjadwalkan penyimpanan
  *
  * @param enabled Status SFX yang baru
  */
@@ -263,7 +193,7 @@ int SettingsManager::getDefaultDuration() {
 }
 
 /**
- * @brief Mengatur durasi default dan menyimpan ke file
+ * @brief Mengatur durasi default dan menjadwalkan penyimpanan
  *
  * @param duration Durasi dalam detik (-1 untuk unlimited)
  */
@@ -284,7 +214,7 @@ std::string SettingsManager::getHistorySortBy() {
 }
 
 /**
- * @brief Mengatur field sorting history dan menyimpan ke file
+ * @brief Mengatur field sorting history dan menjadwalkan penyimpanan
  * @param sortBy Field untuk sorting ("date" atau "wpm")
  */
 void SettingsManager::setHistorySortBy(const std::string& sortBy) {
@@ -304,7 +234,7 @@ bool SettingsManager::getHistorySortAscending() {
 }
 
 /**
- * @brief Mengatur arah sorting history dan menyimpan ke file
+ * @brief Mengatur arah sorting history dan menjadwalkan penyimpanan
  * @param ascending true untuk ascending, false untuk descending
  */
 void SettingsManager::setHistorySortAscending(bool ascending) {
@@ -9,9 +9,10 @@
  * 
  * @section features Fitur Utama
  * - Loading kata dari file teks eksternal
- * - Filtering kata berdasarkan tingkat kesulitan
+ * - Filtering kata berdasarkan tingkat kesulitan (sekali saat loading)
  * - Random selection untuk variasi gameplay
  * - Multi-language support (ID, EN, PROG)
+ * - Teks natural dari korpus kalimat (model Markov, lihat MarkovModel.cpp)
  * 
  * @section difficulty Sistem Kesulitan
  * Kata-kata difilter berdasarkan panjang:
@@ -21,9 +22,10 @@
  * - PROGRAMMER: Semua kata/sintaks tanpa filter panjang
  * 
  * @section storage Format Penyimpanan
- * File database kata menggunakan format plain text dengan satu kata per
- * baris atau dipisahkan oleh whitespace. Karakter non-ASCII akan
- * otomatis difilter saat loading.
+ * Word bank bawaan di-compile saat build menjadi format binary (.rtwb)
+ * yang di-map langsung ke memory. File database kata teks (satu kata per
+ * baris atau dipisahkan oleh whitespace) tetap didukung sebagai fallback;
+ * karakter non-ASCII akan otomatis difilter saat loading.
  */
 
 #include "TextProvider.h"
@@ -32,6 +34,8 @@
 #include <algorithm>
 #include <random>
 #include <ctime>
+#include <unordered_map>
+#include <cstring>
 
 // Qt includes for resource file support
 #ifdef QT_CORE_LIB
@@ -92,6 +96,46 @@ namespace {
         }
         return cleaned;
     }
+
+    /**
+     * @brief Memecah satu baris korpus menjadi kalimat
+     *
+     * Tanda baca di awal/akhir token dibuang; token yang diakhiri . ! ?
+     * menutup kalimat. Akhir baris selalu menutup kalimat.
+     *
+     * @param line Baris korpus
+     * @param sentences Output; kalimat baru ditambahkan di akhir
+     */
+    void splitCorpusLine(const std::string& line, std::vector<std::vector<std::string>>& sentences) {
+        static const char* const PUNCTUATION = ".,!?;:\"()[]";
+        std::vector<std::string> sentence;
+        size_t pos = 0;
+
+        while (pos < line.size()) {
+            size_t start = line.find_first_not_of(" \t\r", pos);
+            if (start == std::string::npos) break;
+            size_t end = line.find_first_of(" \t\r", start);
+            pos = (end == std::string::npos) ? line.size() : end;
+
+            std::string token = sanitizeWord(line.substr(start, pos - start));
+            const size_t first = token.find_first_not_of(PUNCTUATION);
+            const size_t last = token.find_last_not_of(PUNCTUATION);
+            const bool endsSentence =
+                token.find_first_of(".!?", last == std::string::npos ? 0 : last) != std::string::npos;
+
+            if (first != std::string::npos) {
+                sentence.push_back(token.substr(first, last - first + 1));
+            }
+            if (endsSentence && !sentence.empty()) {
+                sentences.push_back(std::move(sentence));
+                sentence.clear();
+            }
+        }
+
+        if (!sentence.empty()) {
+            sentences.push_back(std::move(sentence));
+        }
+    }
 }
 
 // ============================================================================
@@ -114,38 +158,265 @@ TextProvider::TextProvider() : rng(std::random_device{}()) {
     // dengan random_device untuk entropy berkualitas tinggi
 }
 
+// ============================================================================
+// BINARY WORD BANK FORMAT
+// ============================================================================
+
+/**
+ * @par Layout File .rtwb (little-endian)
+ * | Offset            | Ukuran       | Isi                                 |
+ * |-------------------|--------------|-------------------------------------|
+ * | 0                 | 4            | Magic "RTWB"                        |
+ * | 4                 | 4            | Versi format (u32)                  |
+ * | 8                 | 4            | wordCount (u32)                     |
+ * | 12                | 4            | arenaSize (u32)                     |
+ * | 16                | 16           | bucketSize[4] (u32, per Difficulty) |
+ * | 32                | 4 * n        | offsets (u32)                       |
+ * | 32 + 4n           | 4 * n        | order (u32, urut panjang kata)      |
+ * | 32 + 8n           | 2 * n        | lengths (u16)                       |
+ * | align4(32 + 10n)  | arenaSize    | arena karakter (tanpa separator)    |
+ *
+ * Tabel dibaca per-byte (bukan cast pointer) sehingga buffer tidak perlu
+ * aligned; data dari Qt resource tidak menjamin alignment.
+ */
+namespace {
+    constexpr char BANK_MAGIC[4] = {'R', 'T', 'W', 'B'};
+    constexpr uint32_t BANK_VERSION = 1;
+    constexpr size_t BANK_HEADER_SIZE = 32;
+
+    inline uint32_t readU32(const unsigned char* p) {
+        return static_cast<uint32_t>(p[0]) |
+               (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) |
+               (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    inline uint16_t readU16(const unsigned char* p) {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    inline void writeU32(unsigned char* p, uint32_t v) {
+        p[0] = static_cast<unsigned char>(v);
+        p[1] = static_cast<unsigned char>(v >> 8);
+        p[2] = static_cast<unsigned char>(v >> 16);
+        p[3] = static_cast<unsigned char>(v >> 24);
+    }
+
+    inline void writeU16(unsigned char* p, uint16_t v) {
+        p[0] = static_cast<unsigned char>(v);
+        p[1] = static_cast<unsigned char>(v >> 8);
+    }
+
+    inline size_t arenaOffset(uint32_t wordCount) {
+        size_t end = BANK_HEADER_SIZE + static_cast<size_t>(wordCount) * 10;
+        return (end + 3) & ~static_cast<size_t>(3);
+    }
+
+    inline bool hasBankMagic(const unsigned char* data, size_t size) {
+        return size >= BANK_HEADER_SIZE && std::memcmp(data, BANK_MAGIC, 4) == 0;
+    }
+
+    constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+    constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+    /**
+     * @brief PCG32 (XSH-RR) dengan bounded sampling metode Lemire
+     *
+     * Dipakai untuk teks ber-seed: std::mt19937 sendiri portable, tetapi
+     * std::uniform_int_distribution tidak (algoritmanya berbeda antar
+     * standard library), sehingga seed yang sama bisa menghasilkan teks
+     * yang berbeda di Windows dan Linux. Semua operasi di sini hanya
+     * aritmetika integer unsigned yang hasilnya identik di semua platform.
+     */
+    class Pcg32 {
+    public:
+        explicit Pcg32(uint64_t seed) {
+            next();
+            state += seed;
+            next();
+        }
+
+        uint32_t next() {
+            const uint64_t old = state;
+            state = old * 6364136223846793005ull + INCREMENT;
+            const uint32_t xorshifted = static_cast<uint32_t>(((old >> 18) ^ old) >> 27);
+            const uint32_t rot = static_cast<uint32_t>(old >> 59);
+            return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+        }
+
+        /// Angka seragam di [0, range), tanpa bias (range > 0)
+        uint32_t below(uint32_t range) {
+            uint64_t product = static_cast<uint64_t>(next()) * range;
+            uint32_t low = static_cast<uint32_t>(product);
+            if (low < range) {
+                const uint32_t threshold = (0u - range) % range;
+                while (low < threshold) {
+                    product = static_cast<uint64_t>(next()) * range;
+                    low = static_cast<uint32_t>(product);
+                }
+            }
+            return static_cast<uint32_t>(product >> 32);
+        }
+
+    private:
+        static constexpr uint64_t INCREMENT = 1442695040888963407ull;
+        uint64_t state = 0;
+    };
+
+    /**
+     * @brief Langkah partial Fisher-Yates milik WordDeck
+     *
+     * Posisi i di bucket berisi displaced[i] jika pernah di-swap, atau i
+     * jika belum disentuh. Dipakai bersama oleh drawWords() (RNG sesi) dan
+     * getSeededWords() (Pcg32), sehingga keduanya memilih kata dengan cara
+     * yang sama.
+     *
+     * @param pick Mengembalikan angka seragam di [lo, hi]
+     * @param emit Dipanggil dengan posisi bucket yang terambil
+     */
+    template <typename Pick, typename Emit>
+    void shuffleDeck(TextProvider::WordDeck& deck, uint32_t bucket, int count,
+                     Pick&& pick, Emit&& emit) {
+        auto valueAt = [&deck](uint32_t pos) {
+            auto found = deck.displaced.find(pos);
+            return found == deck.displaced.end() ? pos : found->second;
+        };
+
+        for (int n = 0; n < count; ++n) {
+            // Bucket habis (atau bank di-load ulang lebih kecil): kocok ulang
+            if (deck.drawn >= bucket) {
+                deck.drawn = 0;
+                deck.displaced.clear();
+            }
+
+            const uint32_t i = deck.drawn++;
+            const uint32_t j = pick(i, bucket - 1);
+
+            const uint32_t picked = valueAt(j);
+            // Posisi i tidak akan dibaca lagi, cukup pindahkan isinya ke j
+            deck.displaced[j] = valueAt(i);
+            deck.displaced.erase(i);
+
+            emit(picked);
+        }
+    }
+}
+
+std::string_view TextProvider::WordBank::word(uint32_t index) const {
+    return std::string_view(arena + readU32(offsets + index * 4),
+                            readU16(lengths + index * 2));
+}
+
 // ============================================================================
 // WORD LOADING
 // ============================================================================
 
 /**
- * @brief Memuat daftar kata dari file teks ke dalam memory
+ * @brief Memuat database kata dari file ke dalam memory
  * 
- * Membaca file database kata dan menyimpannya dalam map internal
- * yang diindeks berdasarkan kode bahasa.
+ * Menerima dua format:
+ * - Word bank binary (.rtwb) hasil compileWordFile(): file di-map langsung
+ *   ke memory (QFile::map untuk Qt resource maupun file di disk), tanpa
+ *   parsing dan tanpa alokasi per kata.
+ * - File teks biasa: fallback untuk daftar kata yang disediakan user,
+ *   di-parse lalu di-serialize ke format binary yang sama di memory.
  * 
  * @param language Kode bahasa untuk mengindeks database ("id", "en", "prog")
  * @param filename Path ke file database kata (bisa Qt resource path ":/..." atau file path biasa)
  * @return true jika file berhasil dibaca
- * @return false jika file tidak dapat dibuka
+ * @return false jika file tidak dapat dibuka atau word bank binary rusak
  * 
- * @par Format File Input
+ * @par Format File Teks
  * File dapat mengandung kata-kata yang dipisahkan oleh:
  * - Spasi
  * - Tab
  * - Newline (satu kata per baris)
  * 
  * @par Proses Loading
- * 1. Cek apakah path adalah Qt resource (dimulai dengan ":/")
- * 2. Jika Qt resource, gunakan QFile; jika tidak, gunakan ifstream
- * 3. Baca kata per kata menggunakan operator >>
- * 4. Sanitize setiap kata (hapus karakter non-ASCII)
- * 5. Simpan kata yang valid ke vector
- * 6. Masukkan vector ke map dengan key = language
+ * 1. Buka file (QFile untuk Qt resource, ifstream untuk file biasa
+ *    jika Qt tidak tersedia)
+ * 2. Jika diawali magic "RTWB", map file dan pasang view WordBank
+ * 3. Jika tidak, baca kata per kata dan sanitize (hapus karakter non-ASCII)
+ * 4. Bangun buffer binary (arena + index difficulty) dan simpan dengan key = language
  */
 bool TextProvider::loadWords(const std::string& language, const std::string& filename) {
+    WordBank bank;
+    weakTables.erase(language);  // Bobot kumulatif mengikuti isi bucket
+
+#ifdef QT_CORE_LIB
+    QString qFilename = QString::fromStdString(filename);
+    // Remove "qrc" prefix if present
+    if (qFilename.startsWith("qrc:")) {
+        qFilename = qFilename.mid(3);
+    }
+
+    auto file = std::make_shared<QFile>(qFilename);
+    if (file->open(QIODevice::ReadOnly)) {
+        const QByteArray magic = file->peek(4);
+        if (magic.size() == 4 && std::memcmp(magic.constData(), BANK_MAGIC, 4) == 0) {
+            const qint64 size = file->size();
+            const uchar* mapped = file->map(0, size);
+            if (mapped) {
+                // File tetap terbuka selama WordBank masih dipakai
+                bank.mapping = file;
+                if (!attachBank(mapped, static_cast<size_t>(size), bank)) {
+                    std::cerr << "Invalid word bank: " << filename << std::endl;
+                    return false;
+                }
+            } else {
+                // Resource terkompresi tidak bisa di-map, salin sekali
+                const QByteArray content = file->readAll();
+                bank.storage.assign(content.begin(), content.end());
+                if (!attachBank(bank.storage.data(), bank.storage.size(), bank)) {
+                    std::cerr << "Invalid word bank: " << filename << std::endl;
+                    return false;
+                }
+            }
+            wordBanks[language] = std::move(bank);
+            return true;
+        }
+        file->close();
+    }
+#else
+    if (filename.substr(0, 2) != ":/" && filename.substr(0, 4) != "qrc:") {
+        std::ifstream file(filename, std::ios::binary);
+        char magic[4] = {};
+        if (file.read(magic, 4) && std::memcmp(magic, BANK_MAGIC, 4) == 0) {
+            file.seekg(0, std::ios::end);
+            bank.storage.resize(static_cast<size_t>(file.tellg()));
+            file.seekg(0, std::ios::beg);
+            file.read(reinterpret_cast<char*>(bank.storage.data()),
+                      static_cast<std::streamsize>(bank.storage.size()));
+            if (!file || !attachBank(bank.storage.data(), bank.storage.size(), bank)) {
+                std::cerr << "Invalid word bank: " << filename << std::endl;
+                return false;
+            }
+            wordBanks[language] = std::move(bank);
+            return true;
+        }
+    }
+#endif
+
+    // Fallback: file teks (misalnya daftar kata dari user)
     std::vector<std::string> words;
-    
+    if (!readWordFile(filename, words)) {
+        return false;
+    }
+
+    bank.storage = buildBank(words);
+    attachBank(bank.storage.data(), bank.storage.size(), bank);
+    wordBanks[language] = std::move(bank);
+    return true;
+}
+
+/**
+ * @brief Membaca daftar kata dari file teks
+ * 
+ * @param filename Path file (Qt resource ":/..." / "qrc:" atau file biasa)
+ * @param words Output kata-kata yang sudah di-sanitize, sesuai urutan file
+ * @return true jika file berhasil dibaca
+ */
+bool TextProvider::readWordFile(const std::string& filename, std::vector<std::string>& words) {
     // Check if this is a Qt resource path
     if (filename.substr(0, 2) == ":/" || filename.substr(0, 4) == "qrc:") {
         // Use Qt resource handling
@@ -200,11 +471,279 @@ bool TextProvider::loadWords(const std::string& language, const std::string& fil
             }
         }
     }
-    
-    wordBanks[language] = words;
+
     return true;
 }
 
+// ============================================================================
+// CORPUS LOADING
+// ============================================================================
+
+/**
+ * @brief Memuat korpus kalimat dan membangun model Markov per difficulty
+ * 
+ * Model dibangun sekali di sini (thread loading), sehingga getWords()
+ * dengan TextMode::MARKOV hanya menjalankan rantai: O(1) per kata.
+ * 
+ * @param language Kode bahasa untuk mengindeks model
+ * @param filename Path ke file korpus teks
+ * @return true jika minimal satu kalimat berhasil dibaca
+ * 
+ * @par Filter Difficulty
+ * Kata yang terlalu panjang untuk suatu difficulty tidak pernah muncul di
+ * model difficulty tersebut: kalimat dipotong di kata itu, dan setiap
+ * potongan dipelajari sebagai kalimat tersendiri. Dengan begitu aturan
+ * panjang kata tetap sama dengan mode kata acak.
+ */
+bool TextProvider::loadCorpus(const std::string& language, const std::string& filename) {
+    std::vector<std::vector<std::string>> sentences;
+    if (!readCorpusFile(filename, sentences) || sentences.empty()) {
+        return false;
+    }
+
+    std::array<MarkovModel, 4> models;
+    const Difficulty levels[] = {
+        Difficulty::EASY, Difficulty::MEDIUM, Difficulty::HARD, Difficulty::PROGRAMMER
+    };
+    for (Difficulty d : levels) {
+        std::vector<std::vector<std::string>> fragments;
+        for (const auto& sentence : sentences) {
+            std::vector<std::string> fragment;
+            for (const auto& w : sentence) {
+                if (isWordValidForDifficulty(w, d)) {
+                    fragment.push_back(w);
+                } else if (!fragment.empty()) {
+                    fragments.push_back(std::move(fragment));
+                    fragment.clear();
+                }
+            }
+            if (!fragment.empty()) {
+                fragments.push_back(std::move(fragment));
+            }
+        }
+        models[static_cast<size_t>(d)].build(fragments);
+    }
+
+    corpusModels[language] = std::move(models);
+    return true;
+}
+
+/**
+ * @brief Membaca korpus teks sebagai kalimat-kalimat
+ * 
+ * @param filename Path file (Qt resource ":/..." / "qrc:" atau file biasa)
+ * @param sentences Output kalimat, sesuai urutan file
+ * @return true jika file berhasil dibaca
+ */
+bool TextProvider::readCorpusFile(const std::string& filename,
+                                  std::vector<std::vector<std::string>>& sentences) {
+    if (filename.substr(0, 2) == ":/" || filename.substr(0, 4) == "qrc:") {
+        #ifdef QT_CORE_LIB
+        QString qFilename = QString::fromStdString(filename);
+        // Remove "qrc" prefix if present
+        if (qFilename.startsWith("qrc:")) {
+            qFilename = qFilename.mid(3);
+        }
+        
+        QFile file(qFilename);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            std::cerr << "Failed to open Qt resource: " << filename << std::endl;
+            return false;
+        }
+        
+        QTextStream stream(&file);
+        while (!stream.atEnd()) {
+            splitCorpusLine(stream.readLine().toStdString(), sentences);
+        }
+        file.close();
+        #else
+        std::cerr << "Qt resource path used but Qt not available: " << filename << std::endl;
+        return false;
+        #endif
+    } else {
+        std::ifstream file(filename);
+        if (!file.is_open()) {
+            std::cerr << "Failed to open file: " << filename << std::endl;
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(file, line)) {
+            splitCorpusLine(line, sentences);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Serialize daftar kata ke format word bank binary
+ * 
+ * Menyalin semua kata ke satu arena yang berurutan dan menghitung
+ * index difficulty satu kali, sehingga getWords() tidak perlu lagi
+ * memfilter atau menyalin string setiap kali dipanggil.
+ * 
+ * @param words Kata-kata yang sudah di-sanitize, sesuai urutan file
+ * @return std::vector<unsigned char> Buffer dengan layout .rtwb
+ * 
+ * @par Struktur Index
+ * Kriteria difficulty bersifat nested (EASY ⊂ MEDIUM ⊂ HARD ⊂ PROGRAMMER)
+ * karena hanya bergantung pada panjang kata. Dengan mengurutkan index
+ * kata berdasarkan panjang (stable, agar urutan file tetap terjaga),
+ * setiap difficulty cukup disimpan sebagai jumlah kata di awal `order`.
+ */
+std::vector<unsigned char> TextProvider::buildBank(const std::vector<std::string>& words) {
+    const uint32_t wordCount = static_cast<uint32_t>(words.size());
+
+    std::vector<uint16_t> lengths;
+    lengths.reserve(wordCount);
+    size_t arenaSize = 0;
+    for (const auto& w : words) {
+        // Panjang kata dibatasi ke kapasitas uint16_t (kata sepanjang ini
+        // tidak realistis untuk typing test)
+        uint16_t len = static_cast<uint16_t>(std::min<size_t>(w.length(), UINT16_MAX));
+        lengths.push_back(len);
+        arenaSize += len;
+    }
+
+    std::vector<uint32_t> order(wordCount);
+    for (uint32_t i = 0; i < wordCount; ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&lengths](uint32_t a, uint32_t b) {
+                         return lengths[a] < lengths[b];
+                     });
+
+    const size_t arenaStart = arenaOffset(wordCount);
+    std::vector<unsigned char> buffer(arenaStart + arenaSize, 0);
+    unsigned char* out = buffer.data();
+
+    std::memcpy(out, BANK_MAGIC, 4);
+    writeU32(out + 4, BANK_VERSION);
+    writeU32(out + 8, wordCount);
+    writeU32(out + 12, static_cast<uint32_t>(arenaSize));
+
+    // Hitung jumlah kata valid per difficulty (prefix dari order)
+    const Difficulty levels[] = {
+        Difficulty::EASY, Difficulty::MEDIUM, Difficulty::HARD, Difficulty::PROGRAMMER
+    };
+    for (Difficulty d : levels) {
+        uint32_t count = 0;
+        for (const auto& w : words) {
+            if (isWordValidForDifficulty(w, d)) {
+                ++count;
+            }
+        }
+        writeU32(out + 16 + static_cast<size_t>(d) * 4, count);
+    }
+
+    unsigned char* offsets = out + BANK_HEADER_SIZE;
+    unsigned char* orderTable = offsets + static_cast<size_t>(wordCount) * 4;
+    unsigned char* lengthTable = orderTable + static_cast<size_t>(wordCount) * 4;
+    char* arena = reinterpret_cast<char*>(out + arenaStart);
+
+    uint32_t cursor = 0;
+    for (uint32_t i = 0; i < wordCount; ++i) {
+        writeU32(offsets + i * 4, cursor);
+        writeU32(orderTable + i * 4, order[i]);
+        writeU16(lengthTable + i * 2, lengths[i]);
+        std::memcpy(arena + cursor, words[i].data(), lengths[i]);
+        cursor += lengths[i];
+    }
+
+    return buffer;
+}
+
+/**
+ * @brief Memasang view WordBank di atas buffer binary dan memvalidasinya
+ * 
+ * Validasi dilakukan sekali saat loading agar getWords() tidak perlu
+ * melakukan bounds check: header, ukuran tabel, dan setiap pasangan
+ * offset/length harus berada di dalam buffer.
+ * 
+ * @param data Pointer ke awal buffer binary
+ * @param size Ukuran buffer dalam byte
+ * @param bank WordBank yang akan diisi pointer-pointernya
+ * @return true jika buffer valid
+ */
+bool TextProvider::attachBank(const unsigned char* data, size_t size, WordBank& bank) {
+    if (!hasBankMagic(data, size) || readU32(data + 4) != BANK_VERSION) {
+        return false;
+    }
+
+    const uint32_t wordCount = readU32(data + 8);
+    const uint32_t arenaSize = readU32(data + 12);
+    const size_t arenaStart = arenaOffset(wordCount);
+    if (arenaStart < BANK_HEADER_SIZE || arenaStart + arenaSize > size) {
+        return false;
+    }
+
+    bank.wordCount = wordCount;
+    for (size_t d = 0; d < bank.bucketSize.size(); ++d) {
+        bank.bucketSize[d] = std::min(readU32(data + 16 + d * 4), wordCount);
+    }
+    bank.offsets = data + BANK_HEADER_SIZE;
+    bank.order = bank.offsets + static_cast<size_t>(wordCount) * 4;
+    bank.lengths = bank.order + static_cast<size_t>(wordCount) * 4;
+    bank.arena = reinterpret_cast<const char*>(data + arenaStart);
+
+    for (uint32_t i = 0; i < wordCount; ++i) {
+        const uint64_t end = static_cast<uint64_t>(readU32(bank.offsets + i * 4)) +
+                             readU16(bank.lengths + i * 2);
+        if (end > arenaSize || readU32(bank.order + i * 4) >= wordCount) {
+            return false;
+        }
+    }
+
+    // Hash isi yang menentukan hasil getSeededWords(): bucket dan kata
+    // sesuai urutan `order` (FNV-1a 64-bit, tidak bergantung platform)
+    uint64_t hash = FNV_OFFSET;
+    auto mix = [&hash](unsigned char byte) {
+        hash = (hash ^ byte) * FNV_PRIME;
+    };
+    for (uint32_t bucket : bank.bucketSize) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            mix(static_cast<unsigned char>(bucket >> shift));
+        }
+    }
+    for (uint32_t i = 0; i < wordCount; ++i) {
+        for (char c : bank.word(readU32(bank.order + i * 4))) {
+            mix(static_cast<unsigned char>(c));
+        }
+        mix(0);  // Separator: "ab" + "c" != "a" + "bc"
+    }
+    bank.contentHash = hash;
+    return true;
+}
+
+/**
+ * @brief Compile file kata teks menjadi word bank binary
+ * 
+ * Dipanggil oleh tool `rapidtexter_wordbank` saat build (lihat
+ * CMakeLists.txt) untuk menghasilkan file .rtwb di resource wordbanks/.
+ * 
+ * @param textFile Path ke file kata teks
+ * @param binaryFile Path output
+ * @return true jika berhasil ditulis
+ */
+bool TextProvider::compileWordFile(const std::string& textFile, const std::string& binaryFile) {
+    std::vector<std::string> words;
+    if (!readWordFile(textFile, words)) {
+        return false;
+    }
+
+    const std::vector<unsigned char> buffer = buildBank(words);
+    std::ofstream out(binaryFile, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Failed to write word bank: " << binaryFile << std::endl;
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(buffer.data()),
+              static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(out);
+}
+
 // ============================================================================
 // WORD RETRIEVAL
 // ============================================================================
@@ -213,27 +752,31 @@ bool TextProvider::loadWords(const std::string& language, const std::string& fil
  * @brief Mengambil sejumlah kata acak berdasarkan bahasa dan kesulitan
  * 
  * Fungsi utama yang menyediakan kata-kata untuk gameplay. Kata-kata
- * difilter terlebih dahulu berdasarkan tingkat kesulitan, kemudian
- * dipilih secara acak dari hasil filter.
+ * dipilih secara acak dari bucket difficulty yang sudah dihitung saat
+ * loading (lihat buildBank()).
  * 
  * @param language Kode bahasa ("id", "en", "prog")
  * @param difficulty Tingkat kesulitan (EASY/MEDIUM/HARD/PROGRAMMER)
  * @param count Jumlah kata yang diinginkan
- * @return std::vector<std::string> Vector berisi kata-kata acak yang sudah difilter.
+ * @param mode RANDOM_WORDS, MARKOV untuk teks dari model korpus (fallback
+ *             ke kata acak jika bahasa tidak punya korpus), atau
+ *             WEAK_BIGRAMS untuk kata acak berbobot bigram terlemah
+ * @return std::vector<std::string_view> View ke kata-kata acak di pool.
  *         Akan kosong jika:
  *         - Bahasa tidak terdaftar di wordBanks
  *         - Tidak ada kata yang memenuhi kriteria difficulty
  * 
  * @par Algoritma
  * 1. Cek apakah bahasa ada di database (wordBanks)
- * 2. Filter semua kata berdasarkan kriteria difficulty
- * 3. Pilih kata secara acak dari hasil filter sebanyak count
- * 4. Kata yang sama bisa muncul lebih dari sekali (with replacement)
+ * 2. Ambil bucket difficulty (prefix dari index `order`)
+ * 3. Partial Fisher-Yates sebanyak count langkah di atas bucket
+ * 4. Kata tidak berulang dalam satu pemanggilan (without replacement)
  * 
  * @par Catatan Performa
- * - Filtering dilakukan setiap kali fungsi dipanggil
- * - Untuk optimasi, bisa dipertimbangkan caching hasil filter
- * - Kompleksitas waktu: O(n) untuk filtering + O(count) untuk selection
+ * - Tidak ada filtering maupun copy string per pemanggilan; view menunjuk
+ *   langsung ke arena (termasuk arena yang di-map dari resource)
+ * - Posisi yang sudah di-swap dicatat di hash map kecil, sehingga bucket
+ *   tidak perlu disalin: kompleksitas O(count), bukan O(n)
  * 
  * @par Contoh Penggunaan
  * @code
@@ -244,46 +787,231 @@ bool TextProvider::loadWords(const std::string& language, const std::string& fil
  * auto words = provider.getWords("id", Difficulty::EASY, 30);
  * @endcode
  * 
- * @see isWordValidForDifficulty()
+ * @see buildBank()
  */
-std::vector<std::string> TextProvider::getWords(const std::string& language, Difficulty difficulty, int count) {
-    std::vector<std::string> result;
+std::vector<std::string_view> TextProvider::getWords(const std::string& language, Difficulty difficulty, int count, TextMode mode) {
+    // Mode Markov: rantai baru dari awal kalimat (kalimat boleh berulang)
+    if (mode == TextMode::MARKOV) {
+        if (const MarkovModel* model = findModel(language, difficulty)) {
+            uint32_t state = MarkovModel::NO_STATE;
+            return model->generate(count, rng, state);
+        }
+    }
+
+    auto it = wordBanks.find(language);
+    if (it == wordBanks.end() || count <= 0) {
+        return {};
+    }
+
+    // Deck sekali pakai; count dibatasi ukuran bucket agar tidak berulang.
+    // Undian berbobot WEAK_BIGRAMS memang boleh berulang, jadi tidak dibatasi
+    // (latihan tetap sepanjang yang diminta walau bucket kecil).
+    WordDeck deck;
+    deck.language = language;
+    deck.difficulty = difficulty;
+    deck.mode = mode;
+    const uint32_t bucket = it->second.bucketSize[static_cast<size_t>(difficulty)];
+    if (mode == TextMode::WEAK_BIGRAMS && findWeakTable(language, difficulty)) {
+        return drawWords(deck, count);
+    }
+    return drawWords(deck, static_cast<int>(std::min<uint32_t>(static_cast<uint32_t>(count), bucket)));
+}
+
+/**
+ * @brief Mengambil kata berikutnya dari deck
+ * 
+ * Melanjutkan partial Fisher-Yates milik deck sebanyak count langkah.
+ * Saat bucket habis, deck dikocok ulang dari awal. Deck TextMode::MARKOV
+ * melanjutkan rantai dari chainState; deck TextMode::WEAK_BIGRAMS memilih
+ * dengan peluang sebanding bobot kata (binary search di tabel kumulatif).
+ * 
+ * @param deck Deck milik pemanggil (misalnya satu per sesi unlimited)
+ * @param count Jumlah kata yang diinginkan
+ * @return std::vector<std::string_view> View ke kata-kata yang terambil
+ * 
+ * @par Catatan Performa
+ * - O(count) per pemanggilan, tanpa copy string
+ * - Hash map displaced paling banyak sebesar bucket, sehingga sesi
+ *   selama apapun memakai memory konstan
+ * 
+ * @see getWords()
+ */
+std::vector<std::string_view> TextProvider::drawWords(WordDeck& deck, int count) {
+    if (deck.mode == TextMode::MARKOV) {
+        if (const MarkovModel* model = findModel(deck.language, deck.difficulty)) {
+            return model->generate(count, rng, deck.chainState);
+        }
+    }
+
+    std::vector<std::string_view> result;
     
     // Cek ketersediaan bahasa dalam database
     // Jika bahasa tidak ditemukan, return vector kosong
-    if (wordBanks.find(language) == wordBanks.end()) {
+    auto it = wordBanks.find(deck.language);
+    if (it == wordBanks.end() || count <= 0) {
         return result;
     }
 
-    const auto& allWords = wordBanks[language];
-    std::vector<std::string> filtered;
+    const WordBank& bank = it->second;
+    const uint32_t bucket = bank.bucketSize[static_cast<size_t>(deck.difficulty)];
 
-    // Filter kata berdasarkan tingkat kesulitan
-    // Loop melalui semua kata dan cek apakah valid untuk difficulty
-    for (const auto& w : allWords) {
-        if (isWordValidForDifficulty(w, difficulty)) {
-            filtered.push_back(w);
+    // Jika tidak ada kata yang memenuhi kriteria, return kosong
+    if (bucket == 0) return result;
+
+    result.reserve(static_cast<size_t>(count));
+
+    if (deck.mode == TextMode::WEAK_BIGRAMS) {
+        if (const std::vector<double>* table = findWeakTable(deck.language, deck.difficulty)) {
+            std::uniform_real_distribution<double> uniform(0.0, table->back());
+            for (int n = 0; n < count; ++n) {
+                // Satu kali undi ulang cukup untuk menghindari kata kembar berurutan
+                uint32_t picked = 0;
+                for (int attempt = 0; attempt < 2; ++attempt) {
+                    const auto found = std::upper_bound(table->begin(), table->end(), uniform(rng));
+                    picked = static_cast<uint32_t>(std::min<std::ptrdiff_t>(found - table->begin(), bucket - 1));
+                    if (picked != deck.lastPicked) break;
+                }
+                deck.lastPicked = picked;
+                result.push_back(bank.word(readU32(bank.order + picked * 4)));
+            }
+            return result;
         }
     }
 
-    // Jika tidak ada kata yang memenuhi kriteria, return kosong
-    if (filtered.empty()) return result;
+    shuffleDeck(deck, bucket, count,
+                [this](uint32_t lo, uint32_t hi) {
+                    return std::uniform_int_distribution<uint32_t>(lo, hi)(rng);
+                },
+                [&](uint32_t picked) {
+                    result.push_back(bank.word(readU32(bank.order + picked * 4)));
+                });
 
-    // IMPROVED RANDOMIZATION:
-    // Shuffle seluruh filtered list, lalu ambil N pertama.
-    // Ini memastikan kata-kata tidak berulang dalam satu sesi
-    // dan menghasilkan variasi yang lebih baik pada setiap restart.
-    std::shuffle(filtered.begin(), filtered.end(), rng);
-    
-    // Ambil kata sebanyak count (atau semua jika filtered.size() < count)
-    int numWords = std::min(count, static_cast<int>(filtered.size()));
-    for (int i = 0; i < numWords; ++i) {
-        result.push_back(filtered[i]);
+    return result;
+}
+
+/**
+ * @brief Mengganti bobot bigram; tabel kumulatif lama dibuang
+ */
+void TextProvider::setBigramWeights(std::vector<float> weights) {
+    bigramWeights = std::move(weights);
+    weakTables.clear();
+}
+
+/**
+ * @brief Membangun (sekali) tabel bobot kumulatif satu bucket
+ * 
+ * Bobot kata = 1 + WEAK_BIAS * jumlah skor bigram di dalam kata, sehingga
+ * kata tanpa bigram lemah tetap bisa muncul. Dibangun saat pertama kali
+ * dipakai: O(total karakter bucket), lalu O(log n) per kata.
+ * 
+ * @param language Kode bahasa
+ * @param difficulty Tingkat kesulitan
+ * @return Tabel kumulatif (ukuran = bucket), atau nullptr
+ */
+const std::vector<double>* TextProvider::findWeakTable(const std::string& language, Difficulty difficulty) {
+    auto bankIt = wordBanks.find(language);
+    if (bigramWeights.size() != 128 * 128 || bankIt == wordBanks.end()) {
+        return nullptr;
     }
 
+    const WordBank& bank = bankIt->second;
+    const uint32_t bucket = bank.bucketSize[static_cast<size_t>(difficulty)];
+    if (bucket == 0) {
+        return nullptr;
+    }
+
+    std::vector<double>& table = weakTables[language][static_cast<size_t>(difficulty)];
+    if (table.size() == bucket) {
+        return &table;
+    }
+
+    table.resize(bucket);
+    double total = 0.0;
+    for (uint32_t pos = 0; pos < bucket; ++pos) {
+        const std::string_view word = bank.word(readU32(bank.order + pos * 4));
+        double score = 0.0;
+        for (size_t i = 1; i < word.size(); ++i) {
+            const unsigned char a = static_cast<unsigned char>(word[i - 1]);
+            const unsigned char b = static_cast<unsigned char>(word[i]);
+            if (a < 128 && b < 128) {
+                score += bigramWeights[a * 128u + b];
+            }
+        }
+        total += 1.0 + WEAK_BIAS * score;
+        table[pos] = total;
+    }
+    return &table;
+}
+
+/**
+ * @brief Mengambil kata acak yang ditentukan sepenuhnya oleh seed
+ * 
+ * Algoritma sama dengan getWords() (partial Fisher-Yates tanpa
+ * pengulangan), tetapi memakai Pcg32 lokal alih-alih RNG sesi. Hasilnya
+ * hanya bergantung pada seed, difficulty, count, dan isi word bank, jadi
+ * dua mesin dengan bankHash() yang sama menghasilkan teks yang identik.
+ * 
+ * @param language Kode bahasa
+ * @param difficulty Tingkat kesulitan
+ * @param count Jumlah kata (dibatasi ukuran bucket)
+ * @param seed Seed dari host
+ * @return std::vector<std::string_view> View ke kata-kata di pool
+ * 
+ * @see bankHash()
+ */
+std::vector<std::string_view> TextProvider::getSeededWords(const std::string& language, Difficulty difficulty,
+                                                           int count, uint64_t seed) const {
+    std::vector<std::string_view> result;
+    auto it = wordBanks.find(language);
+    if (it == wordBanks.end() || count <= 0) {
+        return result;
+    }
+
+    const WordBank& bank = it->second;
+    const uint32_t bucket = bank.bucketSize[static_cast<size_t>(difficulty)];
+    if (bucket == 0) return result;
+
+    count = static_cast<int>(std::min<uint32_t>(static_cast<uint32_t>(count), bucket));
+    result.reserve(static_cast<size_t>(count));
+
+    Pcg32 generator(seed);
+    WordDeck deck;
+    shuffleDeck(deck, bucket, count,
+                [&generator](uint32_t lo, uint32_t hi) {
+                    return lo + generator.below(hi - lo + 1);
+                },
+                [&](uint32_t picked) {
+                    result.push_back(bank.word(readU32(bank.order + picked * 4)));
+                });
+    return result;
+}
+
+uint64_t TextProvider::bankHash(const std::string& language) const {
+    auto it = wordBanks.find(language);
+    return it == wordBanks.end() ? 0 : it->second.contentHash;
+}
+
+std::vector<std::string> TextProvider::languages() const {
+    std::vector<std::string> result;
+    result.reserve(wordBanks.size());
+    for (const auto& entry : wordBanks) {
+        result.push_back(entry.first);
+    }
     return result;
 }
 
+/**
+ * @brief Mencari model Markov yang siap dipakai
+ */
+const MarkovModel* TextProvider::findModel(const std::string& language, Difficulty difficulty) const {
+    auto it = corpusModels.find(language);
+    if (it == corpusModels.end()) {
+        return nullptr;
+    }
+    const MarkovModel& model = it->second[static_cast<size_t>(difficulty)];
+    return model.empty() ? nullptr : &model;
+}
+
 // ============================================================================
 // DIFFICULTY VALIDATION
 // ============================================================================
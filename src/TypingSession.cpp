@@ -0,0 +1,351 @@
+/**
+ * @file TypingSession.cpp
+ * @brief Implementation of TypingSession typing engine
+ * @author Alea Farrel & Team
+ * @date 2025
+ */
+
+#include "TypingSession.h"
+
+TypingSession::TypingSession(QObject *parent)
+    : QObject(parent), m_wrongInBuffer(0), m_lockedLimit(0), m_lastKeyUs(0),
+      m_cleanRun(false), m_elapsedMs(0), m_started(false), m_finished(false), m_streaming(false),
+      m_characters(new CharacterModel(this, this)) {
+  connect(this, &TypingSession::cursorPositionChanged, this,
+          &TypingSession::cursorLineChanged);
+
+  // A new column count rewraps the window; top it up once layout settles
+  connect(
+      m_characters, &CharacterModel::columnsChanged, this,
+      [this]() {
+        maintainWindow();
+        emit cursorLineChanged();
+      },
+      Qt::QueuedConnection);
+}
+
+// ============================================================================
+// PROPERTIES
+// ============================================================================
+
+QString TypingSession::targetText() const { return m_targetText; }
+
+void TypingSession::setTargetText(const QString &text) {
+  if (text == m_targetText)
+    return;
+  m_targetText = text;
+  m_characters->setText(text);
+  emit targetTextChanged();
+  reset();
+  maintainWindow();
+}
+
+int TypingSession::length() const { return int(m_targetText.size()); }
+
+int TypingSession::cursorPosition() const { return int(m_typed.size()); }
+
+int TypingSession::cursorLine() const {
+  return m_characters->lineOf(cursorPosition());
+}
+
+int TypingSession::correctChars() const { return m_stats.correctKeystrokes; }
+
+int TypingSession::incorrectChars() const { return m_stats.errors; }
+
+int TypingSession::totalKeystrokes() const { return m_stats.totalKeystrokes; }
+
+bool TypingSession::isStarted() const { return m_started; }
+
+bool TypingSession::isFinished() const { return m_finished; }
+
+bool TypingSession::isStreaming() const { return m_streaming; }
+
+void TypingSession::setStreaming(bool streaming) {
+  if (streaming == m_streaming)
+    return;
+  m_streaming = streaming;
+  emit streamingChanged();
+  maintainWindow();
+}
+
+CharacterModel *TypingSession::characters() const { return m_characters; }
+
+// ============================================================================
+// INPUT
+// ============================================================================
+
+void TypingSession::inputText(const QString &text) {
+  const int before = cursorPosition();
+  const int totalBefore = m_stats.totalKeystrokes;
+
+  for (QChar ch : text) {
+    if (m_finished)
+      break;
+    if (ch != QLatin1Char('\r') && ch != QLatin1Char('\n'))
+      typeChar(ch);
+  }
+
+  if (cursorPosition() != before)
+    emit cursorPositionChanged();
+  if (m_stats.totalKeystrokes != totalBefore)
+    emit statsChanged();
+
+  if (m_streaming)
+    maintainWindow();
+  else if (!m_finished && cursorPosition() >= length() && length() > 0)
+    finish();
+}
+
+void TypingSession::appendText(const QString &text) {
+  if (text.isEmpty() || m_finished)
+    return;
+
+  const int before = length();
+  const QString chunk =
+      m_targetText.isEmpty() ? text : QLatin1Char(' ') + text;
+  m_targetText += chunk;
+  m_correctCounted.resize(m_targetText.size());
+  m_errorCounted.resize(m_targetText.size());
+  m_characters->appendText(chunk);
+  emit targetTextChanged();
+
+  // The cell after the cursor may have been the old end of the text
+  if (cursorPosition() == before)
+    notifyCell(before);
+  // ...and the word under the cursor may have wrapped to the next line
+  emit cursorLineChanged();
+
+  maintainWindow();
+}
+
+void TypingSession::typeChar(QChar ch) {
+  const int pos = cursorPosition();
+  if (pos >= length())
+    return;
+
+  if (!m_started) {
+    m_started = true;
+    m_timer.start();
+    emit startedChanged();
+  }
+
+  m_typed.append(ch);
+  m_stats.totalKeystrokes++;
+
+  const QChar target = m_targetText.at(pos);
+  if (ch == target) {
+    // Count each position once, even if retyped after a backspace
+    if (!m_correctCounted.testBit(pos)) {
+      m_correctCounted.setBit(pos);
+      m_stats.correctKeystrokes++;
+    }
+    // A correct space typed with no mistakes before it becomes the new
+    // checkpoint that backspace cannot cross
+    if (target == QLatin1Char(' ') && m_wrongInBuffer == 0)
+      m_lockedLimit = pos + 1;
+    recordKey(ReplayEvent::CORRECT, pos);
+    emit correctTyped();
+  } else {
+    if (!m_errorCounted.testBit(pos)) {
+      m_errorCounted.setBit(pos);
+      m_stats.errors++;
+    }
+    m_wrongInBuffer++;
+    recordKey(ReplayEvent::INCORRECT, pos);
+    emit errorTyped();
+  }
+
+  notifyCell(pos);
+  if (pos + 1 < length())
+    notifyCell(pos + 1);
+}
+
+bool TypingSession::canBackspace() const {
+  return !m_finished && cursorPosition() > m_lockedLimit;
+}
+
+bool TypingSession::backspace() {
+  if (!canBackspace())
+    return false;
+
+  const int pos = cursorPosition() - 1;
+  if (m_typed.at(pos) != m_targetText.at(pos))
+    m_wrongInBuffer--;
+  m_typed.chop(1);
+  recordKey(ReplayEvent::BACKSPACE, pos);
+
+  notifyCell(pos);
+  if (pos + 1 < length())
+    notifyCell(pos + 1);
+  emit cursorPositionChanged();
+  return true;
+}
+
+void TypingSession::reset() {
+  const bool wasStarted = m_started;
+  const bool wasFinished = m_finished;
+
+  m_typed.clear();
+  m_typed.reserve(m_targetText.size());
+  m_correctCounted.fill(false, m_targetText.size());
+  m_errorCounted.fill(false, m_targetText.size());
+  m_wrongInBuffer = 0;
+  m_lockedLimit = 0;
+  m_stats.reset();
+  m_replay.clear(uint32_t(m_targetText.size()));
+  m_keyStats.clear();
+  m_lastKeyUs = 0;
+  m_cleanRun = false;
+  m_elapsedMs = 0;
+  m_started = false;
+  m_finished = false;
+
+  m_characters->allCellsChanged();
+  emit stateReset();
+  emit cursorPositionChanged();
+  emit statsChanged();
+  if (wasStarted)
+    emit startedChanged();
+  if (wasFinished)
+    emit finishedChanged();
+}
+
+void TypingSession::finish() {
+  if (m_finished)
+    return;
+  m_elapsedMs = m_started ? m_timer.elapsed() : 0;
+  m_finished = true;
+  emit finishedChanged();
+  emit sessionFinished();
+}
+
+// ============================================================================
+// STREAMING WINDOW
+// ============================================================================
+
+/**
+ * Keeps the streamed window a few lines long: lines behind the checkpoint
+ * (so backspace can never reach them) are retired once the cursor is past
+ * RETAINED_LINES, and more text is requested when fewer than
+ * LOOKAHEAD_LINES remain below the cursor line.
+ */
+void TypingSession::maintainWindow() {
+  if (!m_streaming || m_finished || m_targetText.isEmpty())
+    return;
+
+  int cursorLine = m_characters->lineOf(cursorPosition());
+  while (cursorLine > RETAINED_LINES) {
+    const int retiredEnd = m_characters->lineStart(1);
+    if (retiredEnd > m_lockedLimit)
+      break;
+    retire(retiredEnd);
+    --cursorLine;
+  }
+
+  if (m_characters->lineCount() - 1 - cursorLine < LOOKAHEAD_LINES)
+    emit textNeeded();
+}
+
+void TypingSession::retire(int count) {
+  // Only fully correct text lies behind the checkpoint, so m_wrongInBuffer
+  // and Stats are unaffected
+  m_targetText.remove(0, count);
+  m_typed.remove(0, count);
+  m_lockedLimit -= count;
+
+  QBitArray correct(m_targetText.size());
+  QBitArray error(m_targetText.size());
+  for (int i = 0; i < correct.size(); ++i) {
+    correct.setBit(i, m_correctCounted.testBit(i + count));
+    error.setBit(i, m_errorCounted.testBit(i + count));
+  }
+  m_correctCounted = correct;
+  m_errorCounted = error;
+
+  m_characters->removeLeading(count);
+  emit targetTextChanged();
+  emit cursorPositionChanged();
+}
+
+void TypingSession::notifyCell(int index) {
+  m_characters->cellChanged(index);
+  emit charStateChanged(index);
+}
+
+void TypingSession::recordKey(ReplayEvent event, int pos) {
+  const quint64 nowUs = quint64(m_timer.nsecsElapsed() / 1000);
+  m_replay.record(event, nowUs);
+
+  // Key analytics are keyed on the target text. Only a correct key right
+  // after a correct key at the previous position yields a latency sample;
+  // the pause after a mistake or backspace is correction time.
+  if (event != ReplayEvent::BACKSPACE) {
+    const uint32_t key = m_targetText.at(pos).unicode();
+    const uint32_t previous =
+        pos > 0 ? m_targetText.at(pos - 1).unicode() : KeyStats::NO_KEY;
+    if (event == ReplayEvent::CORRECT) {
+      if (m_cleanRun)
+        m_keyStats.recordHit(previous, key, nowUs - m_lastKeyUs);
+    } else {
+      m_keyStats.recordMiss(previous, key);
+    }
+  }
+  m_cleanRun = event == ReplayEvent::CORRECT;
+  m_lastKeyUs = nowUs;
+}
+
+// ============================================================================
+// QUERIES
+// ============================================================================
+
+int TypingSession::charState(int index) const {
+  const int cursor = cursorPosition();
+  if (index < 0 || index > cursor)
+    return Pending;
+  if (index == cursor)
+    return Current;
+  return m_typed.at(index) == m_targetText.at(index) ? Correct : Incorrect;
+}
+
+QString TypingSession::typedCharAt(int index) const {
+  if (index < 0 || index >= cursorPosition())
+    return QString();
+  return QString(m_typed.at(index));
+}
+
+int TypingSession::elapsedMs() const {
+  return int(m_finished ? m_elapsedMs : (m_started ? m_timer.elapsed() : 0));
+}
+
+double TypingSession::elapsedSeconds() const {
+  const qint64 ms = elapsedMs();
+  // Avoid division by zero for instant finishes
+  return ms > 0 ? ms / 1000.0 : 1.0;
+}
+
+QVariantMap TypingSession::results() const {
+  Stats stats = m_stats;
+  stats.timeTaken = elapsedSeconds();
+  stats.calculate(length());
+
+  QVariantMap result;
+  result["wpm"] = stats.wpm;
+  result["accuracy"] = stats.accuracy;
+  result["timeElapsed"] = stats.timeTaken;
+  result["errors"] = stats.errors;
+  return result;
+}
+
+QByteArray TypingSession::replayData() const {
+  if (!m_finished || m_streaming || m_replay.empty())
+    return QByteArray();
+  const std::string data = m_replay.serialize();
+  return QByteArray(data.data(), qsizetype(data.size()));
+}
+
+QByteArray TypingSession::keyStatsData() const {
+  if (!m_finished || m_keyStats.empty())
+    return QByteArray();
+  const std::string data = m_keyStats.serialize();
+  return QByteArray(data.data(), qsizetype(data.size()));
+}
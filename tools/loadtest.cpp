@@ -0,0 +1,707 @@
+/**
+ * @file loadtest.cpp
+ * @brief Headless load test for the multiplayer mesh with simulated bot peers.
+ * @author RapidTexter Team
+ * @date 2026
+ *
+ * Every bot is a standalone NetworkManager (no QML, no discovery, free TCP
+ * port) driven by a typing model: key intervals are log-normal around the
+ * bot's target speed, drawn once per bot from --wpm / --wpm-stddev, and a
+ * mistyped key (--error-rate) costs a wrong character plus a backspace.
+ * HELLO/PEER_LIST, READY_CHECK, clock sync, PROGRESS_UPDATE and FINISH all
+ * go through the real protocol code; the harness only types and watches.
+ *
+ * Reported per run:
+ * - packets/s and bytes/s sent by all bots (TCP and data channel)
+ * - per-packet dispatch time in processPacket, from PerfMonitor
+ * - end-to-end progress latency: a bot reaching a position until another
+ *   bot in this process first sees it (same clock, so local bots only)
+ * - ranking correctness: every bot saw the same complete RACE_RESULTS,
+ *   sorted like checkRaceCompletion, with each bot's own numbers intact
+ *
+ * The exit code is 0 only if every round finished and every check passed,
+ * so the tool can gate protocol and topology changes. Built only with
+ * -DRAPIDTEXTER_BUILD_LOADTEST=ON, e.g.:
+ * @code
+ * rapidtexter_loadtest --bots 8 --rounds 3
+ * rapidtexter_loadtest --bots 32 --star --wpm 90 --wpm-stddev 25 --error-rate 0.05
+ * # Across machines: one process hosts, the others join it
+ * rapidtexter_loadtest --bots 4 --players 8 --port 52765
+ * rapidtexter_loadtest --bots 4 --join 192.168.1.10:52765
+ * @endcode
+ */
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QLoggingCategory>
+#include <QTextStream>
+#include <QTimer>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "NetworkManager.h"
+#include "PerfMonitor.h"
+#include "TextProvider.h"
+
+namespace {
+
+constexpr int JOIN_STAGGER_MS = 50;       // Spread joins like real players
+constexpr int LOBBY_POLL_MS = 100;
+constexpr double MIN_BOT_WPM = 10.0;
+constexpr double MAX_BOT_WPM = 250.0;
+constexpr double KEY_JITTER_SIGMA = 0.35;  // Log-normal spread of key intervals
+
+QTextStream& out() {
+    static QTextStream stream(stdout);
+    return stream;
+}
+
+struct Options {
+    int bots = 8;
+    int players = 0;            // Host mode: players to wait for (0 = bots)
+    QString joinIp;             // Join mode when set
+    quint16 port = 0;
+    bool star = false;
+    double wpm = 80.0;
+    double wpmStddev = 20.0;
+    double errorRate = 0.03;
+    int words = 30;
+    int rounds = 1;
+    quint64 seed = 1;
+    QString wordsFile;
+    int timeoutSec = 120;
+};
+
+// One simulated player
+struct Bot {
+    int number = 0;
+    NetworkManager* net = nullptr;
+    QTimer* keyTimer = nullptr;
+    std::mt19937 rng;
+    double wpm = 0.0;                   // Target speed, fixed for the run
+
+    // Current race
+    QString text;
+    int position = 0;
+    int errors = 0;
+    bool backspacePending = false;      // Last key was wrong
+    bool racing = false;
+    qint64 startUs = 0;
+    int roster = 0;                     // Players in the room at race start
+    std::vector<qint64> reachedUs;      // First time each position was reached (-1 = not yet)
+    QHash<QString, int> seenPosition;   // Highest position seen per local sender
+
+    // Results
+    int reportedWpm = 0;
+    double reportedAccuracy = 100.0;
+    bool hasResults = false;
+    QVariantList rankings;
+
+    QString name() const { return QString("bot-%1").arg(number); }
+};
+
+// Traffic counters summed over every bot's peers
+struct Traffic {
+    quint64 tcpPackets = 0;
+    quint64 tcpBytes = 0;
+    quint64 udpPackets = 0;
+    quint64 udpBytes = 0;
+
+    Traffic operator-(const Traffic& other) const {
+        return {tcpPackets - other.tcpPackets, tcpBytes - other.tcpBytes,
+                udpPackets - other.udpPackets, udpBytes - other.udpBytes};
+    }
+    Traffic& operator+=(const Traffic& other) {
+        tcpPackets += other.tcpPackets;
+        tcpBytes += other.tcpBytes;
+        udpPackets += other.udpPackets;
+        udpBytes += other.udpBytes;
+        return *this;
+    }
+};
+
+// Same order as NetworkManager::checkRaceCompletion
+bool ranksBefore(const QVariantMap& a, const QVariantMap& b) {
+    if (a["wpm"].toInt() != b["wpm"].toInt()) return a["wpm"].toInt() > b["wpm"].toInt();
+    if (a["accuracy"].toDouble() != b["accuracy"].toDouble()) {
+        return a["accuracy"].toDouble() > b["accuracy"].toDouble();
+    }
+    if (a["errors"].toInt() != b["errors"].toInt()) return a["errors"].toInt() < b["errors"].toInt();
+    return a["duration"].toDouble() < b["duration"].toDouble();
+}
+
+QString formatSummary(const QVariantMap& summary) {
+    return QString("n=%1 mean=%2 p50=%3 p90=%4 p99=%5 max=%6 ms")
+        .arg(summary["count"].toULongLong())
+        .arg(summary["mean"].toDouble(), 0, 'f', 3)
+        .arg(summary["p50"].toDouble(), 0, 'f', 3)
+        .arg(summary["p90"].toDouble(), 0, 'f', 3)
+        .arg(summary["p99"].toDouble(), 0, 'f', 3)
+        .arg(summary["max"].toDouble(), 0, 'f', 3);
+}
+
+class LoadTest : public QObject {
+public:
+    explicit LoadTest(const Options& options) : m_options(options), m_rng(options.seed) {}
+
+    bool start();
+
+private:
+    bool hostMode() const { return m_options.joinIp.isEmpty(); }
+    NetworkManager* host() const { return m_bots.front()->net; }
+
+    Bot* createBot(int number);
+    void connectBot(Bot* bot);
+    void joinBot(Bot* bot, const QString& ip, quint16 port, int delayMs);
+
+    void pollLobby();
+    void startRound();
+    void beginTyping(Bot* bot);
+    void typeKey(Bot* bot);
+    void markReached(Bot* bot);
+    int keyIntervalMs(Bot* bot);
+    void finishBotRace(Bot* bot);
+    void onProgressSeen(Bot* receiver, const QString& senderId, double progress);
+    void onResults(Bot* bot, const QVariantList& rankings);
+    bool allHaveResults() const;
+    void finishRound();
+    QStringList checkRankings() const;
+    void onPlayAgainAccepted();
+
+    Traffic sampleTraffic() const;
+    QString buildText(int round) const;
+    qint64 nowUs() const { return m_clock.nsecsElapsed() / 1000; }
+    void armDeadline(const QString& waitingFor);
+    void fail(const QString& reason);
+    void finish();
+    void report();
+
+    Options m_options;
+    std::mt19937 m_rng;
+    TextProvider m_words;
+    QElapsedTimer m_clock;
+    std::vector<std::unique_ptr<Bot>> m_bots;
+    QHash<QString, Bot*> m_botsById;
+
+    QTimer m_lobbyTimer;
+    QTimer m_deadline;
+    QString m_waitingFor;
+
+    int m_expectedPlayers = 0;
+    int m_round = 0;
+    int m_roundsCorrect = 0;
+    int m_playAgainAccepted = 0;
+    bool m_failed = false;
+    bool m_finished = false;
+
+    qint64 m_roundStartUs = 0;
+    Traffic m_roundStartTraffic;
+    Traffic m_totalTraffic;
+    qint64 m_totalRaceUs = 0;
+    LatencyHistogram m_progressLatency;
+};
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+bool LoadTest::start() {
+    if (hostMode() && !m_words.loadWords("en", m_options.wordsFile.toStdString())) {
+        out() << "Cannot load word list " << m_options.wordsFile << Qt::endl;
+        return false;
+    }
+
+    m_clock.start();
+    PerfMonitor::instance()->setEnabled(true);
+
+    m_deadline.setSingleShot(true);
+    connect(&m_deadline, &QTimer::timeout, this, [this]() {
+        fail("Timed out waiting for " + m_waitingFor);
+    });
+    m_lobbyTimer.setInterval(LOBBY_POLL_MS);
+    connect(&m_lobbyTimer, &QTimer::timeout, this, &LoadTest::pollLobby);
+
+    for (int i = 0; i < m_options.bots; ++i) {
+        m_bots.push_back(std::unique_ptr<Bot>(createBot(i)));
+    }
+
+    if (!hostMode()) {
+        for (size_t i = 0; i < m_bots.size(); ++i) {
+            joinBot(m_bots[i].get(), m_options.joinIp, m_options.port,
+                    static_cast<int>(i) * JOIN_STAGGER_MS);
+        }
+        out() << "Joining " << m_options.joinIp << ":" << m_options.port
+              << " with " << m_bots.size() << " bots" << Qt::endl;
+        armDeadline("the host to start round 1");
+        return true;
+    }
+
+    NetworkManager* hostNet = host();
+    hostNet->setStarTopology(m_options.star);
+    m_expectedPlayers = m_options.players > 0 ? m_options.players : m_options.bots;
+    if (m_expectedPlayers > hostNet->maxPlayers()) {
+        out() << m_expectedPlayers << " players exceed the " << (m_options.star ? "star" : "mesh")
+              << " limit of " << hostNet->maxPlayers() << Qt::endl;
+        return false;
+    }
+    if (!hostNet->createRoom()) {
+        out() << "Cannot create room: " << hostNet->connectionError() << Qt::endl;
+        return false;
+    }
+
+    const quint16 port = hostNet->serverPort();
+    out() << "Room open on port " << port << " (" << (m_options.star ? "star" : "mesh")
+          << "), waiting for " << m_expectedPlayers << " players" << Qt::endl;
+    for (size_t i = 1; i < m_bots.size(); ++i) {
+        joinBot(m_bots[i].get(), "127.0.0.1", port, static_cast<int>(i) * JOIN_STAGGER_MS);
+    }
+
+    armDeadline("players to join");
+    m_lobbyTimer.start();
+    return true;
+}
+
+Bot* LoadTest::createBot(int number) {
+    auto* bot = new Bot();
+    bot->number = number;
+    bot->rng.seed(static_cast<std::mt19937::result_type>(m_options.seed + number));
+
+    std::normal_distribution<double> speed(m_options.wpm, m_options.wpmStddev);
+    bot->wpm = std::clamp(speed(m_rng), MIN_BOT_WPM, MAX_BOT_WPM);
+
+    bot->net = new NetworkManager(0, false, this);
+    bot->net->setPlayerName(bot->name());
+    bot->keyTimer = new QTimer(this);
+    bot->keyTimer->setSingleShot(true);
+    bot->keyTimer->setTimerType(Qt::PreciseTimer);
+
+    m_botsById.insert(bot->net->playerId(), bot);
+    connectBot(bot);
+    return bot;
+}
+
+void LoadTest::connectBot(Bot* bot) {
+    NetworkManager* net = bot->net;
+    connect(bot->keyTimer, &QTimer::timeout, this, [this, bot]() { typeKey(bot); });
+    connect(net, &NetworkManager::gameStarted, this, [this, bot]() { beginTyping(bot); });
+    connect(net, &NetworkManager::playerProgressUpdated, this,
+            [this, bot](const QString& id, const QString&, double progress, int, bool, int) {
+                onProgressSeen(bot, id, progress);
+            });
+    connect(net, &NetworkManager::raceFinished, this,
+            [this, bot](const QVariantList& rankings) { onResults(bot, rankings); });
+    connect(net, &NetworkManager::playAgainInviteReceived, net, &NetworkManager::acceptPlayAgain);
+    connect(net, &NetworkManager::playAgainAccepted, this, &LoadTest::onPlayAgainAccepted);
+    connect(net, &NetworkManager::joinFailed, this, [this, bot](const QString& reason) {
+        fail(bot->name() + " could not join: " + reason);
+    });
+    connect(net, &NetworkManager::kicked, this, [this, bot]() {
+        fail(bot->name() + " was kicked");
+    });
+}
+
+void LoadTest::joinBot(Bot* bot, const QString& ip, quint16 port, int delayMs) {
+    QTimer::singleShot(delayMs, this, [this, bot, ip, port]() {
+        if (!bot->net->joinRoom(ip, port)) {
+            fail(bot->name() + " could not start joining " + ip);
+        }
+    });
+}
+
+// ============================================================================
+// ROUNDS
+// ============================================================================
+
+void LoadTest::pollLobby() {
+    // Mesh: every bot has connected to everyone; star: the roster reached everyone
+    for (const auto& bot : m_bots) {
+        if (bot->net->players().size() < m_expectedPlayers) return;
+    }
+    m_lobbyTimer.stop();
+    startRound();
+}
+
+QString LoadTest::buildText(int round) const {
+    const auto words = m_words.getSeededWords("en", Difficulty::MEDIUM, m_options.words,
+                                              m_options.seed + static_cast<quint64>(round));
+    QStringList list;
+    list.reserve(static_cast<qsizetype>(words.size()));
+    for (const auto& word : words) {
+        list.append(QString::fromUtf8(word.data(), static_cast<qsizetype>(word.size())));
+    }
+    return list.join(' ');
+}
+
+void LoadTest::startRound() {
+    ++m_round;
+    for (const auto& bot : m_bots) {
+        bot->hasResults = false;
+        bot->rankings.clear();
+    }
+    m_playAgainAccepted = 0;
+    m_roundStartUs = nowUs();
+    m_roundStartTraffic = sampleTraffic();
+
+    if (hostMode()) {
+        host()->setGameText(buildText(m_round));
+        host()->startCountdown();
+    }
+    armDeadline(QString("round %1 to finish").arg(m_round));
+}
+
+void LoadTest::beginTyping(Bot* bot) {
+    // Join mode: the remote host started the next round
+    if (!hostMode() && (m_round == 0 || allHaveResults())) {
+        startRound();
+    }
+
+    bot->text = bot->net->gameText();
+    if (bot->text.isEmpty()) {
+        fail(bot->name() + " started a race without text");
+        return;
+    }
+    bot->position = 0;
+    bot->errors = 0;
+    bot->backspacePending = false;
+    bot->racing = true;
+    bot->startUs = nowUs();
+    bot->roster = static_cast<int>(bot->net->players().size());
+    bot->reachedUs.assign(static_cast<size_t>(bot->text.size()) + 1, -1);
+    bot->reachedUs[0] = bot->startUs;
+    bot->seenPosition.clear();
+    bot->keyTimer->start(keyIntervalMs(bot));
+}
+
+int LoadTest::keyIntervalMs(Bot* bot) {
+    // 5 characters per word; the log-normal factor has mean 1
+    const double meanMs = 60000.0 / (bot->wpm * 5.0);
+    std::lognormal_distribution<double> jitter(-KEY_JITTER_SIGMA * KEY_JITTER_SIGMA / 2.0,
+                                               KEY_JITTER_SIGMA);
+    return std::max(1, static_cast<int>(std::lround(meanMs * jitter(bot->rng))));
+}
+
+void LoadTest::typeKey(Bot* bot) {
+    if (!bot->racing) return;
+
+    const int length = static_cast<int>(bot->text.size());
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    if (bot->backspacePending) {
+        bot->backspacePending = false;
+        --bot->position;
+    } else if (bot->position + 1 < length && coin(bot->rng) < m_options.errorRate) {
+        // Wrong character: shows up in progress, then gets deleted
+        ++bot->errors;
+        ++bot->position;
+        bot->backspacePending = true;
+    } else {
+        ++bot->position;
+    }
+    markReached(bot);
+
+    if (bot->position >= length) {
+        finishBotRace(bot);
+        return;
+    }
+
+    const double minutes = (nowUs() - bot->startUs) / 60e6;
+    const int wpm = minutes > 0.0 ? static_cast<int>(std::lround(bot->position / 5.0 / minutes)) : 0;
+    bot->net->updateProgress(bot->position, length, wpm);
+    bot->keyTimer->start(keyIntervalMs(bot));
+}
+
+void LoadTest::markReached(Bot* bot) {
+    qint64& reached = bot->reachedUs[static_cast<size_t>(bot->position)];
+    if (reached < 0) {
+        reached = nowUs();
+    }
+}
+
+void LoadTest::finishBotRace(Bot* bot) {
+    bot->racing = false;
+
+    const int length = static_cast<int>(bot->text.size());
+    const double seconds = (nowUs() - bot->startUs) / 1e6;
+    bot->reportedWpm = static_cast<int>(std::lround(length / 5.0 / (seconds / 60.0)));
+    bot->reportedAccuracy = 100.0 * length / (length + bot->errors);
+
+    bot->net->updateProgress(length, length, bot->reportedWpm);
+    bot->net->finishRace(bot->reportedWpm, bot->reportedAccuracy, bot->errors,
+                         static_cast<int>(std::lround(seconds)));
+}
+
+void LoadTest::onProgressSeen(Bot* receiver, const QString& senderId, double progress) {
+    Bot* sender = m_botsById.value(senderId);
+    if (!sender || sender == receiver || sender->reachedUs.empty()) return;
+
+    // Snapshots and heartbeats repeat positions; only the first sighting counts
+    const int position = static_cast<int>(std::lround(progress * sender->text.size()));
+    if (position <= receiver->seenPosition.value(senderId, 0) ||
+        position >= static_cast<int>(sender->reachedUs.size())) return;
+    receiver->seenPosition[senderId] = position;
+
+    const qint64 reached = sender->reachedUs[static_cast<size_t>(position)];
+    if (reached >= 0) {
+        m_progressLatency.record(static_cast<uint64_t>(nowUs() - reached));
+    }
+}
+
+void LoadTest::onResults(Bot* bot, const QVariantList& rankings) {
+    bot->racing = false;
+    bot->keyTimer->stop();
+    bot->rankings = rankings;
+    bot->hasResults = true;
+
+    if (allHaveResults()) {
+        finishRound();
+    }
+}
+
+bool LoadTest::allHaveResults() const {
+    return std::all_of(m_bots.begin(), m_bots.end(), [](const auto& bot) { return bot->hasResults; });
+}
+
+QStringList LoadTest::checkRankings() const {
+    QStringList problems;
+    const Bot& reference = *m_bots.front();
+    const QVariantList& rankings = reference.rankings;
+
+    // Every bot got the same RACE_RESULTS
+    auto order = [](const QVariantList& list) {
+        QStringList ids;
+        for (const auto& entry : list) ids.append(entry.toMap()["id"].toString());
+        return ids;
+    };
+    const QStringList expectedOrder = order(rankings);
+    for (const auto& bot : m_bots) {
+        if (order(bot->rankings) != expectedOrder) {
+            problems.append(bot->name() + " received a different ranking than " + reference.name());
+        }
+    }
+
+    // Complete, numbered 1..n and sorted
+    if (rankings.size() != reference.roster) {
+        problems.append(QString("%1 of %2 players ranked").arg(rankings.size()).arg(reference.roster));
+    }
+    for (qsizetype i = 0; i < rankings.size(); ++i) {
+        const QVariantMap entry = rankings[i].toMap();
+        if (entry["position"].toInt() != i + 1) {
+            problems.append(QString("%1 has position %2 at rank %3")
+                                .arg(entry["name"].toString()).arg(entry["position"].toInt()).arg(i + 1));
+        }
+        if (i > 0 && ranksBefore(entry, rankings[i - 1].toMap())) {
+            problems.append(QString("%1 should rank above %2")
+                                .arg(entry["name"].toString(), rankings[i - 1].toMap()["name"].toString()));
+        }
+    }
+
+    // Each bot's own result arrived unchanged
+    for (const auto& bot : m_bots) {
+        const QString id = bot->net->playerId();
+        auto it = std::find_if(rankings.begin(), rankings.end(), [&id](const QVariant& entry) {
+            return entry.toMap()["id"].toString() == id;
+        });
+        if (it == rankings.end()) {
+            problems.append(bot->name() + " is missing from the ranking");
+            continue;
+        }
+        const QVariantMap entry = it->toMap();
+        if (entry["wpm"].toInt() != bot->reportedWpm || entry["errors"].toInt() != bot->errors ||
+            std::abs(entry["accuracy"].toDouble() - bot->reportedAccuracy) > 1e-9) {
+            problems.append(bot->name() + " result changed in transit");
+        }
+    }
+    return problems;
+}
+
+void LoadTest::finishRound() {
+    m_deadline.stop();
+
+    const qint64 elapsedUs = nowUs() - m_roundStartUs;
+    m_totalRaceUs += elapsedUs;
+    m_totalTraffic += sampleTraffic() - m_roundStartTraffic;
+
+    const QStringList problems = checkRankings();
+    const QVariantMap winner = m_bots.front()->rankings.value(0).toMap();
+    out() << QString("Round %1: %2 players in %3 s, winner %4 (%5 WPM), ranking %6")
+                 .arg(m_round).arg(m_bots.front()->rankings.size())
+                 .arg(elapsedUs / 1e6, 0, 'f', 1)
+                 .arg(winner["name"].toString()).arg(winner["wpm"].toInt())
+                 .arg(problems.isEmpty() ? "OK" : "WRONG")
+          << Qt::endl;
+    for (const QString& problem : problems) {
+        out() << "  " << problem << Qt::endl;
+    }
+    if (problems.isEmpty()) {
+        ++m_roundsCorrect;
+    } else {
+        m_failed = true;
+    }
+
+    if (m_round >= m_options.rounds) {
+        finish();
+        return;
+    }
+
+    if (hostMode()) {
+        host()->sendPlayAgainInvite();
+        armDeadline("guests to accept the next round");
+        if (host()->players().size() <= 1) {
+            startRound();
+        }
+    } else {
+        armDeadline(QString("the host to start round %1").arg(m_round + 1));
+    }
+}
+
+void LoadTest::onPlayAgainAccepted() {
+    if (!hostMode() || m_round >= m_options.rounds) return;
+    if (++m_playAgainAccepted == host()->players().size() - 1) {
+        startRound();
+    }
+}
+
+// ============================================================================
+// REPORTING
+// ============================================================================
+
+Traffic LoadTest::sampleTraffic() const {
+    Traffic traffic;
+    for (const auto& bot : m_bots) {
+        const QVariantList peers = bot->net->peerStats();
+        for (const auto& peer : peers) {
+            const QVariantMap stats = peer.toMap();
+            traffic.tcpPackets += stats["packetsSent"].toULongLong();
+            traffic.tcpBytes += stats["bytesSent"].toULongLong();
+            traffic.udpPackets += stats["datagramsSent"].toULongLong();
+            traffic.udpBytes += stats["datagramBytesSent"].toULongLong();
+        }
+    }
+    return traffic;
+}
+
+void LoadTest::armDeadline(const QString& waitingFor) {
+    m_waitingFor = waitingFor;
+    m_deadline.start(m_options.timeoutSec * 1000);
+}
+
+void LoadTest::fail(const QString& reason) {
+    if (m_finished) return;
+    out() << "FAILED: " << reason << Qt::endl;
+    m_failed = true;
+    finish();
+}
+
+void LoadTest::finish() {
+    if (m_finished) return;
+    m_finished = true;
+
+    m_lobbyTimer.stop();
+    m_deadline.stop();
+    for (const auto& bot : m_bots) {
+        bot->keyTimer->stop();
+    }
+    PerfMonitor::instance()->setEnabled(false);
+
+    report();
+    QCoreApplication::exit(m_failed ? 1 : 0);
+}
+
+void LoadTest::report() {
+    const double seconds = m_totalRaceUs / 1e6;
+    if (seconds > 0.0) {
+        const Traffic& t = m_totalTraffic;
+        out() << QString("Traffic:   %1 packets/s (tcp %2, udp %3), %4 KiB/s (tcp %5, udp %6)")
+                     .arg((t.tcpPackets + t.udpPackets) / seconds, 0, 'f', 1)
+                     .arg(t.tcpPackets / seconds, 0, 'f', 1)
+                     .arg(t.udpPackets / seconds, 0, 'f', 1)
+                     .arg((t.tcpBytes + t.udpBytes) / seconds / 1024.0, 0, 'f', 1)
+                     .arg(t.tcpBytes / seconds / 1024.0, 0, 'f', 1)
+                     .arg(t.udpBytes / seconds / 1024.0, 0, 'f', 1)
+              << Qt::endl;
+    }
+
+    const QVariantMap stats = PerfMonitor::instance()->stats();
+    out() << "Dispatch:  " << formatSummary(stats["packetDispatch"].toMap()) << Qt::endl;
+    const QVariantList packets = stats["packets"].toList();
+    for (const auto& packet : packets) {
+        const QVariantMap entry = packet.toMap();
+        out() << QString("  %1 %2").arg(entry["type"].toString(), -20).arg(formatSummary(entry))
+              << Qt::endl;
+    }
+
+    out() << "Progress:  " << formatSummary(m_progressLatency.summary()) << " (end to end)" << Qt::endl;
+    out() << "Rankings:  " << m_roundsCorrect << "/" << m_round << " rounds correct" << Qt::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("rapidtexter_loadtest");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Simulated bot peers against the multiplayer mesh.");
+    parser.addHelpOption();
+    const QCommandLineOption botsOption("bots", "Bots in this process (default 8).", "n", "8");
+    const QCommandLineOption playersOption(
+        "players", "Host: players to wait for, including remote ones (default: bots).", "n");
+    const QCommandLineOption joinOption("join", "Join a room at <ip:port> instead of hosting.", "ip:port");
+    const QCommandLineOption portOption("port", "Host: TCP port (default: any free port).", "port", "0");
+    const QCommandLineOption starOption("star", "Host: star topology instead of full mesh.");
+    const QCommandLineOption wpmOption("wpm", "Mean bot speed (default 80).", "wpm", "80");
+    const QCommandLineOption stddevOption("wpm-stddev", "Spread of bot speeds (default 20).", "wpm", "20");
+    const QCommandLineOption errorOption("error-rate", "Chance a key is wrong (default 0.03).", "p", "0.03");
+    const QCommandLineOption wordsOption("words", "Host: words per race (default 30).", "n", "30");
+    const QCommandLineOption roundsOption("rounds", "Races to run (default 1).", "n", "1");
+    const QCommandLineOption seedOption("seed", "Seed for speeds, typing and text (default 1).", "seed", "1");
+    const QCommandLineOption wordsFileOption(
+        "words-file", "Host: word list for race text.", "file", RAPIDTEXTER_ASSETS_DIR "/en.txt");
+    const QCommandLineOption timeoutOption(
+        "timeout", "Seconds to wait for each phase (default 120).", "s", "120");
+    const QCommandLineOption verboseOption("verbose", "Keep NetworkManager debug output.");
+    parser.addOptions({botsOption, playersOption, joinOption, portOption, starOption, wpmOption,
+                       stddevOption, errorOption, wordsOption, roundsOption, seedOption,
+                       wordsFileOption, timeoutOption, verboseOption});
+    parser.process(app);
+
+    if (!parser.isSet(verboseOption)) {
+        QLoggingCategory::setFilterRules("default.debug=false");
+    }
+
+    Options options;
+    options.bots = std::max(1, parser.value(botsOption).toInt());
+    options.players = parser.value(playersOption).toInt();
+    options.port = static_cast<quint16>(parser.value(portOption).toUInt());
+    options.star = parser.isSet(starOption);
+    options.wpm = parser.value(wpmOption).toDouble();
+    options.wpmStddev = std::max(0.0, parser.value(stddevOption).toDouble());
+    options.errorRate = std::clamp(parser.value(errorOption).toDouble(), 0.0, 0.9);
+    options.words = std::max(1, parser.value(wordsOption).toInt());
+    options.rounds = std::max(1, parser.value(roundsOption).toInt());
+    options.seed = parser.value(seedOption).toULongLong();
+    options.wordsFile = parser.value(wordsFileOption);
+    options.timeoutSec = std::max(1, parser.value(timeoutOption).toInt());
+
+    if (parser.isSet(joinOption)) {
+        const QString target = parser.value(joinOption);
+        const qsizetype colon = target.lastIndexOf(':');
+        options.joinIp = target.left(colon);
+        options.port = static_cast<quint16>(target.mid(colon + 1).toUInt());
+        if (colon <= 0 || options.port == 0) {
+            out() << "--join expects <ip:port>" << Qt::endl;
+            return 2;
+        }
+    }
+
+    LoadTest test(options);
+    if (!test.start()) {
+        return 2;
+    }
+    return app.exec();
+}
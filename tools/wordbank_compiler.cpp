@@ -0,0 +1,31 @@
+/**
+ * @file wordbank_compiler.cpp
+ * @brief Build-time tool untuk meng-compile word bank teks ke format binary
+ * @author Alea Farrel & Team
+ * @date 2025
+ *
+ * Dipanggil oleh CMake untuk setiap word bank teks di assets/ sehingga aplikasi
+ * bisa me-map word bank langsung dari Qt resource tanpa parsing saat
+ * startup. Tool ini tidak bergantung pada Qt.
+ *
+ * @par Penggunaan
+ * @code
+ * rapidtexter_wordbank assets/en.txt build/wordbanks/en.rtwb
+ * @endcode
+ */
+
+#include "TextProvider.h"
+#include <iostream>
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <input.txt> <output.rtwb>" << std::endl;
+        return 1;
+    }
+
+    if (!TextProvider::compileWordFile(argv[1], argv[2])) {
+        std::cerr << "Failed to compile word bank: " << argv[1] << std::endl;
+        return 1;
+    }
+    return 0;
+}